@@ -59,6 +59,7 @@
 // - Utilities to produce the accumulated index counts from multple arrays
 // - Utilities to implement the index counts to offsets transforms
 // - Utilities to establish the tresholds for 2-, 4-, 6-, 8-, 12- and 18-way multithreading
+// - Run-time adjustable tresholds for 2-, 4-, 6-, 8-, 12- and 18-way multithreading
 // - Function implementation templates for 80-bit-based long double types without indirection
 // - Function implementation templates for 80-bit-based long double types with indirection
 // - Function implementation templates for split up 128-bit types without indirection
@@ -73,23 +74,64 @@
 // - Reroutes to the 1- or 2-thread functions for single-part types
 // - Reroutes to the 1- or 2-thread functions (variants without indirection)
 // - Reroutes to the 1- or 2-thread functions (variants with indirection)
-// - Helper class to safely moderate a std::future<std::future<void>> item on the stack
+// - Helper class to safely moderate a taskfuture<taskfuture<void>> item on the stack
 // - Helper functions for converting inputs to perform unsigned comparisons in a final merging phase
 // - Helper functions for merging the halves from multithreading inputs without indirection
 // - Up to 4-way multithreading functions without indirection
 // - Helper functions for merging the thirds from multithreading inputs without indirection
 // - Up to 6-way multithreading functions without indirection
+// - Helper functions for merge-path merging from multithreading inputs without indirection
+// - Helper functions for the global histogram multithreading strategy without indirection
+// - Helper functions for the MSD-then-LSD multithreading strategy without indirection
+// - Helper functions for the sample sort multithreading strategy without indirection
 // - Up to 8-way multithreading functions without indirection
+// - Helper functions for more than 18-way multithreading without indirection
 // - Up to 16-way multithreading functions without indirection
+// - Helper functions for NUMA-aware sorting across nodes without indirection
 // - Helper functions for merging the halves from multithreading inputs with indirection
 // - Up to 4-way multithreading functions with indirection
 // - Helper functions for merging the thirds from multithreading inputs with indirection
 // - Up to 6-way multithreading functions with indirection
+// - Helper functions for merge-path merging from multithreading inputs with indirection
+// - Helper functions for the sample sort multithreading strategy with indirection
+// - Helper functions for more than 18-way multithreading with indirection
 // - Up to 8-way multithreading functions with indirection
 // - Up to 16-way multithreading functions with indirection
+// - Helper functions for the streaming sort builder
+// - Helper functions for presortedness detection
+// - Helper functions for merging a batch into sorted items
+// - Helper functions for sorting keys with a separate payload array
+// - Helper functions for applying a permutation to columns
+// - Helper functions for partial sorting
+// - Helper functions for selecting items by their rank
+// - Helper functions for counting the digits of all sorting passes
+// - Helper functions for sorting with the removal of equal items
+// - Helper functions for grouping sorted items
+// - Helper functions for sorting variable-length strings
+// - Helper functions for sorting keys wider than 128 bits
+// - Helper functions for sorting by several keys
+// - Helper functions for external sorting of files
 // ### User-facing (inline) functions block (rsbd8 namespace):
 // - Generic large array allocation and deallocation functions
+// - Persistent thread pool functions
+// - NUMA topology functions
+// - Multithreading threshold profile functions
+// - Multithreading strategy functions
+// - Presortedness detection functions
 // - Wrapper template functions for the main sorting functions in this library
+// - Key and payload sorting functions
+// - Permutation functions
+// - Partial sorting functions
+// - Selection functions
+// - Histogram functions
+// - Sorting functions with the removal of equal items
+// - Grouping functions
+// - String sorting functions
+// - Wide key sorting functions
+// - Multi-key sorting functions
+// - Incremental merging functions
+// - Streaming sort builder functions
+// - External sorting functions
 // ### Ending:
 // - Library finalisation
 
@@ -114,10 +156,11 @@
 // Multithreading can be limited at compile-time by setting the macro RSBD8_THREAD_MAXIMUM to a set number of simultaneous threads, but this is only intended for debugging and temporary performance tuning.
 // The exclusive single-threaded mode for the entire library is enabled by setting the macro RSBD8_THREAD_MAXIMUM to 1.
 // There is no multithreading limit by default, but when multithreading is enabled, rsbd8::radixsort() and rsbd8::radixsortcopy() will query std::thread::hardware_concurrency() to set up that limit.
-// This library does not automatically cross a NUMA node boundary, and it is up to the user to set up the environment for that if desired.
-// This library does have merging functions to make processing across NUMA nodes feasible, but it is not implemented in the main sorting functions.
+// The regular sorting functions do not automatically cross a NUMA node boundary, and it is up to the user to set up the environment for that if desired.
+// Overloads of rsbd8::radixsort() and rsbd8::radixsortcopy() that take a NUMA topology split the sorting over the nodes and merge the results, see "NUMA matters".
 // Limits for multithreading based on the input count can be partially disabled at compile-time by setting the macro RSBD8_THREAD_MINIMUM to force using a minimum number of simultaneous threads if technically possible, but this is only intended for debugging and temporary performance tuning.
 // This is again not enabled by default. The much lower limits for allowing multithreading at runtime at the the absolute minimum input count for the implemented multithreading functions always apply.
+// The input count limits for multithreading can also be adjusted at run-time with a machine profile, which can be loaded at program startup by setting the macro RSBD8_THRESHOLD_PROFILE to its file name, see "Multithreading threshold matters".
 //
 // - bool succeeded{rsbd8::radixsort<&myclass::getterfunc>(count, inputarr, pagesizeoptional)};
 // - bool succeeded{rsbd8::radixsort<&myclass::member>(count, inputarr, pagesizeoptional)};
@@ -138,6 +181,8 @@
 // - rsbd8::allocatearray()
 // - rsbd8::deallocatearray()
 // - rsbd8::buffermemorywrapper
+// - rsbd8::sortworkspace
+// - rsbd8::numatopology
 
 // ## Examples of using the 4 templates with input from second-level indirection (automatically deduced template parameters are omitted here):
 // These have options for using a getter function, a member object pointer, or using a pointer to an array of pointers to the actual data.
@@ -180,7 +225,7 @@
 // ### radixsortnoalloc():
 // - counted (first parameter "count", the end of arrays are no inputs to these functions unlike some sorting functions)
 // - limits to a set number of threads (second parameter "allowedthreads", unless multithreading is disabled)
-// - uses a memory buffer of (allowedthreads - 1) * sizeof(std::future<void>) with natural alignment to store the multithreading futures (third parameter "pfuturesplaceholder", unless multithreading is disabled)
+// - uses a memory buffer of (allowedthreads - 1) * sizeof(rsbd8::helper::taskfuture<void>) with natural alignment to store the multithreading futures (third parameter "pfuturesplaceholder", unless multithreading is disabled)
 // - uses a memory buffer with cache line alignment to store the zeroed index counts, see rsbd8::allocatearray() for more information (fourth parameter "pzeroedindices")
 // - sorts an array (fifth parameter "inputarr")
 // - uses an array as a buffer of the same size and type (sixth parameter "bufferarr")
@@ -190,7 +235,7 @@
 // ### radixsortcopynoalloc():
 // - counted (first parameter "count")
 // - limits to a set number of threads (second parameter "allowedthreads", unless multithreading is disabled)
-// - uses a memory buffer of (allowedthreads - 1) * sizeof(std::future<void>) with natural alignment to store the multithreading futures (third parameter "pfuturesplaceholder", unless multithreading is disabled)
+// - uses a memory buffer of (allowedthreads - 1) * sizeof(rsbd8::helper::taskfuture<void>) with natural alignment to store the multithreading futures (third parameter "pfuturesplaceholder", unless multithreading is disabled)
 // - uses a memory buffer with cache line alignment to store the zeroed index counts, see rsbd8::allocatearray() for more information (fourth parameter "pzeroedindices")
 // - similar to radixsortnoalloc(), but will not write to the input array, which can be const-qualified (fourth parameter "inputarr")
 // - uses a dedicated output array of the same size and type (fifth parameter "outputarr")
@@ -200,11 +245,15 @@
 // - allocates memory for the temporary buffers and determines the amount of threads to use
 // - (Windows-only) large page size for VirtualAlloc() can be used if enabled with the lock memory privilege for the application enabled (optional third parameter)
 // - (POSIX implementing systems-only) flags for enabling pages with huge TLB functionality for mmap() can be used (optional third parameter)
+// - an overload takes a rsbd8::sortworkspace reference instead of the optional parameter above, to re-use the memory held by it between calls
+// - an overload takes a rsbd8::numatopology reference instead of the optional parameter above, to split the sorting over the NUMA nodes of the system (optional fourth or fifth parameter "ismovingpages" to move the pages of the input array to the nodes first)
 // ### radixsortcopy():
 // - wrapper template for radixsortcopynoalloc()
 // - allocates memory for the temporary buffers and determines the amount of threads to use
 // - (Windows-only) large page size for VirtualAlloc() can be used if enabled with the lock memory privilege for the application enabled (optional third parameter)
 // - (POSIX implementing systems-only) flags for enabling pages with huge TLB functionality for mmap() can be used (optional third parameter)
+// - an overload takes a rsbd8::sortworkspace reference instead of the optional parameter above, to re-use the memory held by it between calls
+// - an overload takes a rsbd8::numatopology reference instead of the optional parameter above, to split the sorting over the NUMA nodes of the system (optional fourth or fifth parameter "ismovingpages" to move the pages of the input array to the nodes first)
 
 // ## Modes of operation for the template functions
 namespace rsbd8{
@@ -273,6 +322,41 @@ enum struct sortingdirection : unsigned char{// 2 bits as bitfields
 // bool succeeded{rsbd8::radixsort<&myclass::keyorder, rsbd8::dscrevorder>(4, pcollA)};
 // Pointers will in this case point to: {2, "fourth"}, {1, "second"}, {1, "first"}, {-5, "third"}.
 // Notice the same reverse stable sorting here, but opposite placement when encountering the same value multiple times.
+// ### The four multithreading strategies are:
+enum struct multithreadingstrategy : unsigned char{// selected at run-time with rsbd8::setmultithreadingstrategy()
+	bidirectional = 0u,
+// - sort halves and thirds of the input with the bidirectional sorting functions, and merge these afterwards (default)
+	globalhistogram = 1u,
+// - sort the entire input in least significant digit order, with every thread scattering its own slice directly to the final positions of every sorting pass, so without a merging phase
+	msdthenlsd = 2u,
+// - partition the entire input on its most significant digit with all threads, and then sort the parts independently in least significant digit order, with every thread taking the next part when it is done
+	samplesort = 3u
+// - split the entire input into buckets by splitters from a sorted sample of the keys with all threads, and then sort every bucket with a single-threaded sorting function, directly to its final position
+// - (the last three are only used by the 8-way and wider functions for single-part types of up to 64 bits, with indirection only by the sample sort strategy and only for getter functions that cannot throw, the default strategy is used otherwise)
+};
+// ### The two options for keeping one of the equal items when removing them are:
+enum struct uniquekeep : unsigned char{// used by rsbd8::radixsortunique() and rsbd8::radixsortcopyunique()
+	first = 0u,
+// - keep the first of the equal items in the sorting order, which is the first one in the source unless the sorting direction reverses the order of equal items (default)
+	last = 1u
+// - keep the last of the equal items in the sorting order
+};
+// ### The three aggregates of the payloads of a group are:
+enum struct groupaggregate : unsigned char{// used by rsbd8::radixsortgroup() with payloads
+	sum = 0u,
+// - the sum of the payloads of the items with the same key (default)
+	minimum = 1u,
+// - the lowest of the payloads of the items with the same key
+	maximum = 2u
+// - the highest of the payloads of the items with the same key
+};
+// ### The two orders of the bytes of wide keys are:
+enum struct widekeyorder : unsigned char{// used by rsbd8::radixsortwide()
+	bytes = 0u,
+// - the first byte is the most significant one, like std::memcmp() orders these, for hashes and for composite keys that are stored with the most significant parts first in big-endian byte order (default)
+	words = 1u
+// - a little-endian multi-word unsigned integer of 64-bit words, the first word is the least significant one, and every word is in the native byte order
+};
 }// namespace rsbd8
 
 // ## Miscellaneous notes
@@ -298,6 +382,196 @@ enum struct sortingdirection : unsigned char{// 2 bits as bitfields
 // Floating-point NaN values are sorted before negative infinity for the typical machine-generated "undefined" QNaN (0xFFF8'0000'0000'0000 on an IEEE double).
 // Floating-point NaN positive values (implies not machine-generated) are sorted after positive infinity (0x7FF0'0000'0000'0001 and onward on an IEEE double).
 // Floating-point SNaN (signalling) values do not trigger signals inside these functions. This is similar to many other non-arithmetic functions in namespace std.
+// ### Multithreading matters
+// By default every multithreaded sorting function launches each of its companion tasks on a newly spawned thread, much like std::async() with std::launch::async does.
+// When sorting many moderately sized arrays (for example just above the 2- and 4-way multithreading thresholds) the thread creation and teardown costs can take a large share of the total time.
+// A persistent, elastic pool of worker threads can be set up to avoid that. All subsequent multithreaded sorting, including the rsbd8::radixsort() and rsbd8::radixsortcopy() wrapper functions, will then dispatch their tasks to it.
+// The companion tasks synchronise on spinlock barriers, so the pool never queues a task behind another one. A task is handed to an idle worker, or a new worker is spawned and kept for re-use.
+// The pool can be owned by the user, or the library-owned pool (constructed on first use with one worker less than the number of hardware threads) can be used.
+// The futures placeholder memory ("pfuturesplaceholder") holds rsbd8::helper::taskfuture<void> items in either case, and these still block on destruction until their task has completed.
+// More than 18 threads are used by splitting the input into a tree of halves and thirds, with a 4- or 6-way sorting function for every leaf part. With indirection, this requires a getter function (if any) that cannot throw.
+// The leaf parts are merged level by level, every node as soon as its parts are sorted, with all the threads of the leaf parts below that node.
+// The number of leaf parts is the largest number of the form 2^a * 3^b that fits in both the allowed threads and the input size divided by the 4-way multithreading threshold, so for example 32 threads are used as 8 times 4 threads and 96 threads as 16 times 6 threads.
+// This is only used if it puts more than 18 threads to work. Every merging level is one more full pass over the data, so the gains still taper off with the depth of the tree.
+// The final merge of the 8-, 12- and 18-way functions and of every node of this tree uses merge-path (co-ranking) partitioning: every thread searches for the starting points of its own, equal range of the output in the sorted parts, and merges that range independently.
+// The 2-, 4- and 6-way functions still merge with two threads, one from each end of the output, as these have no other idle threads to put to work.
+// The global histogram strategy can be selected at run-time for all sorting with 8 or more threads without indirection, and it then replaces both the fixed 8-, 12- and 18-way functions and the tree of leaf parts.
+// It sorts the entire input in least significant digit order: every thread counts the digits of its own slice of the array, the counts of all threads are combined into global offsets, and every thread then scatters its slice directly to the final positions of that sorting pass.
+// This removes the merging phase, at the cost of a counting pass over the data for every sorting pass but the first. Sorting passes in which all items have the same digit are skipped.
+// The MSD-then-LSD strategy can be selected in the same way. It partitions the input on its most significant digit with all threads first, in the same way as a sorting pass of the global histogram strategy.
+// The parts are then handed out to the threads one by one, and every part is sorted in least significant digit order by a single thread. A part that is too large for the data caches of a single core is partitioned on its next digit again first.
+// For large arrays this keeps most of the sorting passes in the data caches, so the main memory is only read and written a few times instead of once for every sorting pass. Inputs where most items share the same top digits are handled by fewer threads however.
+// The sample sort strategy can be selected in the same way, and it is also used with indirection. It splits the input into buckets of roughly equal size by splitters taken from a sorted sample of the keys, and all threads scatter their own slice of the input into these buckets.
+// Every bucket is then sorted by a single-threaded sorting function, directly to its final position in the output, so without a merging phase. Keys that are equal to a splitter get a bucket of their own that needs no sorting, which keeps skewed inputs balanced.
+// The memory for the index counts is sized for two single-threaded sorting functions per thread with 8 threads or more, so the buckets are sorted by all threads, and every one of these takes the next bucket as soon as it is done.
+// These three strategies only handle single-part types of up to 64 bits, so 80-bit-based long double types, 128-bit types and 64-bit types on 32-bit platforms are still sorted with the default strategy.
+// The "scaling" target in the multiplatform folder measures the speed-up from 1 thread up to the given number of threads on a single large uint64 sort (use 16384 MiB as input size for a 16 GiB sort). The optional fourth parameter selects the strategy, or "all" to compare the strategies at 8 threads and more.
+// - rsbd8::threadpool pool{prespawncountoptional};
+// - rsbd8::threadpool *previouspool{rsbd8::setthreadpool(&pool)};// a nullptr restores the default of spawning a new thread for every task
+// - rsbd8::threadpool *currentpool{rsbd8::getthreadpool()};
+// - rsbd8::setthreadpool(&rsbd8::defaultthreadpool());
+// - rsbd8::multithreadingstrategy previousstrategy{rsbd8::setmultithreadingstrategy(rsbd8::multithreadingstrategy::globalhistogram)};
+// - rsbd8::multithreadingstrategy currentstrategy{rsbd8::getmultithreadingstrategy()};
+// ### NUMA matters
+// On systems with multiple NUMA nodes, a large sort that runs on the processors of all nodes loses much of its memory bandwidth to remote memory traffic.
+// The overloads of rsbd8::radixsort() and rsbd8::radixsortcopy() (without indirection) that take a rsbd8::numatopology reference split the input into one part per node instead.
+// Every part is sorted by threads bound to the processors of its node, with index counts and buffer memory that is first written to by those threads, so most operating systems will place it node-locally.
+// The sorted parts are merged afterwards in a single pass with the merge-path functions, every node merges its own part of the output from the sorted parts of all nodes, with threads bound to its processors.
+// Any number of nodes up to 64 is used, so no node is left idle in either phase.
+// The input array itself is only moved to the nodes if the optional "ismovingpages" flag is set, which is mostly useful for the in-place radixsort() on an array that was filled by a single thread.
+// The regular functions are used for 8-bit types, for inputs that are not large enough to give every node at least a part that can use 2-way multithreading, and if the topology has less than 2 nodes.
+// The topology is detected from /sys/devices/system/node on Linux. Other platforms report no nodes, and then only virtual nodes can be used.
+// Virtual nodes split the processors that the process is allowed to run on evenly, which can be used for sub-NUMA clustering setups and for testing, but these cannot move pages.
+// Tasks launched by threads that are bound to a node always get a newly spawned thread (which inherits the binding), even if a thread pool is set.
+// - rsbd8::numatopology const &topology{rsbd8::systemnumatopology()};// detected on first use
+// - rsbd8::numatopology virtualtopology{virtualnodes};
+// - unsigned nodes{topology.nodecount()};// 0 if the topology is not available
+// - unsigned cpus{topology.cpucount(index)};
+// - bool succeeded{rsbd8::radixsort(count, inputarr, topology, ismovingpagesoptional)};
+// - bool succeeded{rsbd8::radixsortcopy(count, inputarr, outputarr, topology, ismovingpagesoptional)};
+// ### Multithreading threshold matters
+// The input counts at which the 2-, 4- and 8-way multithreading tiers start are compile-time defaults, measured on a single machine (see "Utilities to establish the tresholds for 2-, 4-, 6-, 8-, 12- and 18-way multithreading").
+// On other machines the real crossover points can be very different, so these can be replaced at run-time by the base counts of a machine profile.
+// A base count applies to one tier (2, 4 or 8 ways), direct or indirect sorting, and one type size in bits. It is given for unfiltered items in ascending, forward order, and the usual scaling for the other sorting modes and directions is applied on top of it.
+// The absolute minimum input counts for the implemented multithreading functions, and the factors of 3 and 9 between the 2-way threshold and the 4- and 8-way thresholds, still apply.
+// The calibration tool in the multiplatform folder (the "calibrate" target) measures the crossover points on the machine it runs on and writes a profile. Only the tiers for which enough hardware threads are available are measured.
+// A profile is a text file with one "ways direct|indirect typebits basecount" line per threshold, and all thresholds not in the profile keep using the compile-time defaults.
+// Define the macro RSBD8_THRESHOLD_PROFILE as the file name (a string literal) before including this library to load a profile at program startup.
+// - bool succeeded{rsbd8::loadthresholdprofile("rsbd8profile.txt")};
+// - bool succeeded{rsbd8::savethresholdprofile("rsbd8profile.txt")};
+// - bool succeeded{rsbd8::setmultithreadingthreshold(ways, isindirect, typebits, basecount)};// a base count of 0 restores the compile-time default
+// - std::size_t basecount{rsbd8::getmultithreadingthreshold(ways, isindirect, typebits)};// 0 if the compile-time default is in use
+// - rsbd8::resetmultithreadingthresholds();
+// ### Memory re-use matters
+// The rsbd8::radixsort() and rsbd8::radixsortcopy() wrapper functions allocate and deallocate their temporary memory on every call. For repeated sorting of moderately sized arrays these system calls (and the page faults on first touch of fresh memory) can take a large share of the total time.
+// A rsbd8::sortworkspace object holds that memory between calls instead. It only grows when a larger amount is required, and only the part of the index counts that was used before is zeroed again.
+// The memory layout of a workspace places the index counts first, followed by the futures placeholder and the buffer, each padded to full cache lines.
+// A workspace can be used by only one sorting function at a time, so use one workspace per thread for concurrent sorting. The memory is handed back to the system by release() or on destruction.
+// The large page size (Windows) or mmap() flags (POSIX implementing systems) are set once when constructing the workspace.
+// - rsbd8::sortworkspace workspace{pagesizeoptional};
+// - bool succeeded{rsbd8::radixsort(count, inputarr, workspace)};
+// - bool succeeded{rsbd8::radixsortcopy<&myclass::getterfunc>(count, inputarr, outputarr, workspace, getterparameters...)};
+// - std::size_t heldsize{workspace.size()};
+// - workspace.release();
+// ### Key and payload sorting matters
+// A common workload is sorting an array of keys (like 32-bit or 64-bit integers) together with a parallel array of row identifiers or other payloads. The indirection functions can do that with an array of pointers, but at a far higher cost than sorting the keys directly, and packing the keys and payloads into a structure first costs two more passes over the data.
+// The rsbd8::radixsort() and rsbd8::radixsortcopy() overloads with a keys array and a payloads array move the payload of every key along with it in every sorting pass. The payloads can be of any trivially copyable type. All sorting modes and directions work for keys of up to 64 bits, and equal keys keep their order like they do for the other sorting functions.
+// These sort in least significant digit order: the digits of all sorting passes are counted in one go, a sorting pass is skipped if all keys have the same digit in it, and the front half of every part is scattered forward while the back half is scattered backward. From the 2-way multithreading threshold of the sorting functions without indirection onwards, the input is split into parts for the allowed threads, and every part counts and scatters its own slice in every sorting pass, like the global histogram multithreading strategy does.
+// The output arrays of rsbd8::radixsortcopy() can be the input arrays. The buffer arrays and the index counts are allocated in one go, with the large page size (Windows) or mmap() flags (POSIX implementing systems) as the optional last parameter.
+// When only the sorted order is needed, rsbd8::argsort() writes the permutation that sorts the keys to an array of 32-bit or 64-bit indices (or any other unsigned integer type), and leaves the keys unchanged. It sorts copies of the keys together with the indices in the same way, and the first sorting pass generates the indices, so every sorting pass moves 8 to 16 bytes per item instead of following pointers. Use 32-bit indices for up to 4G items; false is returned if the index type cannot hold the positions of all items.
+// - bool succeeded{rsbd8::radixsort(count, keysarr, payloadsarr)};
+// - bool succeeded{rsbd8::radixsortcopy<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(count, keysarr, payloadsarr, outputkeysarr, outputpayloadsarr)};
+// - bool succeeded{rsbd8::argsort(count, keysarr, indicesarr)};// std::uint32_t or std::uint64_t indices
+// - bool succeeded{rsbd8::argsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(count, keysarr, indicesarr)};
+// ### Permutation matters
+// After sorting by a key, other columns of a table usually need to be reordered in the same way. rsbd8::applypermutation() takes the permutation as written by rsbd8::argsort() and reorders any number of columns of different (trivially copyable) types in place, one column at a time. Every column is gathered into a buffer that is sized for the widest column, and then copied back.
+// The gathering reads the indices and writes the output sequentially, which are prefetched by the regular stride, while the random reads of a column are prefetched a fixed number of items ahead. The output is split into parts of at least 32768 items for the allowed threads, as the gathering is limited by the memory bandwidth. rsbd8::gatherpermutation() gathers a single column into a separate output array, without a buffer.
+// The sorted keys themselves do not need to be gathered: rsbd8::argsortcopy() writes them to an output array (which can be the keys array) in the last sorting pass, together with the permutation.
+// - bool succeeded{rsbd8::argsortcopy(count, keysarr, indicesarr, sortedkeysarr)};
+// - bool succeeded{rsbd8::applypermutation(count, indicesarr, firstcolumnarr, secondcolumnarr, thirdcolumnarr)};// any number of columns
+// - rsbd8::gatherpermutation(count, indicesarr, columnarr, outputcolumnarr);
+// ### Partial sorting matters
+// ORDER BY ... LIMIT k style queries only need the first k items of the sorting order. rsbd8::radixsortpartial() moves these to the front of the array in sorted order, while the other items follow them in an unspecified order. It takes one pass over the data to count the most significant digit of every item, and another one to move the items of the buckets up to the one that holds the k-th item to the front, keeping their order. The other items cannot be among the first k items, and are not looked at again.
+// The next digits are only counted for the candidates in the bucket of the k-th item, until at most twice k items are retained, and only those are sorted by rsbd8::radixsort() afterwards. For a k that is much smaller than the count, this takes about as long as two passes over the data and the sorting of a tiny array. Equal items are never split up, so the first k items are the same as those of sorting the entire array with the same template parameters.
+// This is done for all types up to 64 bits, without indirection. The passes for selecting the items are single-threaded, the final sort uses the allowed threads as usual.
+// - bool succeeded{rsbd8::radixsortpartial(count, k, inputarr)};
+// - bool succeeded{rsbd8::radixsortpartial<rsbd8::sortingdirection::dscfwdorder>(count, k, inputarr)};// the largest k items
+// ### Selection matters
+// Medians, percentiles and other quantiles only need the items at a few ranks of the sorting order. rsbd8::radixselect() finds these without sorting or modifying the input array, for all types up to 64 bits in every sorting mode and direction. It counts the most significant digit of all items, after which only the candidates (the items with the same higher digits as the item of a rank) have their next digit counted, until the full key of every rank is known. The order of equal items then decides between candidates with the same key, so the result is always the item that sorting the array with the same template parameters would put at the rank.
+// The candidates are moved to a buffer as soon as they are at most half of the items, so for distinct keys usually only the first two passes go over the entire array. The counting is split over the allowed threads with the same threshold as the 2-way multithreading of the sorting functions. An array of ranks is handled in the same passes, which is cheaper than selecting every quantile separately.
+// - float median;
+// - bool succeeded{rsbd8::radixselect(count, inputarr, count >> 1, median)};
+// - std::size_t const ranks[3]{count / 100u, count >> 1, count * 99u / 100u};
+// - float percentiles[3];
+// - bool succeeded{rsbd8::radixselect(count, inputarr, 3u, ranks, percentiles)};
+// ### Histogram matters
+// Later processing stages often only need the distribution of the keys, to pre-size hash tables or to pick the splitters for partitioning. rsbd8::radixhistogram() counts the digits of all sorting passes in a single pass over the array, split over the allowed threads, without moving any items. The digits are those of the filtered keys of the sorting mode, in the order of the sorting direction. The counts array holds rsbd8::histogramlength<T> counts: a histogram of 2 to the power of rsbd8::histogramradix<T> counts for each of the rsbd8::histogramdigits<T> digits, starting at the least significant digit.
+// rsbd8::radixboundaries() takes these counts and finds the exact boundaries between parts with the same number of items in the sorting order, without moving the items. Boundary i is the item at rank count * (i + 1) / partcount, the first item of part i + 1. The histogram of the most significant digit replaces the first pass of rsbd8::radixselect(), so only the candidates of the boundaries are counted for the next digits.
+// - std::size_t counts[rsbd8::histogramlength<std::uint64_t>];
+// - rsbd8::radixhistogram(count, inputarr, counts);
+// - std::uint64_t splitters[15];
+// - bool succeeded{rsbd8::radixboundaries(count, inputarr, counts, 16u, splitters)};
+// ### Duplicate removal matters
+// Sorting is often only done to remove the duplicates afterwards, which takes another full pass over the sorted array. rsbd8::radixsortunique() and rsbd8::radixsortcopyunique() drop the equal items in the last sorting pass instead, and write the number of remaining items to the given count. In the last sorting pass the equal items end up next to each other in every bucket, as the lower digits are in order already, so every item is only compared to the last item in its bucket. The gaps that the dropped items leave at the end of the buckets are closed afterwards, which only moves the items behind the first gap.
+// Equal items are those that sort as equal, so this includes -0. and +0. with the floating-point modes, or a negative value and its positive counterpart with the regular absolute modes. The rsbd8::uniquekeep template parameter selects whether the first (default) or the last of the equal items in the sorting order is kept, and the sorting direction decides the order of equal items as usual. The digits of all sorting passes are counted in one go with the allowed threads, like rsbd8::radixhistogram() does, while the sorting passes themselves are single-threaded.
+// This is done for all types up to 64 bits, without indirection. Sorting keys together with a separate payload array (see above) is the way to keep other data of the remaining items.
+// - std::size_t uniquecount;
+// - bool succeeded{rsbd8::radixsortunique(count, inputarr, uniquecount)};
+// - bool succeeded{rsbd8::radixsortcopyunique<rsbd8::sortingdirection::ascfwdorder, rsbd8::sortingmode::native, rsbd8::uniquekeep::last>(count, inputarr, outputarr, uniquecount)};
+// ### Grouping matters
+// Aggregation queries sort the keys and then scan them for the distinct keys with the number of items of each, or with the sum, minimum or maximum of a payload column. rsbd8::radixsortgroup() does both: the keys (and payloads) are sorted into a buffer, after which the allowed threads each count the groups that start in their slice of the buffer, so the output positions of all slices are known, and then write these groups. A group that continues into the next slices is completed by the thread of the slice in which it starts, so the slices do not need to be merged afterwards.
+// The output arrays need room for the count in the worst case, and the number of groups is written to the given count. The groups are in the sorting order, with the first of the equal items in the sorting order as the key of a group. With payloads, the rsbd8::groupaggregate template parameter selects the sum (default), minimum or maximum, which is computed in the type of the output aggregates array, and the output counts array can be a nullptr if the numbers of items are not needed.
+// - std::size_t groupcount;
+// - bool succeeded{rsbd8::radixsortgroup(count, keysarr, outputkeysarr, outputcountsarr, groupcount)};
+// - bool succeeded{rsbd8::radixsortgroup(count, keysarr, payloadsarr, outputkeysarr, outputcountsarr, outputsumsarr, groupcount)};
+// - bool succeeded{rsbd8::radixsortgroup<rsbd8::sortingdirection::ascfwdorder, rsbd8::sortingmode::native, rsbd8::groupaggregate::maximum>(count, keysarr, payloadsarr, outputkeysarr, nullptr, outputmaximumsarr, groupcount)};
+// ### String sorting matters
+// All other sorting functions are limited to keys of a fixed size. rsbd8::radixsortstrings() sorts an array of std::string_view items of any length by their bytes as unsigned values, with a shorter string before the longer strings that start with it, like std::string_view::compare() orders these. Byte strings of a pointer and a length are sorted as std::string_view items with the same pointer and length, and the string data itself is never moved or modified.
+// This is a most significant digit first radix sort of one byte per sorting pass, with a bucket for the strings that end before the byte. The next 8 bytes of every string are cached as an integer next to it, so the string data is only read once every 8 sorting passes. Buckets of fewer than 32 strings are finished by insertion sort on the remaining bytes, and a bucket in which all strings have the same byte only goes to the next byte. The child buckets of a split are divided over the allowed threads in contiguous groups of about the same number of strings, while the first split is single-threaded. The largest child bucket is processed in a loop instead of recursively, so the recursion depth stays small for long common prefixes.
+// The sort is stable, and the sorting direction reverses the order of equal strings like it does with indirection.
+// - std::vector<std::string_view> urls;// filled elsewhere
+// - bool succeeded{rsbd8::radixsortstrings(urls.size(), urls.data())};
+// - bool succeeded{rsbd8::radixsortstrings<rsbd8::sortingdirection::dscfwdorder>(count, stringviewsarr)};
+// ### Wide key matters
+// All other sorting functions are limited to keys of up to 128 bits. rsbd8::radixsortwide() sorts keys of any wider trivially copyable class or union type, such as 256-bit hashes, pairs of UUIDs or composite keys of several fields. The rsbd8::widekeyorder template parameter selects whether the bytes of the keys are ordered like std::memcmp() orders these (default), or whether the keys are little-endian multi-word unsigned integers of 64-bit words in the native byte order.
+// This is a least significant digit first radix sort of one byte per sorting pass. The digits of all sorting passes are counted in one go, and a sorting pass is skipped if all keys have the same byte in it, so the constant bytes of composite keys and the zeroed upper words of multi-word integers cost nothing after the counting. The allowed threads each count and scatter their own slice of the array in every sorting pass, like the sorting of keys together with a separate payload array does (see above).
+// With indirection the array of pointers is sorted by the wide key of every item, with the same indirection template parameters and optional parameters as the other sorting functions with indirection, and only getter functions that cannot throw are supported. The key has to be a class or union type, so wrap an array of bytes in a std::array or a struct. The sort is then stable, and the sorting direction reverses the order of equal keys like it does with indirection.
+// - std::array<unsigned char, 32> digests[count];// SHA-256 digests, filled elsewhere
+// - bool succeeded{rsbd8::radixsortwide(count, digests)};
+// - bool succeeded{rsbd8::radixsortwide<rsbd8::sortingdirection::dscfwdorder, rsbd8::widekeyorder::words>(count, uint256arr)};
+// - bool succeeded{rsbd8::radixsortwide<&myclass::digest>(count, pointerarr)};
+// ### Multi-key matters
+// Sorting by several keys, like "ORDER BY a, b DESC, c" does, otherwise takes one stable sorting call per key, starting at the least significant key, which loads the pointers and the keys again for every call. rsbd8::radixsortmultikey() sorts an array of pointers to items by several keys in one call. Every key is a rsbd8::sortkey template parameter with a member object pointer or a getter function without parameters, and its own sorting direction and sorting mode, and the first key is the most significant one.
+// The keys of every item are filtered, inverted for the descending sorting direction, and written once to a single combined key with the most significant byte first. The combined keys are then sorted together with the pointers like rsbd8::radixsortwide() does, so there is one sequence of sorting passes over all keys, and a sorting pass is skipped if all items have the same byte in it, in any of the keys. The allowed threads combine the keys of their own slice of the array, and count and scatter that slice in every sorting pass.
+// Every key is an arithmetic or enumeration type of up to 64 bits, and only getter functions that cannot throw are supported. The sort is stable, only the ascending or descending part of the sorting direction of every key is used, and items of which all keys are equal keep their order.
+// - struct row{std::int32_t a; double b; std::uint16_t c;};
+// - row *rows[count];// filled elsewhere
+// - bool succeeded{rsbd8::radixsortmultikey<rsbd8::sortkey<&row::a>, rsbd8::sortkey<&row::b, rsbd8::sortingdirection::dscfwdorder>, rsbd8::sortkey<&row::c>>(count, rows)};
+// - bool succeeded{rsbd8::radixsortmultikey<rsbd8::sortkey<&myclass::getyear, rsbd8::sortingdirection::dscfwdorder>, rsbd8::sortkey<&myclass::getbalance, rsbd8::sortingdirection::ascfwdorder, rsbd8::sortingmode::nativeabs>>(count, pointerarr)};
+// ### Presortedness detection matters
+// Input that is already sorted, in reverse order, or made of just a few sorted runs (like time-ordered logs with some late arrivals) still goes through every sorting pass that is not skipped. With rsbd8::setpresortednessdetection(true) the multi-part radixsortnoalloc() and radixsortcopynoalloc() functions without indirection (and all functions using these) first scan the filtered keys for runs in the sorting order, so every sorting mode and direction is respected.
+// Input that is in the sorting order is then left as it is (or only copied to the output), input that is in the reverse of it is reversed with all allowed threads, and input of a few runs is merged up to three runs at a time by the merge-path merging functions. The number of runs that is merged is limited so that the merging takes no more than half as many passes over the data as sorting: 3 runs for 16-bit types, 9 for 32-bit types and 81 for 64-bit types.
+// Equal items keep their order in runs, unless the sorting direction reverses their order, so the results are the same as those of the regular sorting. The scan stops as soon as there are too many runs, so it costs just a few items for random input. It does cost a full pass over the data for input that only turns out to have too many runs near its end, which is why it is disabled by default.
+// The detection is done for the same types as the global histogram multithreading strategy: single-part types of more than 8 bits and up to 64 bits (so not on 32-bit platforms). The setting applies to all threads, like the multithreading strategy.
+// - bool waspreviouslyenabled{rsbd8::setpresortednessdetection(true)};
+// - bool isenabled{rsbd8::getpresortednessdetection()};
+// ### Incremental merging matters
+// When a large sorted array regularly receives a small batch of new items, sorting the entire array again is wasteful. rsbd8::radixsortmerge() takes an array of which the first part is already sorted with the same template parameters, and of which the batch of new items makes up the rest. Only the batch is sorted, and then both parts are merged into the buffer with the merge-path merging functions, with all allowed threads. This works for all sorting modes and directions, and both without and with indirection.
+// Equal items are ordered as if all items were sorted at once, so the sorted items go before equal items of the batch, unless the sorting direction reverses the order of equal items (in which case the batch items go first).
+// The buffer holds all items, and the merged items are copied back to the input array afterwards. With rsbd8::radixsortmergenoalloc() the buffer can be kept between batches, and with movetobuffer set the copy back is skipped, so the input and buffer arrays can simply swap roles for the next batch. The memory for the indices and futures only has to be sized for the batch count then.
+// - bool succeeded{rsbd8::radixsortmerge(sortedcount, batchcount, inputarr)};// the batch directly follows the sorted items
+// - bool succeeded{rsbd8::radixsortmerge<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(sortedcount, batchcount, inputarr)};
+// - bool succeeded{rsbd8::radixsortmerge<&myclass::member>(sortedcount, batchcount, pointerarr)};
+// - rsbd8::radixsortmergenoalloc(sortedcount, batchcount, allowedthreads, pfuturesplaceholder, pzeroedindices, inputarr, bufferarr, movetobuffer);
+// - rsbd8::radixsortmergenoalloc<&myclass::member>(sortedcount, batchcount, allowedthreads, pfuturesplaceholder, pzeroedindices, pointerarr, bufferarr, movetobuffer, getterparameters...);
+// ### Streaming sort builder matters
+// When the items arrive in chunks over some time before they are sorted, a rsbd8::sortbuilder object can collect them. Every appended chunk is copied into the memory held by the builder, and its digits are counted right away, while the chunk is still in the data cache.
+// When finalise() is called, the counting pass over the data is already done, so only the offsets and the sorting passes remain, and that takes one full pass over the data off the critical path. The sorting passes alternate between the items and a buffer of the same size, so finalise() returns a pointer to the array that holds the sorted items.
+// The memory grows as needed while appending, which copies the items that were appended so far, so reserve the expected total count beforehand if it is known. The builder has to be cleared before it can be used again, which keeps the memory.
+// The digits are counted while appending for the same types as the global histogram multithreading strategy: single-part types of more than 8 bits and up to 64 bits (so not on 32-bit platforms). Other types are sorted by radixsortnoalloc() when finalising. The sorting passes run in the thread that calls finalise().
+// - rsbd8::sortbuilder<std::uint64_t> builder;
+// - bool succeeded{builder.reserve(expectedcountoptional)};
+// - bool succeeded{builder.append(chunkarr, chunkcount)};// repeated for every chunk as it arrives
+// - std::uint64_t *sortedarr{builder.finalise()};// builder.size() items
+// - builder.clear();
+// - rsbd8::sortbuilder<float, rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs> anotherbuilder;
+
+// ### External sorting matters
+// Files that are much larger than the main memory can be sorted with rsbd8::radixsortfile(), for binary files of fixed-size items (of up to 64 bits) in the native byte order of the machine.
+// The input is read in chunks that fit a quarter of the memory budget each, and every chunk is sorted with radixsortnoalloc() and written to a temporary run file. These runs are then merged into the output file with a k-way merge on the filtered keys.
+// All file reads and writes are asynchronous and double-buffered: the next chunk is read and the previous run is written while a chunk is sorted, and every run and the output have two blocks in the merging phase, one that is being processed and one that is being read or written.
+// The merging is stable, as ties are broken by the order of the runs, so all sorting modes and directions give the same results as sorting the entire file in memory.
+// At most 128 runs are merged at once, and fewer if the memory budget does not allow blocks of at least 1 MiB. More runs than that are merged in consecutive groups first, which costs one more pass over the data on the disk for every level.
+// The run files are created in the given temporary directory, or next to the output file otherwise, so these need space on the disk for the size of the input file. The input file can also be the output file.
+// The file functions of the C library are used on all platforms. Asynchronous I/O interfaces of the operating system (like io_uring on Linux) are not used, as the reads and writes are large and sequential, so these would add little over the I/O tasks that run alongside the sorting.
+// The "externalsort" target in the multiplatform folder measures sorting a file of random uint64 items, for example 16384 MiB with a 4096 MiB memory budget.
+// - bool succeeded{rsbd8::radixsortfile<std::uint64_t>(inputfilename, outputfilename, memorybudget, temporarydirectoryoptional)};
+// - bool succeeded{rsbd8::radixsortfile<double, rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(inputfilename, outputfilename, memorybudget)};
+// Files that do fit in the main memory can be sorted in place with rsbd8::radixsortmappedfile() instead, which maps the file into memory (mmap() on POSIX implementing systems, MapViewOfFile() on Windows) and sorts the mapping directly, so the file is not copied into and out of a separate array.
+// The system is hinted to read the entire file ahead before sorting (posix_madvise() with POSIX_MADV_WILLNEED, or PrefetchVirtualMemory() on Windows 8 and later), as the sorting passes go over the array in both directions. Sequential access hints are not given, as these would make the system drop the pages behind the forward direction, which are used again right away by the backward direction.
+// The buffer for sorting is regular memory from allocatearray() by default. If a temporary directory is given, the buffer is a mapped temporary file in that directory instead, so the system can page out both the file and the buffer when the main memory is tight. Platforms without file mapping functions read the file into memory and write it back afterwards.
+// - bool succeeded{rsbd8::radixsortmappedfile<std::uint64_t>(filename)};
+// - bool succeeded{rsbd8::radixsortmappedfile<float, rsbd8::sortingdirection::dscfwdorder>(filename, temporarydirectory)};
 
 // ## Naming and tooling conventions used in this library
 // ### Textual:
@@ -333,7 +607,7 @@ enum struct sortingdirection : unsigned char{// 2 bits as bitfields
 // ## Notes on ongoing research and development
 //
 // ### TODO, add support for types larger than 128 bits
-// - TODO, currently all functions here are guarded with an upper limit of 8-, 64-, 80-, 96- or 128-bit (using std::enable_if sections). Future functionality will either require lifting the limits on current functions, or adding another set of functions for the larger data types. Given that radix sort variants excel at processing large data types compared to comparison-based sorting methods, do give this some priority in development.
+// - TODO, currently all functions here except for rsbd8::radixsortwide() are guarded with an upper limit of 8-, 64-, 80-, 96- or 128-bit (using std::enable_if sections). rsbd8::radixsortwide() is the start of another set of functions for the larger data types, but it only sorts the keys themselves or pointers to items with the keys, without the other sorting modes, the copy and payload variants or the 2-way to 16-way bidirectional sorting functions. Given that radix sort variants excel at processing large data types compared to comparison-based sorting methods, do give this some priority in development.
 //
 // ### TODO, document computer system architecture-dependent code parts and add more options
 // - TODO, add support for native 128-bit for architectures that support these. (meaning: a system with 128 bits in single general-purpose registers)
@@ -569,18 +843,36 @@ enum struct sortingdirection : unsigned char{// 2 bits as bitfields
 #include <cassert>
 #include <climits>
 #include <cfloat>
-#include <cstring>// for std::memcpy(), std::memset() and the like, this library doesn't use actual string functions
+#include <cstdio>// for std::fopen() and the like, only used for the threshold profile files
+#include <cstring>// for std::memcpy(), std::memset() and the like, the only actual string function used is std::strcmp() for the threshold profile files
 #include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <tuple>
 #include <atomic>
 #include <array>
 #include <exception>
 #include <memory>
 #include <new>
+#include <algorithm>// for std::sort(), only used for the samples of the sample sort multithreading strategy
+#include <string_view>// only used for the variable-length string sorting functions
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 #include <Windows.h>
 #elif defined(_POSIX_C_SOURCE)
 #include <sys/types.h>
 #include <sys/mman.h>
+#include <sys/stat.h>// for fstat(), only used for the memory-mapped file sorting functions
+#include <fcntl.h>// for open(), only used for the memory-mapped file sorting functions
+#include <stdlib.h>// for mkstemp(), only used for the memory-mapped file sorting functions
+#include <unistd.h>
+#ifdef __linux__// only used for the NUMA topology, thread binding and page placement functions
+#include <sched.h>
+#include <sys/syscall.h>
+#if __has_include(<linux/mempolicy.h>)
+#include <linux/mempolicy.h>
+#endif
+#endif
 #endif
 #if CHAR_BIT & 8 - 1
 #error This platform has an addressable unit that isn't divisible by 8. For these kinds of platforms it's better to re-write this library and not use an 8-bit indexed radix sort method.
@@ -1021,6 +1313,365 @@ struct atomicvarwrapper{
 	}
 };
 
+// this class template is the handle to a task started by launchasync(), either on a persistent thread pool or on a newly spawned thread
+// it mirrors the std::future behaviour of std::async() tasks: the destructor and the move assignment block until the task has completed, which the multithreading functions in this library depend on
+// a task result is destroyed by the thread that waits for it, so a taskfuture<taskfuture<void>> blocks until both tasks have completed
+template<typename R>
+class taskfuture{
+	std::future<R> state;
+
+	RSBD8_FUNC_INLINE void release()noexcept{
+		if(state.valid()){
+			state.wait();
+			if constexpr(!std::is_void_v<R>){// destroy the result here, and not on the worker thread that releases the shared state last
+				try{
+					static_cast<void>(state.get());
+				}catch(...){}// swallow any exception, like the std::future destructor
+			}
+		}
+	}
+
+public:
+	// disable copy mechanisms
+	taskfuture(taskfuture const &) = delete;
+	taskfuture &operator=(taskfuture const &) = delete;
+	taskfuture()noexcept = default;
+	taskfuture(taskfuture &&other)noexcept = default;
+	RSBD8_FUNC_INLINE taskfuture(std::future<R> &&init)noexcept : state{std::move(init)}{}
+	RSBD8_FUNC_INLINE taskfuture &operator=(taskfuture &&other)noexcept{
+		release();
+		state = std::move(other.state);
+		return{*this};
+	}
+	RSBD8_FUNC_INLINE ~taskfuture()noexcept{
+		release();
+	}
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE bool valid()const noexcept{return{state.valid()};}
+	RSBD8_FUNC_INLINE void wait()const{state.wait();}
+	RSBD8_FUNC_INLINE R get(){return state.get();}// this will propagate any exception from the task
+};
+
+// this class is a persistent, elastic pool of worker threads
+// the companion threads of the multithreading functions in this library synchronise on spinlock barriers, so every launched task must get a thread of its own right away
+// tasks are handed to an idle worker if one is available, and otherwise a new worker is spawned and kept for re-use, so the pool grows to the largest number of simultaneous tasks ever requested
+// the pool must outlive all sorting functions that use it
+class threadpool{
+	struct tasknode{
+		tasknode *pnext;
+		virtual void run()noexcept = 0;// this will also delete the task node
+		virtual ~tasknode()noexcept = default;
+	};
+	template<typename F>
+	struct tasknodeimpl final : tasknode{
+		F function;
+		RSBD8_FUNC_INLINE tasknodeimpl(F &&init)noexcept : tasknode{}, function{std::move(init)}{}
+		RSBD8_FUNC_NORMAL void run()noexcept override{
+			function();
+			delete this;
+		}
+	};
+	struct workernode{
+		workernode *pnext;
+		std::thread thread;
+	};
+
+	std::mutex mutex;
+	std::condition_variable wakeup;
+	tasknode *pqueuefirst{};
+	tasknode *pqueuelast{};
+	workernode *pworkers{};
+	unsigned workercount{};
+	unsigned idlecount{};
+	unsigned queuedcount{};
+	bool stopping{};
+
+	RSBD8_FUNC_NORMAL void workerloop()noexcept{
+		std::unique_lock<std::mutex> lock{mutex};
+		for(;;){
+			while(!pqueuefirst){
+				if(stopping) return;
+				++idlecount;
+				wakeup.wait(lock);
+				--idlecount;
+			}
+			tasknode *ptask{pqueuefirst};
+			pqueuefirst = ptask->pnext;
+			if(!pqueuefirst) pqueuelast = nullptr;
+			--queuedcount;
+			lock.unlock();
+			ptask->run();
+			lock.lock();
+		}
+	}
+
+	// the caller has to hold the lock on the mutex
+	RSBD8_FUNC_NORMAL void spawnworker(){
+		workernode *pworker{new workernode{pworkers, {}}};
+		try{
+			pworker->thread = std::thread{&threadpool::workerloop, this};
+		}catch(...){
+			delete pworker;
+			throw;
+		}
+		pworkers = pworker;
+		++workercount;
+	}
+
+	// this will run all queued tasks to completion first
+	RSBD8_FUNC_NORMAL void stopworkers()noexcept{
+		{
+			std::lock_guard<std::mutex> lock{mutex};
+			stopping = true;
+		}
+		wakeup.notify_all();
+		workernode *pworker{pworkers};
+		pworkers = nullptr;
+		while(pworker){
+			pworker->thread.join();
+			workernode *pnext{pworker->pnext};
+			delete pworker;
+			pworker = pnext;
+		}
+	}
+
+	RSBD8_FUNC_NORMAL void enqueue(tasknode *ptask){
+		std::unique_lock<std::mutex> lock{mutex};
+		if(idlecount <= queuedcount){// all idle workers already have a task waiting for them
+			try{
+				spawnworker();
+			}catch(...){// do not leave the task behind with references to the stack frame of the caller
+				lock.unlock();
+				delete ptask;
+				throw;
+			}
+		}
+		ptask->pnext = nullptr;
+		if(pqueuelast) pqueuelast->pnext = ptask;
+		else pqueuefirst = ptask;
+		pqueuelast = ptask;
+		++queuedcount;
+		lock.unlock();
+		wakeup.notify_one();
+	}
+
+public:
+	// disable copy and move mechanisms
+	threadpool(threadpool const &) = delete;
+	threadpool &operator=(threadpool const &) = delete;
+	// optionally pre-spawn a number of workers, this can throw if creating a thread fails
+	RSBD8_FUNC_NORMAL threadpool(unsigned prespawncount = 0u){
+		std::unique_lock<std::mutex> lock{mutex};
+		try{
+			while(prespawncount--) spawnworker();
+		}catch(...){
+			lock.unlock();
+			stopworkers();
+			throw;
+		}
+	}
+	RSBD8_FUNC_NORMAL ~threadpool()noexcept{
+		stopworkers();
+	}
+
+	// the number of worker threads currently owned by the pool
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL unsigned size()noexcept{
+		std::lock_guard<std::mutex> lock{mutex};
+		return{workercount};
+	}
+
+	// similar to std::async() with std::launch::async, this can throw if allocating memory or creating a thread fails
+	template<typename F, typename... vararguments>
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<vararguments>...>> submit(F &&function, vararguments &&...varparameters){
+		using R = std::invoke_result_t<std::decay_t<F>, std::decay_t<vararguments>...>;
+		// copy the arguments like std::async() does, std::make_tuple() will unwrap any std::reference_wrapper item
+		std::packaged_task<R()> task{[function{std::decay_t<F>(std::forward<F>(function))}, parameters{std::make_tuple(std::forward<vararguments>(varparameters)...)}]()mutable->R{
+			return std::apply(std::move(function), std::move(parameters));
+		}};
+		std::future<R> result{task.get_future()};
+		enqueue(new tasknodeimpl<std::packaged_task<R()>>{std::move(task)});
+		return{std::move(result)};
+	}
+};
+
+// the thread pool used by launchasync(), set with rsbd8::setthreadpool()
+inline std::atomic<threadpool *> activethreadpool{};
+
+// the multithreading strategy of the 8-way and wider functions without indirection, set with rsbd8::setmultithreadingstrategy()
+inline std::atomic<multithreadingstrategy> activemultithreadingstrategy{};
+
+// the presortedness detection of the multi-part functions without indirection, set with rsbd8::setpresortednessdetection()
+inline std::atomic_bool activepresortednessdetection{};
+
+// set for the threads that the NUMA-aware sorting functions have bound to the processors of a node
+// the workers of a thread pool can run on any node, so tasks launched from these threads always get a newly spawned thread, which inherits the binding
+inline thread_local bool isnodeboundthread{};
+
+// launch a task asynchronously, on the active thread pool if one is set, or on a newly spawned thread otherwise
+// similar to std::async() with std::launch::async, this can throw if allocating memory or creating a thread fails
+template<typename F, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE taskfuture<std::invoke_result_t<std::decay_t<F>, std::decay_t<vararguments>...>> launchasync(F &&function, vararguments &&...varparameters){
+	if(isnodeboundthread)RSBD8_UNLIKELY{// pass the binding on to the new thread
+		// copy the arguments like std::async() does, std::make_tuple() will unwrap any std::reference_wrapper item
+		return{std::async(std::launch::async, [function{std::decay_t<F>(std::forward<F>(function))}, parameters{std::make_tuple(std::forward<vararguments>(varparameters)...)}]()mutable{
+			isnodeboundthread = true;
+			return std::apply(std::move(function), std::move(parameters));
+		})};
+	}
+	threadpool *ppool{activethreadpool.load(std::memory_order_acquire)};
+	if(ppool) return{ppool->submit(std::forward<F>(function), std::forward<vararguments>(varparameters)...)};
+	return{std::async(std::launch::async, std::forward<F>(function), std::forward<vararguments>(varparameters)...)};
+}
+
+// this class describes the NUMA nodes with processors that the process is allowed to run on
+// on Linux the topology is detected from /sys/devices/system/node, no nodes are reported on other platforms or if the detection fails
+// the processors can also be split into a number of virtual nodes, which is useful for sub-NUMA clustering setups and for testing
+class numatopology{
+public:
+	static unsigned constexpr nodemaximum{64u};// the maximum number of nodes that is used
+	static unsigned constexpr nodeidmaximum{1024u};// node identifiers of this value or larger are ignored
+
+private:
+#if defined(__linux__) && defined(CPU_SET)
+	cpu_set_t cpusets[nodemaximum];
+#endif
+	unsigned nodeids[nodemaximum];
+	unsigned cpucounts[nodemaximum];
+	unsigned nodes{};
+	bool isvirtual{};
+
+#if defined(__linux__) && defined(CPU_SET)
+	// read a list file from /sys, formatted like "0-7,16-23", and call the function for every item of it
+	template<typename F>
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL static bool readlist(char const *filename, F &&function)noexcept{
+		std::FILE *file{std::fopen(filename, "r")};
+		if(!file) return{false};
+		unsigned long first, last;
+		while(1 == std::fscanf(file, "%lu", &first)){
+			last = first;
+			int separator{std::fgetc(file)};
+			if('-' == separator){
+				if(1 != std::fscanf(file, "%lu", &last)) break;
+				separator = std::fgetc(file);
+			}
+			for(; last >= first; ++first) function(first);
+			if(',' != separator) break;
+		}
+		std::fclose(file);
+		return{true};
+	}
+#endif
+
+public:
+	// detect the topology of the system
+	RSBD8_FUNC_NORMAL numatopology()noexcept{
+#if defined(__linux__) && defined(CPU_SET)
+		cpu_set_t allowed;
+		if(sched_getaffinity(0, sizeof(allowed), &allowed))RSBD8_UNLIKELY return;
+		unsigned long onlinenodes[nodeidmaximum / (CHAR_BIT * sizeof(unsigned long))]{};
+		if(!readlist("/sys/devices/system/node/online", [&onlinenodes](unsigned long node)noexcept{
+			if(nodeidmaximum > node) onlinenodes[node / (CHAR_BIT * sizeof(unsigned long))] |= 1ul << node % (CHAR_BIT * sizeof(unsigned long));
+		}))RSBD8_UNLIKELY return;
+		for(unsigned node{}; nodeidmaximum > node && nodemaximum > nodes; ++node){
+			if(!(onlinenodes[node / (CHAR_BIT * sizeof(unsigned long))] >> node % (CHAR_BIT * sizeof(unsigned long)) & 1u)) continue;
+			char filename[64];
+			std::snprintf(filename, sizeof(filename), "/sys/devices/system/node/node%u/cpulist", node);
+			cpu_set_t &cpuset{cpusets[nodes]};
+			CPU_ZERO(&cpuset);
+			static_cast<void>(readlist(filename, [&cpuset, &allowed](unsigned long cpu)noexcept{
+				if(CPU_SETSIZE > cpu && CPU_ISSET(cpu, &allowed)) CPU_SET(cpu, &cpuset);
+			}));
+			unsigned cpus{static_cast<unsigned>(CPU_COUNT(&cpuset))};
+			if(cpus){// skip memory-only nodes, and nodes with only processors that the process is not allowed to run on
+				nodeids[nodes] = node;
+				cpucounts[nodes] = cpus;
+				++nodes;
+			}
+		}
+#endif
+	}
+
+	// split the processors that the process is allowed to run on evenly into a number of virtual nodes, regardless of the actual topology
+	// if there are fewer processors than virtual nodes, some nodes will share processors
+	RSBD8_FUNC_NORMAL explicit numatopology(unsigned virtualnodes)noexcept : isvirtual{true}{
+		nodes = (nodemaximum < virtualnodes)? nodemaximum : virtualnodes;
+#if defined(__linux__) && defined(CPU_SET)
+		cpu_set_t allowed;
+		if(sched_getaffinity(0, sizeof(allowed), &allowed))RSBD8_UNLIKELY{
+			nodes = 0u;
+			return;
+		}
+		unsigned allowedcount{static_cast<unsigned>(CPU_COUNT(&allowed))};
+#else
+		unsigned allowedcount{std::thread::hardware_concurrency()};
+		if(!allowedcount) allowedcount = 1u;
+#endif
+		for(unsigned node{}; nodes > node; ++node){
+			unsigned first{static_cast<unsigned>(static_cast<unsigned long long>(node) * allowedcount / nodes)};
+			unsigned last{static_cast<unsigned>(static_cast<unsigned long long>(node + 1u) * allowedcount / nodes)};
+			if(first == last) last = first + 1u;
+			nodeids[node] = node;
+			cpucounts[node] = last - first;
+#if defined(__linux__) && defined(CPU_SET)
+			cpu_set_t &cpuset{cpusets[node]};
+			CPU_ZERO(&cpuset);
+			for(unsigned cpu{}, index{}; CPU_SETSIZE > cpu; ++cpu) if(CPU_ISSET(cpu, &allowed)){
+				if(first <= index && last > index) CPU_SET(cpu, &cpuset);
+				++index;
+			}
+#endif
+		}
+	}
+
+	// the number of nodes with processors, 0 if the topology is not available
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE unsigned nodecount()const noexcept{return{nodes};}
+	// the system identifier of a node, or its sequence number for virtual nodes
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE unsigned nodeid(unsigned index)const noexcept{
+		assert(nodes > index);
+		return{nodeids[index]};
+	}
+	// the number of processors of a node that the process is allowed to run on
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE unsigned cpucount(unsigned index)const noexcept{
+		assert(nodes > index);
+		return{cpucounts[index]};
+	}
+
+	// bind the current thread to the processors of a node, false is returned if that is not supported
+	RSBD8_FUNC_NORMAL bool bindthread(unsigned index)const noexcept{
+		assert(nodes > index);
+#if defined(__linux__) && defined(CPU_SET)
+		return{!sched_setaffinity(0, sizeof(cpu_set_t), &cpusets[index])};
+#else
+		static_cast<void>(index);
+		return{false};
+#endif
+	}
+
+	// move the memory pages that are entirely inside of a memory range to a node, false is returned if that is not supported
+	// this is not supported for virtual nodes, and it is only useful for memory that was already written to, as other pages are placed on first use
+	RSBD8_FUNC_NORMAL bool movepages(void const *address, std::size_t size, unsigned index)const noexcept{
+		assert(nodes > index);
+#if defined(__linux__) && defined(CPU_SET) && defined(SYS_mbind) && defined(MPOL_PREFERRED) && defined(MPOL_MF_MOVE)
+		if(isvirtual) return{false};
+		long pagesize{sysconf(_SC_PAGESIZE)};
+		if(0 >= pagesize)RSBD8_UNLIKELY return{false};
+		std::uintptr_t first{(reinterpret_cast<std::uintptr_t>(address) + static_cast<std::uintptr_t>(pagesize) - 1u) & -static_cast<std::uintptr_t>(pagesize)};
+		std::uintptr_t last{(reinterpret_cast<std::uintptr_t>(address) + size) & -static_cast<std::uintptr_t>(pagesize)};
+		if(first >= last) return{true};// nothing to move
+		unsigned long nodemask[nodeidmaximum / (CHAR_BIT * sizeof(unsigned long))]{};
+		nodemask[nodeids[index] / (CHAR_BIT * sizeof(unsigned long))] = 1ul << nodeids[index] % (CHAR_BIT * sizeof(unsigned long));
+		// this sets a preferred policy for the range to move the pages, and then restores the default policy for it, the pages stay where they are moved to
+		bool succeeded{!syscall(SYS_mbind, first, last - first, MPOL_PREFERRED, nodemask, nodeidmaximum + 1ul, MPOL_MF_MOVE)};
+		static_cast<void>(syscall(SYS_mbind, first, last - first, MPOL_DEFAULT, nullptr, 0ul, 0u));
+		return{succeeded};
+#else
+		static_cast<void>(address);
+		static_cast<void>(size);
+		static_cast<void>(index);
+		return{false};
+#endif
+	}
+};
+
 // Utilities for general purpose register count compile-time detection
 
 // this is a generalisation of the purpose register count per architecture
@@ -11348,7 +11999,7 @@ template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T, typename
 struct autoaccumulateoffsetsarrays{
 	offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> const *RSBD8_RESTRICT paddends;
 	offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT paccumulator;
-	std::future<void> *RSBD8_RESTRICT pfutures;// this class expects these to be constructed by placement new
+	taskfuture<void> *RSBD8_RESTRICT pfutures;// this class expects these to be constructed by placement new
 	unsigned num;
 
 	// use with caution, as the only function of this class is the destructor
@@ -11363,7 +12014,7 @@ nextprimary:
 					try{
 						do RSBD8_LIKELY{
 							++pfutures;
-							pfutures[-1].~future();
+							pfutures[-1].~taskfuture();
 						}while(--i);
 					}catch(...){// swallow any exception
 						goto nextprimary;
@@ -11372,14 +12023,14 @@ nextprimary:
 					try{
 							do RSBD8_LIKELY{
 							++pfutures;
-							pfutures[-1].~future();
+							pfutures[-1].~taskfuture();
 						}while(--i);
 					}catch(...){// if an exception is thrown, we still need to destroy the items under pfutures safely, this will block until all tasks are completed
 nextsecondary:
 						try{
 							do RSBD8_LIKELY{
 								++pfutures;
-								pfutures[-1].~future();
+								pfutures[-1].~taskfuture();
 							}while(--i);
 						}catch(...){// swallow any secondary exception
 							goto nextsecondary;
@@ -11393,7 +12044,7 @@ nextsecondary:
 			// if more fine-tuning is required, manually vectorising this part shoud be easy for target architectures
 			if constexpr(defaultgprfilesize < gprfilesize::medium){// architecture: limit to one at a time when there's very few registers
 				do RSBD8_LIKELY{
-					if constexpr(isnoexcept) pfutures[0].~future();
+					if constexpr(isnoexcept) pfutures[0].~taskfuture();
 					auto const *RSBD8_RESTRICT p0{paddends[0].data()};
 					for(auto &RSBD8_RESTRICT elem : *paccumulator)RSBD8_LIKELY{
 						auto aa{elem};
@@ -11407,9 +12058,9 @@ nextsecondary:
 				if(3u <= num)RSBD8_UNLIKELY{
 					do RSBD8_LIKELY{
 						if constexpr(isnoexcept){
-							pfutures[0].~future();
-							pfutures[1].~future();
-							pfutures[2].~future();
+							pfutures[0].~taskfuture();
+							pfutures[1].~taskfuture();
+							pfutures[2].~taskfuture();
 						}
 						auto const *RSBD8_RESTRICT p0{paddends[0].data()};
 						auto const *RSBD8_RESTRICT p1{paddends[1].data()};
@@ -11428,11 +12079,11 @@ nextsecondary:
 					}while(3u <= num);
 					if(!num) return;
 				}
-				if constexpr(isnoexcept) pfutures[0].~future();// the first item is guaranteed here
+				if constexpr(isnoexcept) pfutures[0].~taskfuture();// the first item is guaranteed here
 				switch(num){
 				case 2u:
 					{
-						if constexpr(isnoexcept) pfutures[1].~future();
+						if constexpr(isnoexcept) pfutures[1].~taskfuture();
 						auto const *RSBD8_RESTRICT p0{paddends[0].data()};
 						auto const *RSBD8_RESTRICT p1{paddends[1].data()};
 						for(auto &RSBD8_RESTRICT elem : *paccumulator)RSBD8_LIKELY{
@@ -11458,13 +12109,13 @@ nextsecondary:
 				if(7u <= num)RSBD8_UNLIKELY{
 					do RSBD8_LIKELY{
 						if constexpr(isnoexcept){
-							pfutures[0].~future();
-							pfutures[1].~future();
-							pfutures[2].~future();
-							pfutures[3].~future();
-							pfutures[4].~future();
-							pfutures[5].~future();
-							pfutures[6].~future();
+							pfutures[0].~taskfuture();
+							pfutures[1].~taskfuture();
+							pfutures[2].~taskfuture();
+							pfutures[3].~taskfuture();
+							pfutures[4].~taskfuture();
+							pfutures[5].~taskfuture();
+							pfutures[6].~taskfuture();
 						}
 						auto const *RSBD8_RESTRICT p0{paddends[0].data()};
 						auto const *RSBD8_RESTRICT p1{paddends[1].data()};
@@ -11493,16 +12144,16 @@ nextsecondary:
 					}while(7u <= num);
 					if(!num) return;
 				}
-				if constexpr(isnoexcept) pfutures[0].~future();// the first item is guaranteed here
+				if constexpr(isnoexcept) pfutures[0].~taskfuture();// the first item is guaranteed here
 				switch(num){
 				case 6u:
 					{
 						if constexpr(isnoexcept){
-							pfutures[1].~future();
-							pfutures[2].~future();
-							pfutures[3].~future();
-							pfutures[4].~future();
-							pfutures[5].~future();
+							pfutures[1].~taskfuture();
+							pfutures[2].~taskfuture();
+							pfutures[3].~taskfuture();
+							pfutures[4].~taskfuture();
+							pfutures[5].~taskfuture();
 						}
 						auto const *RSBD8_RESTRICT p0{paddends[0].data()};
 						auto const *RSBD8_RESTRICT p1{paddends[1].data()};
@@ -11527,10 +12178,10 @@ nextsecondary:
 				case 5u:
 					{
 						if constexpr(isnoexcept){
-							pfutures[1].~future();
-							pfutures[2].~future();
-							pfutures[3].~future();
-							pfutures[4].~future();
+							pfutures[1].~taskfuture();
+							pfutures[2].~taskfuture();
+							pfutures[3].~taskfuture();
+							pfutures[4].~taskfuture();
 						}
 						auto const *RSBD8_RESTRICT p0{paddends[0].data()};
 						auto const *RSBD8_RESTRICT p1{paddends[1].data()};
@@ -11553,9 +12204,9 @@ nextsecondary:
 				case 4u:
 					{
 						if constexpr(isnoexcept){
-							pfutures[1].~future();
-							pfutures[2].~future();
-							pfutures[3].~future();
+							pfutures[1].~taskfuture();
+							pfutures[2].~taskfuture();
+							pfutures[3].~taskfuture();
 						}
 						auto const *RSBD8_RESTRICT p0{paddends[0].data()};
 						auto const *RSBD8_RESTRICT p1{paddends[1].data()};
@@ -11575,8 +12226,8 @@ nextsecondary:
 				case 3u:
 					{
 						if constexpr(isnoexcept){
-							pfutures[1].~future();
-							pfutures[2].~future();
+							pfutures[1].~taskfuture();
+							pfutures[2].~taskfuture();
 						}
 						auto const *RSBD8_RESTRICT p0{paddends[0].data()};
 						auto const *RSBD8_RESTRICT p1{paddends[1].data()};
@@ -11593,7 +12244,7 @@ nextsecondary:
 					break;
 				case 2u:
 					{
-						if constexpr(isnoexcept) pfutures[1].~future();
+						if constexpr(isnoexcept) pfutures[1].~taskfuture();
 						auto const *RSBD8_RESTRICT p0{paddends[0].data()};
 						auto const *RSBD8_RESTRICT p1{paddends[1].data()};
 						for(auto &RSBD8_RESTRICT elem : *paccumulator)RSBD8_LIKELY{
@@ -12947,6 +13598,33 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 
 // Utilities to establish the tresholds for 2-, 4-, 6-, 8-, 12- and 18-way multithreading
 
+// the run-time adjustable base counts for the multithreading thresholds, set by a machine profile
+// indexed by the tier (2-, 4- and 8-way), indirection and the type size in bytes minus one, and given as a count of unfiltered items in ascending, forward order
+// a 0 selects the compile-time default, atomic access allows adjusting these while other threads are sorting
+inline std::atomic_size_t profiledthresholds[3][2][16]{};
+
+// function to scale the thresholds for the filtering modes and the sorting direction, relative to unfiltered items in ascending, forward order
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr double thresholdmodefactor()noexcept{
+	return{1.
+		// the first item is measured and tuned using the the test suite for this project
+		* ((isabsvalue != isfltpmode)? 1. - 4. / static_cast<double>(typebitsize<T>) : 1.)// 4 modes with around three extra filtering steps per input value
+		// the second item is extrapolated from the first item, and is a decent estimate
+		* ((isabsvalue && isfltpmode)? 1. - 3. / static_cast<double>(typebitsize<T>) : 1.)// 2 modes with one extra filtering step per input value
+		// the third item is a rough estimate of the extra work required, which will be less than the previous two items, just keep the using the same method of extrapolation for simplicity
+		* (isrevorder? 1. - 2. / static_cast<double>(typebitsize<T>) : 1.)// reverse ordering requires more memory displacing work in the initial sorting phase
+		// the fourth item is a rough estimate of the little extra work required, which will be less than the previous three items, just keep the using the same method of extrapolation for simplicity
+		* (isdescsort? 1. - 1. / static_cast<double>(typebitsize<T>) : 1.)// descending sort requires slightly more processing work in the intermediate sorting phase
+	};
+}
+
+// function to establish the absolute minimum input count for the implemented multithreading functions
+template<typename T, bool isindirect>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr std::size_t thresholdminimum()noexcept{
+	// with very low counts, do not allow multithreading unless the prefetch stride can be guaranteed
+	return{std::max(static_cast<std::size_t>(1u) << 8, prefetchmaxstride / (isindirect? sizeof(void *) : sizeof(T)))};
+}
+
 // function to establish the initial treshold for 2-way multithreading
 // this is the only version that allows 8-bit inputs
 template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, bool isindirect>
@@ -13010,14 +13688,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr std::enable_if_t<
 	};
 	static double constexpr base{// interpolated power scaling using regression (by means of a lookup table)
 		(isindirect? lookupindirect : lookupdirect)[(typebitsize<T> >> 3) - 1u]
-		// the first item is measured and tuned using the the test suite for this project
-		* ((isabsvalue != isfltpmode)? 1. - 4. / static_cast<double>(typebitsize<T>) : 1.)// 4 modes with around three extra filtering steps per input value
-		// the second item is extrapolated from the first item, and is a decent estimate
-		* ((isabsvalue && isfltpmode)? 1. - 3. / static_cast<double>(typebitsize<T>) : 1.)// 2 modes with one extra filtering step per input value
-		// the third item is a rough estimate of the extra work required, which will be less than the previous two items, just keep the using the same method of extrapolation for simplicity
-		* (isrevorder? 1. - 2. / static_cast<double>(typebitsize<T>) : 1.)// reverse ordering requires more memory displacing work in the initial sorting phase
-		// the fourth item is a rough estimate of the little extra work required, which will be less than the previous three items, just keep the using the same method of extrapolation for simplicity
-		* (isdescsort? 1. - 1. / static_cast<double>(typebitsize<T>) : 1.)// descending sort requires slightly more processing work in the intermediate sorting phase
+		* thresholdmodefactor<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>()
 	};
 	// apply clamping and rounding typecast
 	// very inefficient rounding on a truncation cast, as the std namespace rounding typecast functions do not grant constexpr
@@ -13028,8 +13699,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr std::enable_if_t<
 		static_cast<std::size_t>(static_cast<std::ptrdiff_t>(std::min(intermediate, static_cast<double>(PTRDIFF_MAX)))) - static_cast<std::size_t>(PTRDIFF_MIN)
 #endif
 	};
-	// with very low counts, do not allow multithreading unless the prefetch stride can be guaranteed
-	return{std::max(intermediatefiltered, std::max(static_cast<std::size_t>(1u) << 8, prefetchmaxstride / (isindirect? sizeof(void *) : sizeof(T))))};
+	return{std::max(intermediatefiltered, thresholdminimum<T, isindirect>())};
 }
 
 // function to establish the initial treshold for 4 and 6-way multithreading
@@ -13087,14 +13757,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr std::enable_if_t<
 	};
 	static double constexpr base{// interpolated quartic polynomial scaling using regression (by means of a lookup table)
 		(isindirect? lookupindirect : lookupdirect)[(typebitsize<T> >> 3) - 2u]// 8-bit items are not allowed, so the lookup table is offset by one
-		// the first item is measured and tuned using the the test suite for this project
-		* ((isabsvalue != isfltpmode)? 1. - 4. / static_cast<double>(typebitsize<T>) : 1.)// 4 modes with around three extra filtering steps per input value
-		// the second item is extrapolated from the first item, and is a decent estimate
-		* ((isabsvalue && isfltpmode)? 1. - 3. / static_cast<double>(typebitsize<T>) : 1.)// 2 modes with one extra filtering step per input value
-		// the third item is a rough estimate of the extra work required, which will be less than the previous two items, just keep the using the same method of extrapolation for simplicity
-		* (isrevorder? 1. - 2. / static_cast<double>(typebitsize<T>) : 1.)// reverse ordering requires more memory displacing work in the initial sorting phase
-		// the fourth item is a rough estimate of the little extra work required, which will be less than the previous three items, just keep the using the same method of extrapolation for simplicity
-		* (isdescsort? 1. - 1. / static_cast<double>(typebitsize<T>) : 1.)// descending sort requires slightly more processing work in the intermediate sorting phase
+		* thresholdmodefactor<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>()
 	};
 	// apply clamping and rounding typecast
 	// very inefficient rounding on a truncation cast, as the std namespace rounding typecast functions do not grant constexpr
@@ -13128,14 +13791,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr std::enable_if_t<
 	static double constexpr base{// inverse cubic exponential scaling
 		0x5p48 / static_cast<double>(typebitsize<T> * typebitsize<T> * typebitsize<T>)
 		* (isindirect? 1. + 1048576. / static_cast<double>(typebitsize<T> * typebitsize<T> * typebitsize<T> * typebitsize<T>) : 1.)// scale up for indirection
-		// the first item is measured and tuned using the the test suite for this project
-		* ((isabsvalue != isfltpmode)? 1. - 4. / static_cast<double>(typebitsize<T>) : 1.)// 4 modes with around three extra filtering steps per input value
-		// the second item is extrapolated from the first item, and is a decent estimate
-		* ((isabsvalue && isfltpmode)? 1. - 3. / static_cast<double>(typebitsize<T>) : 1.)// 2 modes with one extra filtering step per input value
-		// the third item is a rough estimate of the extra work required, which will be less than the previous two items, just keep the using the same method of extrapolation for simplicity
-		* (isrevorder? 1. - 2. / static_cast<double>(typebitsize<T>) : 1.)// reverse ordering requires more memory displacing work in the initial sorting phase
-		// the fourth item is a rough estimate of the little extra work required, which will be less than the previous three items, just keep the using the same method of extrapolation for simplicity
-		* (isdescsort? 1. - 1. / static_cast<double>(typebitsize<T>) : 1.)// descending sort requires slightly more processing work in the intermediate sorting phase
+		* thresholdmodefactor<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>()
 	};
 	// apply clamping and rounding typecast
 	// very inefficient rounding on a truncation cast, as the std namespace rounding typecast functions do not grant constexpr
@@ -13151,6 +13807,73 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr std::enable_if_t<
 	return{std::max(intermediatefiltered, 9u * base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, isindirect>())};
 }
 
+// Run-time adjustable tresholds for 2-, 4-, 6-, 8-, 12- and 18-way multithreading
+
+// function to apply the scaling for the filtering modes and the sorting direction to a profiled base count, saturating
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::size_t scaleprofiledthreshold(std::size_t profiled, double factor)noexcept{
+	double scaled{static_cast<double>(profiled) * factor + .5};
+	return{(static_cast<double>(SIZE_MAX) <= scaled)? SIZE_MAX : static_cast<std::size_t>(scaled)};
+}
+
+// function to multiply a threshold by a small factor, saturating
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::size_t multiplythreshold(std::size_t threshold, unsigned factor)noexcept{
+	return{(SIZE_MAX / factor < threshold)? SIZE_MAX : factor * threshold};
+}
+
+// run-time version of base2waythreshold(), which uses the profiled base count if it's set
+// this is the only version that allows 8-bit inputs
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, bool isindirect>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T),
+	std::size_t> runtime2waythreshold()noexcept{
+#if !defined(RSBD8_THREAD_MINIMUM) || 2 > RSBD8_THREAD_MINIMUM
+	std::size_t profiled{profiledthresholds[0][isindirect][(typebitsize<T> >> 3) - 1u].load(std::memory_order_relaxed)};
+	if(profiled)RSBD8_UNLIKELY return{std::max(scaleprofiledthreshold(profiled, thresholdmodefactor<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>()), thresholdminimum<T, isindirect>())};
+#endif
+	return{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, isindirect>()};
+}
+
+// run-time version of base4waythreshold(), which uses the profiled base count if it's set
+// the factor of 3 relative to the 2-way threshold is kept, see base4waythreshold()
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, bool isindirect>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	std::size_t> runtime4waythreshold()noexcept{
+	std::size_t threshold{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, isindirect>()};
+#if !defined(RSBD8_THREAD_MINIMUM) || 4 > RSBD8_THREAD_MINIMUM
+	std::size_t profiled{profiledthresholds[1][isindirect][(typebitsize<T> >> 3) - 1u].load(std::memory_order_relaxed)};
+	if(profiled)RSBD8_UNLIKELY threshold = scaleprofiledthreshold(profiled, thresholdmodefactor<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>());
+	threshold = std::max(threshold, multiplythreshold(runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, isindirect>(), 3u));
+#endif
+	return{threshold};
+}
+
+// run-time version of base8waythreshold(), which uses the profiled base count if it's set
+// the factor of 9 relative to the 2-way threshold is kept, see base8waythreshold()
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, bool isindirect>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	std::size_t> runtime8waythreshold()noexcept{
+	std::size_t threshold{base8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, isindirect>()};
+#if !defined(RSBD8_THREAD_MINIMUM) || 8 > RSBD8_THREAD_MINIMUM
+	std::size_t profiled{profiledthresholds[2][isindirect][(typebitsize<T> >> 3) - 1u].load(std::memory_order_relaxed)};
+	if(profiled)RSBD8_UNLIKELY threshold = scaleprofiledthreshold(profiled, thresholdmodefactor<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>());
+	threshold = std::max(threshold, multiplythreshold(runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, isindirect>(), 9u));
+#endif
+	return{threshold};
+}
+
 // Function implementation templates for 80-bit-based long double types without indirection
 
 // multithreaded initialisation part for all four implementation templates for 80-bit-based long double types without indirection
@@ -14500,7 +15223,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	(std::is_same_v<T, longdoubletest128<isabsvalue, issignmode, isfltpmode>> ||
 	std::is_same_v<T, longdoubletest96<isabsvalue, issignmode, isfltpmode>> ||
 	std::is_same_v<T, longdoubletest80<isabsvalue, issignmode, isfltpmode>>),
-	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != output);
 	assert(input != buffer);
@@ -14576,14 +15299,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortcopynoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer)noexcept{
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using W = decltype(T::signexponent);
 	using U = std::conditional_t<128u == CHAR_BIT * sizeof(T), std::uint_least64_t, unsigned>;// assume zero-extension to be basically free for U on basically all modern machines, but do not remove padding
@@ -14593,10 +15316,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != output);
 	assert(input != buffer);
@@ -14609,7 +15333,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -14623,27 +15347,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						if constexpr(isrevorder) new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X, T *RSBD8_RESTRICT>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, buffer)};
-						else new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output)};
+						if constexpr(isrevorder) new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X, T *RSBD8_RESTRICT>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, buffer)};
+						else new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortcopynoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -14656,7 +15380,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -15050,7 +15774,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	(std::is_same_v<T, longdoubletest128<isabsvalue, issignmode, isfltpmode>> ||
 	std::is_same_v<T, longdoubletest96<isabsvalue, issignmode, isfltpmode>> ||
 	std::is_same_v<T, longdoubletest80<isabsvalue, issignmode, isfltpmode>>),
-	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -15122,14 +15846,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortnoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, bool movetobuffer = false)noexcept{
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using W = decltype(T::signexponent);
 	using U = std::conditional_t<128u == CHAR_BIT * sizeof(T), std::uint_least64_t, unsigned>;// assume zero-extension to be basically free for U on basically all modern machines, but do not remove padding
@@ -15139,10 +15863,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -15152,7 +15877,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -15166,26 +15891,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, false, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, false, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortnoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;// this will usually set it to zero
@@ -15198,7 +15923,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			if constexpr(isrevorder){
@@ -17392,7 +18117,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_member_pointer_v<decltype(indirection1)> &&
 	80u == typebitsize<tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>>,
-	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	assert(1u < allowedthreads);
 	assert(input != output);
@@ -17476,14 +18201,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortcopynoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	using W = decltype(T::signexponent);
@@ -17502,10 +18227,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != output);
 	assert(input != buffer);
@@ -17518,7 +18244,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -17537,27 +18263,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						if constexpr(isrevorder) new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, V *RSBD8_RESTRICT *RSBD8_RESTRICT, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...)};
-						else new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<vararguments>(varparameters)...)};
+						if constexpr(isrevorder) new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, V *RSBD8_RESTRICT *RSBD8_RESTRICT, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...)};
+						else new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<vararguments>(varparameters)...)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
+				asynchandle = launchasync(radixsortcopynoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -17570,7 +18296,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -18174,7 +18900,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_member_pointer_v<decltype(indirection1)> &&
 	80u == typebitsize<tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>>,
-	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	assert(1u < allowedthreads);
 	assert(input != buffer);
@@ -18254,14 +18980,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortnoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer = false, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	using W = decltype(T::signexponent);
@@ -18280,10 +19006,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way < count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way < count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -18293,7 +19020,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -18312,26 +19039,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, false, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer, std::forward<vararguments>(varparameters)...)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, false, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer, std::forward<vararguments>(varparameters)...)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
+				asynchandle = launchasync(radixsortnoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;// this will usually set it to zero
@@ -18344,7 +19071,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			if constexpr(isrevorder){
@@ -19824,7 +20551,7 @@ template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, boo
 RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_same_v<T, test128<isabsvalue, issignmode, isfltpmode>>,
-	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != output);
 	assert(input != buffer);
@@ -19897,14 +20624,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortcopynoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer)noexcept{
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	std::size_t LO{}, HI{1u};// little-endian case
 	if constexpr(1u < sizeof(std::uintmax_t)){
@@ -19921,10 +20648,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != output);
 	assert(input != buffer);
@@ -19937,7 +20665,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -19951,27 +20679,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						if constexpr(isrevorder) new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X, T *RSBD8_RESTRICT>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, buffer)};
-						else new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output)};
+						if constexpr(isrevorder) new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X, T *RSBD8_RESTRICT>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, buffer)};
+						else new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortcopynoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -19984,7 +20712,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -20341,7 +21069,7 @@ template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, boo
 RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_same_v<T, test128<isabsvalue, issignmode, isfltpmode>>,
-	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -20410,14 +21138,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortnoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, bool movetobuffer = false)noexcept{
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	std::size_t LO{}, HI{1u};// little-endian case
 	if constexpr(1u < sizeof(std::uintmax_t)){
@@ -20434,10 +21162,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -20447,7 +21176,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -20461,26 +21190,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, false, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, false, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortnoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;// this will usually set it to zero
@@ -20493,7 +21222,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -21965,7 +22694,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_member_pointer_v<decltype(indirection1)> &&
 	128u == typebitsize<tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>>,
-	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	assert(1u < allowedthreads);
 	assert(input != output);
@@ -22048,14 +22777,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortcopynoallocmultimain(size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	std::size_t LO{}, HI{1u};// little-endian case
@@ -22073,10 +22802,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != output);
 	assert(input != buffer);
@@ -22089,7 +22819,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -22108,27 +22838,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						if constexpr(isrevorder) new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, V *RSBD8_RESTRICT *RSBD8_RESTRICT, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...)};
-						else new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<vararguments>(varparameters)...)};
+						if constexpr(isrevorder) new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, V *RSBD8_RESTRICT *RSBD8_RESTRICT, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...)};
+						else new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<vararguments>(varparameters)...)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
+				asynchandle = launchasync(radixsortcopynoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -22141,7 +22871,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -22687,7 +23417,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_member_pointer_v<decltype(indirection1)> &&
 	128u == typebitsize<tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>>,
-	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	assert(1u < allowedthreads);
 	assert(input != buffer);
@@ -22763,14 +23493,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortnoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer = false, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	std::size_t LO{}, HI{1u};// little-endian case
@@ -22788,10 +23518,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -22801,7 +23532,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -22820,26 +23551,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, false, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer, std::forward<vararguments>(varparameters)...)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, false, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer, std::forward<vararguments>(varparameters)...)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
+				asynchandle = launchasync(radixsortnoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;// this will usually set it to zero
@@ -22852,7 +23583,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			if constexpr(isrevorder){
@@ -24458,7 +25189,7 @@ template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, boo
 RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_same_v<T, test64<isabsvalue, issignmode, isfltpmode>>,
-	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != output);
 	assert(input != buffer);
@@ -24531,14 +25262,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortcopynoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer)noexcept{
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	std::size_t LO{}, HI{1u};// little-endian case
 	if constexpr(1u < sizeof(double)){
@@ -24555,10 +25286,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != output);
 	assert(input != buffer);
@@ -24571,7 +25303,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -24585,27 +25317,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						if constexpr(isrevorder) new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X, T *RSBD8_RESTRICT>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, buffer)};
-						else new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output)};
+						if constexpr(isrevorder) new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X, T *RSBD8_RESTRICT>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, buffer)};
+						else new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortcopynoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -24618,7 +25350,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -25001,7 +25733,7 @@ template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, boo
 RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_same_v<T, test64<isabsvalue, issignmode, isfltpmode>>,
-	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -25070,14 +25802,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortnoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, bool movetobuffer = false)noexcept{
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	std::size_t LO{}, HI{1u};// little-endian case
 	if constexpr(1u < sizeof(double)){
@@ -25094,10 +25826,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -25107,7 +25840,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -25121,26 +25854,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, false, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, false, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortnoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;// this will usually set it to zero
@@ -25153,7 +25886,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -27162,7 +27895,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_member_pointer_v<decltype(indirection1)> &&
 	64u == CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
-	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	assert(1u < allowedthreads);
 	assert(input != buffer);
@@ -27243,14 +27976,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortcopynoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	std::size_t LO{}, HI{1u};// little-endian case
@@ -27268,10 +28001,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -27282,7 +28016,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -27301,27 +28035,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						if constexpr(isrevorder) new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, V *RSBD8_RESTRICT *RSBD8_RESTRICT, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...)};
-						else new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<vararguments>(varparameters)...)};
+						if constexpr(isrevorder) new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, V *RSBD8_RESTRICT *RSBD8_RESTRICT, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...)};
+						else new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<vararguments>(varparameters)...)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
+				asynchandle = launchasync(radixsortcopynoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -27334,7 +28068,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -27984,7 +28718,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_member_pointer_v<decltype(indirection1)> &&
 	64u == CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
-	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	assert(1u < allowedthreads);
 	assert(input != buffer);
@@ -28063,14 +28797,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortnoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer = false, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	std::size_t LO{}, HI{1u};// little-endian case
@@ -28088,10 +28822,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -28101,7 +28836,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -28120,26 +28855,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, false, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer, std::forward<vararguments>(varparameters)...)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, false, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer, std::forward<vararguments>(varparameters)...)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
+				asynchandle = launchasync(radixsortnoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;// this will usually set it to zero
@@ -28152,7 +28887,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			if constexpr(isrevorder){
@@ -31990,7 +32725,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_class_v<T> || std::is_union_v<T>) &&
 	64 - (0xFFFFFFFFFFFFFFFFu > UINTPTR_MAX) >= CHAR_BIT * sizeof(T) &&
 	8u < CHAR_BIT * sizeof(T),
-	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != output);
 	assert(input != buffer);
@@ -32067,14 +32802,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortcopynoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer)noexcept{
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using U = std::conditional_t<sizeof(T) < sizeof(unsigned), unsigned, T>;// assume zero-extension to be basically free for U on basically all modern machines
 #if defined(RSBD8_THREAD_MAXIMUM) && 1 >= (RSBD8_THREAD_MAXIMUM)
@@ -32083,10 +32818,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != output);
 	assert(input != buffer);
@@ -32099,7 +32835,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -32113,27 +32849,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						if constexpr(isrevorder) new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X, T *RSBD8_RESTRICT>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, buffer)};
-						else new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output)};
+						if constexpr(isrevorder) new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X, T *RSBD8_RESTRICT>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, buffer)};
+						else new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, true, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortcopynoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -32146,7 +32882,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -34050,7 +34786,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_class_v<T> || std::is_union_v<T>) &&
 	64 - (0xFFFFFFFFFFFFFFFFu > UINTPTR_MAX) >= CHAR_BIT * sizeof(T) &&
 	8u < CHAR_BIT * sizeof(T),
-	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -34123,14 +34859,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortnoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, bool movetobuffer = false)noexcept{
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using U = std::conditional_t<sizeof(T) < sizeof(unsigned), unsigned, T>;// assume zero-extension to be basically free for U on basically all modern machines
 #if defined(RSBD8_THREAD_MAXIMUM) && 1 >= (RSBD8_THREAD_MAXIMUM)
@@ -34139,10 +34875,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -34152,7 +34889,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -34166,26 +34903,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, false, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<isrevorder, isabsvalue, issignmode, isfltpmode, false, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortnoallocmultimtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;// this will usually set it to zero
@@ -34198,7 +34935,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -40360,7 +41097,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_member_pointer_v<decltype(indirection1)> &&
 	64 - (0xFFFFFFFFFFFFFFFFu > UINTPTR_MAX) >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
 	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
-	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	void> radixsortcopynoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	assert(1u < allowedthreads);
 	assert(input != output);
@@ -40444,14 +41181,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortcopynoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	using U = std::conditional_t<sizeof(T) < sizeof(unsigned), unsigned, T>;// assume zero-extension to be basically free for U on basically all modern machines
@@ -40461,10 +41198,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != output);
 	assert(input != buffer);
@@ -40477,7 +41215,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -40496,27 +41234,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						if constexpr(isrevorder) new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, V *RSBD8_RESTRICT *RSBD8_RESTRICT, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...)};
-						else new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<vararguments>(varparameters)...)};
+						if constexpr(isrevorder) new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, V *RSBD8_RESTRICT *RSBD8_RESTRICT, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...)};
+						else new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, true, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<vararguments>(varparameters)...)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
+				asynchandle = launchasync(radixsortcopynoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -40529,7 +41267,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -43971,7 +44709,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_member_pointer_v<decltype(indirection1)> &&
 	64 - (0xFFFFFFFFFFFFFFFFu > UINTPTR_MAX) >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
 	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
-	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	void> radixsortnoallocmultimtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	assert(1u < allowedthreads);
 	assert(input != buffer);
@@ -44051,14 +44789,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 #if defined(RSBD8_THREAD_MAXIMUM) && 4 > (RSBD8_THREAD_MAXIMUM)
 	void
 #else
-	std::future<void>
+	taskfuture<void>
 #endif
 	> radixsortnoallocmultimain(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer = false, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	using U = std::conditional_t<sizeof(T) < sizeof(unsigned), unsigned, T>;// assume zero-extension to be basically free for U on basically all modern machines
@@ -44068,10 +44806,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -44081,7 +44820,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -44100,26 +44839,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, false, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer, std::forward<vararguments>(varparameters)...)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocmultiinitmt<indirection1, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, false, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer, std::forward<vararguments>(varparameters)...)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
+				asynchandle = launchasync(radixsortnoallocmultimtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;// this will usually set it to zero
@@ -44132,7 +44871,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			if constexpr(64u == typebitsize<T>){
@@ -48966,7 +49705,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	8u >= CHAR_BIT * sizeof(T) &&
 	((isabsvalue && issignmode) ||// both regular absolute modes
 	(!isabsvalue && issignmode && isfltpmode)),// regular floating-point mode
-	void> radixsortcopynoallocsinglemtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortcopynoallocsinglemtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != output);
 	// do not pass a nullptr here
@@ -49022,7 +49761,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	8u >= CHAR_BIT * sizeof(T) &&
 	!(isabsvalue && issignmode) &&// both regular absolute modes
 	!(!isabsvalue && issignmode && isfltpmode),// regular floating-point mode
-	void> radixsortcopynoallocsinglesimplemtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortcopynoallocsinglesimplemtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != output);
 	// do not pass a nullptr here
@@ -49075,10 +49814,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != output);
 	// do not pass a nullptr here
@@ -49088,7 +49828,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(output);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -49102,26 +49842,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocsingleinitmt<isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocsingleinitmt<isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocsinglemtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortcopynoallocsinglemtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -49134,7 +49874,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -49355,10 +50095,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != output);
 	// do not pass a nullptr here
@@ -49368,7 +50109,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(output);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -49382,26 +50123,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocsinglesimpleinitmt<isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocsinglesimpleinitmt<isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocsinglesimplemtc<isdescsort, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortcopynoallocsinglesimplemtc<isdescsort, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -49414,7 +50155,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -49541,7 +50282,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	8u >= CHAR_BIT * sizeof(T) &&
 	((isabsvalue && issignmode) ||// both regular absolute modes
 	(!isabsvalue && issignmode && isfltpmode)),// regular floating-point mode
-	void> radixsortnoallocsinglemtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortnoallocsinglemtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -49597,7 +50338,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	8u >= CHAR_BIT * sizeof(T) &&
 	!(isabsvalue && issignmode) &&// both regular absolute modes
 	!(!isabsvalue && issignmode && isfltpmode),// regular floating-point mode
-	void> radixsortnoallocsinglesimplemtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
+	void> radixsortnoallocsinglesimplemtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, std::atomic_uintptr_t &atomiclightbarrier)noexcept{
 	assert(1u < allowedthreads);
 	// do not pass a nullptr here
 	assert(pfutures);
@@ -49641,7 +50382,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer)noexcept{
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using U = std::conditional_t<sizeof(T) < sizeof(unsigned), unsigned, T>;// assume zero-extension to be basically free for U on basically all modern machines
 #if defined(RSBD8_THREAD_MAXIMUM) && 1 >= (RSBD8_THREAD_MAXIMUM)
@@ -49650,10 +50391,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -49663,7 +50405,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -49677,26 +50419,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocsingleinitmt<isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocsingleinitmt<isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocsinglemtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortnoallocsinglemtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -49709,7 +50451,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -49923,7 +50665,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input)noexcept{
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using U = std::conditional_t<sizeof(T) < sizeof(unsigned), unsigned, T>;// assume zero-extension to be basically free for U on basically all modern machines
 #if defined(RSBD8_THREAD_MAXIMUM) && 1 >= (RSBD8_THREAD_MAXIMUM)
@@ -49932,10 +50674,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	// do not pass a nullptr here
 	if constexpr(ismultithreadcapable) assert(pfuturesplaceholder);
@@ -49943,7 +50686,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(input);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -49957,26 +50700,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocsinglesimpleinitmt<isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocsinglesimpleinitmt<isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocsinglesimplemtc<isdescsort, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, std::ref(atomiclightbarrier));
+				asynchandle = launchasync(radixsortnoallocsinglesimplemtc<isdescsort, isabsvalue, issignmode, isfltpmode, T, X>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, std::ref(atomiclightbarrier));
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -49989,7 +50732,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -50593,7 +51336,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_member_pointer_v<decltype(indirection1)> &&
 	8u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
-	void> radixsortcopynoallocsinglemtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	void> radixsortcopynoallocsinglemtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	assert(1u < allowedthreads);
 	assert(input != output);
@@ -50671,10 +51414,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != output);
 	// do not pass a nullptr here
@@ -50684,7 +51428,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(output);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -50703,26 +51447,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocsingleinitmt<indirection1, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<vararguments>(varparameters)...)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocsingleinitmt<indirection1, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, output, std::forward<vararguments>(varparameters)...)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortcopynoallocsinglemtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
+				asynchandle = launchasync(radixsortcopynoallocsinglemtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, output, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -50735,7 +51479,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -51053,7 +51797,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	std::is_unsigned_v<X> &&
 	std::is_member_pointer_v<decltype(indirection1)> &&
 	8u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
-	void> radixsortnoallocsinglemtc(std::size_t count, unsigned allowedthreads, std::future<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	void> radixsortnoallocsinglemtc(std::size_t count, unsigned allowedthreads, taskfuture<void> *RSBD8_RESTRICT pfutures, offsetstype<isabsvalue, issignmode, isfltpmode, true, tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>, X> *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, std::atomic_uintptr_t &atomiclightbarrier, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	assert(1u < allowedthreads);
 	assert(input != buffer);
@@ -51123,7 +51867,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
 		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(std::future<void>)
+	// pfuturesplaceholder must point to a space of (allowedthreads - 2u) * sizeof(taskfuture<void>)
 	// pzeroedindices must point to a zeroed space of std::max(2u, allowedthreads) * sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	using U = std::conditional_t<sizeof(T) < sizeof(unsigned), unsigned, T>;// assume zero-extension to be basically free for U on basically all modern machines
@@ -51133,10 +51877,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	RSBD8_MAYBE_UNUSED void *RSBD8_RESTRICT pfuturesplaceholder;
 #endif
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	RSBD8_MAYBE_UNUSED std::size_t const runtimelimit2way{ismultithreadcapable? runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>() : limit2way};
 	if constexpr(ismultithreadcapable){
 		assert(1u < allowedthreads);// never use this function in the multithreading mode with single-threaded intent
 		assert(1u < std::thread::hardware_concurrency());// only use multithreading if there is more than one hardware thread
-		assert(limit2way <= count);// small arrays are only allowed in single-threaded mode
+		assert(runtimelimit2way <= count);// small arrays are only allowed in single-threaded mode
 	}
 	assert(input != buffer);
 	// do not pass a nullptr here
@@ -51146,7 +51891,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	assert(buffer);
 
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	std::future<void> asynchandle;
+	taskfuture<void> asynchandle;
 #else
 	RSBD8_MAYBE_UNUSED std::nullptr_t asynchandle;
 #endif
@@ -51165,26 +51910,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 		// generate the histograms for each part, all in one go
 		if constexpr(ismultithreadcapable){
-			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((limit2way + 1u) >> 1)));
+			allowedthreads = static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)));
 			assert(1u < allowedthreads);// the functions that determine the thread count should prevent this from happening, but just in case
-			std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
+			taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder)};
 			// slice 0 is handled by the main thread, and slice 1 by the companion thread
 			offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT pindicesiter{reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2};
 			assignedslice = allowedthreads;
 			try{
 				if(assignedslice -= 2u)RSBD8_LIKELY{
 					do RSBD8_LIKELY{
-						new(pfuturesiter) std::future<void>{std::async(std::launch::async, radixsortnoallocsingleinitmt<indirection1, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer, std::forward<vararguments>(varparameters)...)};
+						new(pfuturesiter) taskfuture<void>{launchasync(radixsortnoallocsingleinitmt<indirection1, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, assignedslice + 1u, std::ref(*pindicesiter), input, buffer, std::forward<vararguments>(varparameters)...)};
 						++pfuturesiter;
 						++pindicesiter;
 					}while(--assignedslice);
 				}
 				// pfuturesplaceholder holds 2 less than the available threads, as the main and companion threads will not be put in here
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
-				asynchandle = std::async(std::launch::async, radixsortnoallocsinglemtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
+				asynchandle = launchasync(radixsortnoallocsinglemtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, vararguments...>, count, allowedthreads, pfuturesiter + 1 - (allowedthreads >> 1), reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 1, input, buffer, std::ref(atomiclightbarrier), std::forward<vararguments>(varparameters)...);
 				--assignedslice;
 				usemultithread = 1u;
-			}catch(...){// std::async may fail gracefully here
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 			}
 			++assignedslice;
@@ -51197,7 +51942,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// for processing, the halves of the thread count are rounded up in the main thread (lower half), and rounded down in the companion thread (upper half)
 				collect.paddends = reinterpret_cast<offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X> *RSBD8_RESTRICT>(pzeroedindices) + 2;
 				collect.paccumulator = &offsets;
-				collect.pfutures = reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
+				collect.pfutures = reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder);
 				collect.num = ((allowedthreads - 1u) >> usemultithread) - assignedslice;
 			}
 			std::ptrdiff_t i{static_cast<std::ptrdiff_t>(count)};
@@ -51535,8 +52280,9 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 	// architecture: this compiles into just a few conditional move instructions on most platforms
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	auto pcall{radixsortcopynoallocsinglemain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -51615,8 +52361,9 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 	// architecture: this compiles into just a few conditional move instructions on most platforms
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	auto pcall{radixsortnoallocsinglemain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -51701,8 +52448,9 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 	// architecture: this compiles into just a few conditional move instructions on most platforms
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	auto pcall{radixsortnoallocsinglemain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -51780,8 +52528,9 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	auto pcall{radixsortcopynoallocsinglemain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -51859,8 +52608,9 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	auto pcall{radixsortnoallocsinglemain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -51946,8 +52696,9 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 	// architecture: this compiles into just a few conditional move instructions on most platforms
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	auto pcall{radixsortcopynoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -52027,8 +52778,9 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 	// architecture: this compiles into just a few conditional move instructions on most platforms
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	auto pcall{radixsortnoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -52114,8 +52866,9 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	auto pcall{radixsortcopynoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -52194,8 +52947,9 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	auto pcall{radixsortnoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -52255,14 +53009,14 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 }
 #endif
 
-// Helper class to safely moderate a std::future<std::future<void>> item on the stack
+// Helper class to safely moderate a taskfuture<taskfuture<void>> item on the stack
 
 // this class is a simple RAII wrapper to specifically use some space in a pre-allocated array instead of on the stack
 template<bool isnoexcept>
 class autowrapfutureonfuture{
-	std::future<std::future<void>> *RSBD8_RESTRICT pfutureonfuture;// this class expects the incoming space to be uninitialised
+	taskfuture<taskfuture<void>> *RSBD8_RESTRICT pfutureonfuture;// this class expects the incoming space to be uninitialised
 	// to reinforce the special use case of this class:
-	static_assert(sizeof(std::future<std::future<void>>) <= 2u * sizeof(std::future<void>), "unexpected size of std::future<std::future<void>>");
+	static_assert(sizeof(taskfuture<taskfuture<void>>) <= 2u * sizeof(taskfuture<void>), "unexpected size of taskfuture<taskfuture<void>>");
 
 public:
 	// disable copy and move mechanisms
@@ -52274,9 +53028,9 @@ public:
 		assert(pempty);
 
 		// this class expects the incoming space to be uninitialised
-		pfutureonfuture = new(pempty) std::future<std::future<void>>;
+		pfutureonfuture = new(pempty) taskfuture<taskfuture<void>>;
 	}
-	RSBD8_FUNC_INLINE autowrapfutureonfuture &operator=(std::future<std::future<void>> *RSBD8_RESTRICT &&pobject)noexcept{
+	RSBD8_FUNC_INLINE autowrapfutureonfuture &operator=(taskfuture<taskfuture<void>> *RSBD8_RESTRICT &&pobject)noexcept{
 		assert(!pfutureonfuture);// do not re-use assignment with this class
 		// do not pass a nullptr here
 		assert(pobject);
@@ -52286,22 +53040,22 @@ public:
 	}
 	RSBD8_FUNC_INLINE ~autowrapfutureonfuture()noexcept(isnoexcept){
 		if(pfutureonfuture){// destroy it safely, this will block until both tasks are completed
-			if constexpr(isnoexcept) pfutureonfuture->~future();
+			if constexpr(isnoexcept) pfutureonfuture->~taskfuture();
 			else if(std::uncaught_exceptions()){// if we're already unwinding from an exception std::terminate() would follow, so we just swallow any exceptions thrown by the destructors
 				try{
 					pfutureonfuture->get();// discard the return value, however this will propagate any exception from the inner task
 				}catch(...){}// swallow any exception
 				try{
-					pfutureonfuture->~future();// this will not generate an exception-upon-exception inside a destructor from the inner task
+					pfutureonfuture->~taskfuture();// this will not generate an exception-upon-exception inside a destructor from the inner task
 				}catch(...){}// swallow any exception
 			}else{// if we're not already unwinding from an exception, we can afford to throw an exception if the destructors fail, but we still need to make sure that all destructors are called, so we need to catch any exceptions thrown by the destructors and rethrow after all destructors have been called
 				try{
 					pfutureonfuture->get();// discard the return value, however this will propagate any exception from the inner task
 				}catch(...){
-					pfutureonfuture->~future();// this will not generate an exception-upon-exception inside a destructor from the inner task
+					pfutureonfuture->~taskfuture();// this will not generate an exception-upon-exception inside a destructor from the inner task
 					throw;// rethrow the exception after cleaning up
 				}
-				pfutureonfuture->~future();
+				pfutureonfuture->~taskfuture();
 			}
 		}
 	}
@@ -54422,6 +55176,31 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 	}else return{{cura, curb, curc}};
 }
 
+// the filtered key of an item, sorting on it as an unsigned integer gives the order of the sorting mode
+// this is used by the multithreading strategies without a merging phase, by the external sorting functions and by the streaming sort builder
+template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE T globalhistogramkey(T cur)noexcept{
+	using W = typename std::conditional_t<isabsvalue || !issignmode || isfltpmode, std::enable_if<true, T>, std::make_signed<T>>::type;
+	using U = std::conditional_t<std::is_signed_v<W> && sizeof(W) < sizeof(std::intptr_t), std::intptr_t,
+		std::conditional_t<std::is_unsigned_v<W> && sizeof(W) < sizeof(unsigned), unsigned, W>>;
+	if constexpr(isabsvalue || isfltpmode){
+		return{static_cast<T>(convertinput<isabsvalue, issignmode, isfltpmode, W>(static_cast<U>(static_cast<W>(cur))))};
+	}else if constexpr(issignmode) return{static_cast<T>(cur ^ generatehighbit<T>())};// flip the sign bit
+	else return{cur};
+}
+
+// the index of the digit of a filtered key for a sorting pass in the offsets array
+template<typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::size_t globalhistogrambucket(T key, unsigned pass)noexcept{
+	return{static_cast<std::size_t>((static_cast<std::size_t>(pass) << typeradix<T>) + (key >> pass * typeradix<T> & ((static_cast<T>(1u) << typeradix<T>) - 1u)))};
+}
+
+// the number of offsets for a sorting pass, the top end can be shortened
+template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr std::size_t globalhistogramlength(unsigned pass)noexcept{
+	return{(offsetsloopcount<T> - 1u != pass)? static_cast<std::size_t>(1u) << typeradix<T> : offsetslength<isabsvalue, issignmode, isfltpmode, T> - (static_cast<std::size_t>(pass) << typeradix<T>)};
+}
+
 #if !defined(RSBD8_THREAD_MAXIMUM) || 4 <= (RSBD8_THREAD_MAXIMUM)
 // Helper functions for merging the halves from multithreading inputs without indirection
 
@@ -55033,7 +55812,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	128u >= CHAR_BIT * sizeof(T) &&
 	8u < CHAR_BIT * sizeof(T),
 #if !defined(RSBD8_THREAD_MAXIMUM) || 6 <= (RSBD8_THREAD_MAXIMUM)
-	std::future<void>
+	taskfuture<void>
 #else
 	void
 #endif
@@ -55054,12 +55833,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 6 <= (RSBD8_THREAD_MAXIMUM)// pre-computed index size (X)
 	auto pcall{radixsortcopynoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X, true>};
 	std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
 #else
 	auto pcall{radixsortcopynoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -55089,11 +55870,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		}
 #endif
 		std::size_t finalcount{count};// depending on multithreading, this will be either count or one half of count (rounded down)
-		std::future<void> asyncreturnhandle;
+		taskfuture<void> asyncreturnhandle;
 		{
 			autowrapfutureonfuture<true> asynchandle;// this is to avoid having the child std::async task wait on the grandchild std::async task and instead do both here
 #if defined(RSBD8_THREAD_MAXIMUM) && 6 > (RSBD8_THREAD_MAXIMUM)
-			if(limit4way <= count && 3u < allowedthreads){// 4-way limit
+			if(runtimelimit4way <= count && 3u < allowedthreads){// 4-way limit
 #endif
 				std::size_t const halfcounttop{(count + 1u) >> 1};// rounded up
 				std::size_t const halfcount{count >> 1};// rounded down
@@ -55125,16 +55906,16 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				unsigned allowedthreadstemp{allowedthreads >> 1};
 				assert(1u < allowedthreadstemp);// each of the two parts will use at least two threads
 				indexsizeofpcall *= allowedthreadstemp;
-				std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+				taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 				std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 				try{
 					// process the upper half (rounded up) separately if possible
-					asynchandle = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, output + halfcount)};// use the otherwise unused space
+					asynchandle = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, output + halfcount)};// use the otherwise unused space
 					pcall = pcallsmaller;
 					allowedthreads = allowedthreadstemp;
 					std::swap(output, buffer);// swap the buffer pointers for processing the rest
 					finalcount = halfcount;
-				}catch(...){// std::async may fail gracefully here
+				}catch(...){// launchasync() may fail gracefully here
 					assert(false);
 				}
 #if defined(RSBD8_THREAD_MAXIMUM) && 6 > (RSBD8_THREAD_MAXIMUM)
@@ -55151,8 +55932,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 			asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
 			try{
 				// process the upper half separately if possible
-				asyncreturnhandle = std::async(std::launch::async, mergehalvesmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, output, buffer);
-			}catch(...){// std::async may fail gracefully here
+				asyncreturnhandle = launchasync(mergehalvesmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, output, buffer);
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 				// given the absolute rarity of this case, simply process this part in the current thread
 				mergehalvesmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, output, buffer);
@@ -55198,7 +55979,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	128u >= CHAR_BIT * sizeof(T) &&
 	8u < CHAR_BIT * sizeof(T),
 #if !defined(RSBD8_THREAD_MAXIMUM) || 6 <= (RSBD8_THREAD_MAXIMUM)
-	std::future<void>
+	taskfuture<void>
 #else
 	void
 #endif
@@ -55216,12 +55997,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 6 <= (RSBD8_THREAD_MAXIMUM)// pre-computed index size (X)
 	auto pcall{radixsortnoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X, true>};
 	std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
 #else
 	auto pcall{radixsortnoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -55251,11 +56034,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		}
 #endif
 		std::size_t finalcount{count};// depending on multithreading, this will be either count or one half of count (rounded down)
-		std::future<void> asyncreturnhandle;
+		taskfuture<void> asyncreturnhandle;
 		{
 			autowrapfutureonfuture<true> asynchandle;// this is to avoid having the child std::async task wait on the grandchild std::async task and instead do both here
 #if defined(RSBD8_THREAD_MAXIMUM) && 6 > (RSBD8_THREAD_MAXIMUM)
-			if(limit4way <= count && 3u < allowedthreads){// 4-way limit
+			if(runtimelimit4way <= count && 3u < allowedthreads){// 4-way limit
 #endif
 				std::size_t const halfcounttop{(count + 1u) >> 1};// rounded up
 				std::size_t const halfcount{count >> 1};// rounded down
@@ -55287,16 +56070,16 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				unsigned allowedthreadstemp{allowedthreads >> 1};
 				assert(1u < allowedthreadstemp);// each of the two parts will use at least two threads
 				indexsizeofpcall *= allowedthreadstemp;
-				std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+				taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 				std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 				try{
 					// process the upper half (rounded up) separately if possible
-					asynchandle = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, !movetobuffer)};// use the otherwise unused space
+					asynchandle = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, !movetobuffer)};// use the otherwise unused space
 					pcall = pcallsmaller;
 					allowedthreads = allowedthreadstemp;
 					movetobuffer = !movetobuffer;// swap the buffer pointers for processing the rest
 					finalcount = halfcount;
-				}catch(...){// std::async may fail gracefully here
+				}catch(...){// launchasync() may fail gracefully here
 					assert(false);
 				}
 #if defined(RSBD8_THREAD_MAXIMUM) && 6 > (RSBD8_THREAD_MAXIMUM)
@@ -55318,8 +56101,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 			asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
 			try{
 				// process the upper half separately if possible
-				asyncreturnhandle = std::async(std::launch::async, mergehalvesmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, input, buffer);
-			}catch(...){// std::async may fail gracefully here
+				asyncreturnhandle = launchasync(mergehalvesmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, input, buffer);
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 				// given the absolute rarity of this case, simply process this part in the current thread
 				mergehalvesmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, input, buffer);
@@ -56430,7 +57213,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	128u >= CHAR_BIT * sizeof(T) &&
 	8u < CHAR_BIT * sizeof(T),
 #if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
-	std::future<void>
+	taskfuture<void>
 #else
 	void
 #endif
@@ -56451,12 +57234,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)// pre-computed index size (X)
 	auto pcall{radixsortcopynoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, X, true>};
 	std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
 #else
 	auto pcall{radixsortcopynoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -56486,11 +57271,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		}
 #endif
 		std::size_t finalcount{count};// depending on multithreading, this will be either count or one third of count (rounded down)
-		std::future<void> asyncreturnhandle;
+		taskfuture<void> asyncreturnhandle;
 		{
-			autowrapfutureonfuture<true> asynchandlemid, asynchandletop;// this is to avoid having the child std::async tasks wait on the grandchild std::async tasks and instead do both here
+			autowrapfutureonfuture<true> asynchandlemid, asynchandletop;// this is to avoid having the child tasks wait on the grandchild tasks and instead do both here
 #if defined(RSBD8_THREAD_MAXIMUM) && 8 > (RSBD8_THREAD_MAXIMUM)
-			if(limit4way <= count && 5u < allowedthreads){// 6-way limit
+			if(runtimelimit4way <= count && 5u < allowedthreads){// 6-way limit
 #endif
 				std::size_t const thirdcount{count / 3u};// rounded down
 				std::size_t const thirdcountmid{(count + 1u) / 3u};
@@ -56524,11 +57309,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				unsigned allowedthreadstemp{allowedthreads / 3u};
 				assert(1u < allowedthreadstemp);// each of the three parts will use at least two threads
 				indexsizeofpcall *= allowedthreadstemp;
-				std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+				taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 				std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 				try{
 					// process the middle third (rounded in between) separately if possible
-					asynchandlemid = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, output + thirdcount)};// use the otherwise unused space
+					asynchandlemid = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, output + thirdcount)};// use the otherwise unused space
 					pcall = pcallsmaller;
 					allowedthreads = allowedthreadstemp;
 					pfuturesiter += allowedthreadstemp;// 2 unused slots per split
@@ -56537,13 +57322,13 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 					finalcount = thirdcount;
 					try{
 						// process the top third (rounded up) separately if possible
-						asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, output + twothirdscount, buffer + twothirdscount)};// use the otherwise unused space
-					}catch(...){// std::async may fail gracefully here
+						asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, output + twothirdscount, buffer + twothirdscount)};// use the otherwise unused space
+					}catch(...){// launchasync() may fail gracefully here
 						assert(false);
 						// given the absolute rarity of this case, simply process this part in the current thread
 						pcall(thirdcounttop, allowedthreads, pfuturesplaceholder, pzeroedindices, input + twothirdscount, output + twothirdscount, buffer + twothirdscount);
 					}
-				}catch(...){// std::async may fail gracefully here
+				}catch(...){// launchasync() may fail gracefully here
 					assert(false);
 				}
 #if defined(RSBD8_THREAD_MAXIMUM) && 8 > (RSBD8_THREAD_MAXIMUM)
@@ -56560,8 +57345,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 			asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
 			try{
 				// process the upper half separately if possible
-				asyncreturnhandle = std::async(std::launch::async, mergethirdsmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, output, buffer);
-			}catch(...){// std::async may fail gracefully here
+				asyncreturnhandle = launchasync(mergethirdsmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, output, buffer);
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 				// given the absolute rarity of this case, simply process this part in the current thread
 				mergethirdsmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, output, buffer);
@@ -56607,7 +57392,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	128u >= CHAR_BIT * sizeof(T) &&
 	8u < CHAR_BIT * sizeof(T),
 #if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
-	std::future<void>
+	taskfuture<void>
 #else
 	void
 #endif
@@ -56625,12 +57410,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)// pre-computed index size (X)
 	auto pcall{radixsortnoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, true>};
 	std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
 #else
 	auto pcall{radixsortnoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -56660,11 +57447,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		}
 #endif
 		std::size_t finalcount{count};// depending on multithreading, this will be either count or one third of count (rounded down)
-		std::future<void> asyncreturnhandle;
+		taskfuture<void> asyncreturnhandle;
 		{
-			autowrapfutureonfuture<true> asynchandlemid, asynchandletop;// this is to avoid having the child std::async tasks wait on the grandchild std::async tasks and instead do both here
+			autowrapfutureonfuture<true> asynchandlemid, asynchandletop;// this is to avoid having the child tasks wait on the grandchild tasks and instead do both here
 #if defined(RSBD8_THREAD_MAXIMUM) && 8 > (RSBD8_THREAD_MAXIMUM)
-			if(limit4way <= count && 5u < allowedthreads){// 6-way limit
+			if(runtimelimit4way <= count && 5u < allowedthreads){// 6-way limit
 #endif
 				std::size_t const thirdcount{count / 3u};// rounded down
 				std::size_t const thirdcountmid{(count + 1u) / 3u};
@@ -56698,11 +57485,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				unsigned allowedthreadstemp{allowedthreads / 3u};
 				assert(1u < allowedthreadstemp);// each of the three parts will use at least two threads
 				indexsizeofpcall *= allowedthreadstemp;
-				std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+				taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 				std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 				try{
 					// process the middle third (rounded in between) separately if possible
-					asynchandlemid = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, !movetobuffer)};// use the otherwise unused space
+					asynchandlemid = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, !movetobuffer)};// use the otherwise unused space
 					pcall = pcallsmaller;
 					allowedthreads = allowedthreadstemp;
 					pfuturesiter += allowedthreadstemp;// 2 unused slots per split
@@ -56711,13 +57498,13 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 					finalcount = thirdcount;
 					try{
 						// process the top third (rounded up) separately if possible
-						asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, buffer + twothirdscount, movetobuffer)};// use the otherwise unused space
-					}catch(...){// std::async may fail gracefully here
+						asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, buffer + twothirdscount, movetobuffer)};// use the otherwise unused space
+					}catch(...){// launchasync() may fail gracefully here
 						assert(false);
 						// given the absolute rarity of this case, simply process this part in the current thread
 						pcall(thirdcounttop, allowedthreads, pfuturesplaceholder, pzeroedindices, input + twothirdscount, buffer + twothirdscount, movetobuffer);
 					}
-				}catch(...){// std::async may fail gracefully here
+				}catch(...){// launchasync() may fail gracefully here
 					assert(false);
 				}
 #if defined(RSBD8_THREAD_MAXIMUM) && 8 > (RSBD8_THREAD_MAXIMUM)
@@ -56739,8 +57526,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 			asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
 			try{
 				// process the upper half separately if possible
-				asyncreturnhandle = std::async(std::launch::async, mergethirdsmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, input, buffer);
-			}catch(...){// std::async may fail gracefully here
+				asyncreturnhandle = launchasync(mergethirdsmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, input, buffer);
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 				// given the absolute rarity of this case, simply process this part in the current thread
 				mergethirdsmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, input, buffer);
@@ -56775,6 +57562,1046 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 }
 #endif// !defined(RSBD8_THREAD_MAXIMUM) || 6 <= (RSBD8_THREAD_MAXIMUM)
 
+// Helper functions for merge-path merging from multithreading inputs without indirection
+
+// The merging functions for halves and thirds use exactly two threads, one from each end of the output.
+// For 8-way and greater multithreading the final merge is done by merge-path (co-ranking) partitioning instead, so any number of threads can each merge an independent, equal range of the output.
+// The runs are consecutive in the input, and ties are resolved from the first to the last run, or from the last to the first run for reverse ordering.
+// Two or three runs use the same layout as the halves and thirds merging functions, the NUMA-aware sorting functions merge one run per node.
+
+// the maximum number of runs for the merge-path functions, which matches the maximum number of NUMA nodes
+constexpr unsigned mergepathwaysmaximum{numatopology::nodemaximum};
+
+// the start offsets of the two or three sorted runs, with the count as the final entry
+RSBD8_FUNC_INLINE void mergepathruns(std::size_t count, unsigned ways, std::size_t (&runoffsets)[4])noexcept{
+	assert(2u == ways || 3u == ways);
+	runoffsets[0] = 0u;
+	if(3u == ways){
+		runoffsets[1] = count / 3u;
+		runoffsets[2] = count / 3u + (count + 1u) / 3u;
+	}else{
+		runoffsets[1] = count >> 1;
+		runoffsets[2] = count;
+	}
+	runoffsets[3] = count;
+}
+
+// co-ranking: find the number of items of every run (as offsets into the runs) in the first items of the merged output, up to the diagonal
+// this is a selection over the runs, every step ranks the middle item of the widest remaining range of a run against the other runs with a binary search
+// the keys are ranked by their comparison result first, and by the tie order of the runs second
+template<bool isdescsort, bool isrevorder, typename F>
+RSBD8_FUNC_NORMAL void mergepathsplit(unsigned ways, std::size_t const *RSBD8_RESTRICT runoffsets, std::size_t diagonal, F getkey, std::size_t *RSBD8_RESTRICT splits)noexcept(std::is_nothrow_invocable_v<F, std::size_t>){
+	assert(2u <= ways && mergepathwaysmaximum >= ways);
+	std::size_t lo[mergepathwaysmaximum], hi[mergepathwaysmaximum];
+	for(unsigned run{}; ways > run; ++run){
+		lo[run] = runoffsets[run];
+		hi[run] = runoffsets[run + 1u];
+	}
+	for(;;){
+		unsigned pivotrun{};
+		std::size_t widest{};
+		for(unsigned run{}; ways > run; ++run) if(widest < hi[run] - lo[run]){
+			widest = hi[run] - lo[run];
+			pivotrun = run;
+		}
+		if(!widest) break;
+		std::size_t const pivot{lo[pivotrun] + (widest >> 1)};
+		auto const pivotkey{getkey(pivot)};
+		std::size_t ranks[mergepathwaysmaximum];
+		std::size_t rank{};
+		for(unsigned run{}; ways > run; ++run){
+			if(pivotrun == run) ranks[run] = pivot;
+			else{// the binary search is limited to the remaining range, which is the same as clamping the rank to it
+				bool const istiedbefore{!isrevorder? run < pivotrun : pivotrun < run};// items of this run that tie with the pivot go before it
+				std::size_t first{lo[run]}, last{hi[run]};
+				while(first < last){
+					std::size_t const middle{first + ((last - first) >> 1)};
+					auto const key{getkey(middle)};
+					if(istiedbefore? !(!isdescsort? pivotkey < key : key < pivotkey) : (!isdescsort? key < pivotkey : pivotkey < key)) first = middle + 1u;
+					else last = middle;
+				}
+				ranks[run] = first;
+			}
+			rank += ranks[run] - runoffsets[run];
+		}
+		if(diagonal > rank){// the pivot is part of the output range before the diagonal
+			for(unsigned run{}; ways > run; ++run) lo[run] = ranks[run];
+			lo[pivotrun] = pivot + 1u;
+		}else{
+			for(unsigned run{}; ways > run; ++run) hi[run] = ranks[run];
+			hi[pivotrun] = pivot;
+		}
+	}
+	for(unsigned run{}; ways > run; ++run) splits[run] = lo[run];
+}
+
+// merge one range of the output, starting at the given offsets into the runs
+template<bool isdescsort, bool isrevorder, typename E, typename F>
+RSBD8_FUNC_NORMAL void mergepathpart(unsigned ways, std::size_t const *RSBD8_RESTRICT runoffsets, std::size_t const *RSBD8_RESTRICT splits, std::size_t first, std::size_t last, E const *RSBD8_RESTRICT input, E *RSBD8_RESTRICT output, F getkey)noexcept(std::is_nothrow_invocable_v<F, std::size_t>){
+	assert(2u <= ways && mergepathwaysmaximum >= ways);
+	std::remove_cv_t<std::invoke_result_t<F, std::size_t>> keys[mergepathwaysmaximum];
+	std::size_t positions[mergepathwaysmaximum], stops[mergepathwaysmaximum];
+	for(unsigned run{}; ways > run; ++run){
+		positions[run] = splits[run];
+		stops[run] = runoffsets[run + 1u];
+		if(stops[run] != positions[run]) keys[run] = getkey(positions[run]);
+	}
+	E *RSBD8_RESTRICT pout{output + first};
+	for(std::size_t i{last - first}; i; --i){
+		unsigned selected{ways};
+		for(unsigned step{}; ways > step; ++step){// visit the runs in the tie order, so that only a strictly better key replaces the selected one
+			unsigned const run{!isrevorder? step : ways - 1u - step};
+			if(stops[run] == positions[run]) continue;
+			if(ways == selected || (!isdescsort? keys[run] < keys[selected] : keys[selected] < keys[run])) selected = run;
+		}
+		assert(ways != selected);
+		std::size_t const position{positions[selected]++};
+		*pout++ = input[position];
+		if(stops[selected] != position + 1u) keys[selected] = getkey(position + 1u);
+	}
+}
+
+// the key retrieval function for the merge-path functions
+template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE auto mergepathgetkey(T const *input)noexcept{
+	using W = typename std::conditional_t<std::is_class_v<T> || std::is_union_v<T> || isabsvalue || !issignmode || isfltpmode, std::enable_if<true, T>, std::make_signed<T>>::type;// for simple signed comparisons, use signed W
+	using U = std::conditional_t<std::is_signed_v<W> && sizeof(W) < sizeof(std::intptr_t), std::intptr_t,// sign-extend signed types for comparisons
+		std::conditional_t<std::is_unsigned_v<W> && sizeof(W) < sizeof(unsigned), unsigned, W>>;// assume zero-extension to be basically free for U on basically all modern machines
+	W const *RSBD8_RESTRICT pdata{reinterpret_cast<W const *RSBD8_RESTRICT>(input)};
+	return[pdata](std::size_t index)noexcept{
+		U cur{pdata[index]};
+		if constexpr(isabsvalue || isfltpmode){// filtered input, convert for unsigned comparisons
+			return convertinput<isabsvalue, issignmode, isfltpmode, W>(cur);
+		}else return cur;// unfiltered input, uses direct integer comparisons
+	};
+}
+
+#if !defined(RSBD8_THREAD_MAXIMUM) || 4 <= (RSBD8_THREAD_MAXIMUM)
+// merge the parts of a range of the output in a tree of tasks, every task merges its own range of the output
+// the range is given by its first item and its count, so a part of the threads can merge just a part of the output
+template<bool isdescsort, bool isrevorder, typename E, typename F>
+RSBD8_FUNC_NORMAL void mergepathrange(std::size_t rangefirst, std::size_t rangecount, unsigned ways, std::size_t const *runoffsets, unsigned firstpart, unsigned partcount, unsigned totalparts, E const *RSBD8_RESTRICT input, E *RSBD8_RESTRICT output, F getkey)noexcept(std::is_nothrow_invocable_v<F, std::size_t>){
+	assert(partcount);
+	if(1u < partcount){
+		unsigned const upperparts{partcount >> 1};
+		taskfuture<void> asynchandle;// the destructor of this waits for the upper parts
+		try{
+			// process the upper parts separately if possible
+			asynchandle = launchasync(mergepathrange<isdescsort, isrevorder, E, F>, rangefirst, rangecount, ways, runoffsets, firstpart + partcount - upperparts, upperparts, totalparts, input, output, getkey);
+		}catch(...){// launchasync() may fail gracefully here
+			assert(false);
+			// given the absolute rarity of this case, simply process these parts in the current thread
+			mergepathrange<isdescsort, isrevorder, E, F>(rangefirst, rangecount, ways, runoffsets, firstpart + partcount - upperparts, upperparts, totalparts, input, output, getkey);
+		}
+		// process the lower parts (rounded up) here
+		mergepathrange<isdescsort, isrevorder, E, F>(rangefirst, rangecount, ways, runoffsets, firstpart, partcount - upperparts, totalparts, input, output, getkey);
+		return;
+	}
+	// equal output ranges, with the remainder distributed over the first parts
+	std::size_t const quotient{rangecount / totalparts}, remainder{rangecount % totalparts};
+	std::size_t const first{rangefirst + quotient * firstpart + std::min(static_cast<std::size_t>(firstpart), remainder)};
+	std::size_t const last{first + quotient + (firstpart < remainder)};
+	std::size_t splits[mergepathwaysmaximum];
+	mergepathsplit<isdescsort, isrevorder, F>(ways, runoffsets, first, getkey, splits);
+	mergepathpart<isdescsort, isrevorder, E, F>(ways, runoffsets, splits, first, last, input, output, getkey);
+}
+#endif// !defined(RSBD8_THREAD_MAXIMUM) || 4 <= (RSBD8_THREAD_MAXIMUM)
+
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+
+// merge two or three sorted runs with the given number of threads
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	void> mergepathmulti(std::size_t count, unsigned ways, unsigned allowedthreads, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output)noexcept{
+	assert(input != output);
+	assert(allowedthreads);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	auto getkey{mergepathgetkey<isabsvalue, issignmode, isfltpmode, T>(input)};
+	// do not split into parts of just a few items
+	unsigned parts{allowedthreads};
+	if(count < static_cast<std::size_t>(parts) * 1024u) parts = static_cast<unsigned>(count >> 10 | 1u);
+	std::size_t runoffsets[4];
+	mergepathruns(count, ways, runoffsets);
+	mergepathrange<isdescsort, isrevorder, T, decltype(getkey)>(0u, count, ways, runoffsets, 0u, parts, parts, input, output, getkey);
+}
+#endif// !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+// Helper functions for the global histogram multithreading strategy without indirection
+
+// The default multithreading functions sort halves and thirds of the input independently, and merge those afterwards with one extra pass over the data for every merging level.
+// This strategy sorts the entire input in least significant digit order instead, with every thread counting and scattering its own slice of the array in every sorting pass.
+// The index counts of all the threads are combined into global offsets after every counting phase, so that every thread scatters its items directly to their final positions of that sorting pass, without a merging phase.
+// The costs are a counting pass over the data for every sorting pass but the first, and a few spinlock barriers between the phases.
+// Only single-part types of up to 64 bits are handled here, so not 80-bit-based long double types, 128-bit types or 64-bit types on 32-bit platforms.
+
+// a spinlock barrier for all the threads of a single sorting function, which is only safe to use as every launched task gets a thread of its own right away
+class globalhistogrambarrier{
+	std::atomic_uint arrived{};
+	std::atomic_uint generation{};
+public:
+	unsigned threads{};// set before the threads are released, and not changed afterwards
+
+	RSBD8_FUNC_INLINE void arriveandwait()noexcept{
+		unsigned const current{generation.load(std::memory_order_acquire)};
+		if(threads == arrived.fetch_add(1u, std::memory_order_acq_rel) + 1u){// the last thread to arrive releases the others
+			arrived.store(0u, std::memory_order_relaxed);
+			generation.store(current + 1u, std::memory_order_release);
+		}else while(current == generation.load(std::memory_order_acquire)) spinpause();
+	}
+};
+
+// the shared state of all the threads of a single sorting function, this lives on the stack of the calling thread
+template<typename T>
+struct globalhistogramstate{
+	globalhistogrambarrier barrier;
+	std::atomic_bool isreleased{};// set once all threads are launched
+	std::size_t count;
+	std::byte *pindices;// the index counts of every thread, one offsetstype item per thread
+	T const *input;
+	T *pfinal;// the output array
+	T *pother;// the intermediate array, for the in-place variant this is the input array if the output array is the buffer array
+	bool isinplace;
+	bool isfinalcopy;// set if the last sorting pass of the in-place variant does not end up in the output array
+	unsigned passcount;// the number of sorting passes that are not skipped
+	unsigned passes[offsetsloopcount<T>];// the sorting passes that are not skipped, from the least to the most significant digit
+	T *targets[2];// the destination arrays of the even and odd sorting passes
+};
+
+// turn the counts of a sorting pass of every thread into the offsets of every thread in the destination array
+template<bool isdescsort, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, typename X>
+RSBD8_FUNC_NORMAL void globalhistogramoffsets(std::size_t count, unsigned threads, std::byte *pindices, unsigned pass)noexcept{
+	static std::size_t constexpr stride{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
+	std::size_t const base{static_cast<std::size_t>(pass) << typeradix<T>};
+	std::size_t const length{globalhistogramlength<isabsvalue, issignmode, isfltpmode, T>(pass)};
+	std::size_t offset{};
+	for(std::size_t i{}; length > i; ++i){
+		std::size_t const bucket{base + (isdescsort? length - 1u - i : i)};
+		// the threads are visited in the order of their slices, this keeps the sort stable
+		for(unsigned thread{}; threads > thread; ++thread){
+			X &elem{reinterpret_cast<X *>(pindices + thread * stride)[bucket]};
+			X const cur{elem};
+			elem = static_cast<X>(offset);
+			offset += cur;
+		}
+	}
+	assert(count == offset);
+	static_cast<void>(count);
+}
+
+// the work of every thread of the global histogram strategy, thread 0 also handles the planning and the offsets in between the parallel phases
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, typename X>
+RSBD8_FUNC_NORMAL void radixsortglobalhistogramthread(globalhistogramstate<T> *pstate, unsigned thread)noexcept{
+	static unsigned constexpr radix{typeradix<T>};
+	static std::size_t constexpr stride{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
+	globalhistogramstate<T> &state{*pstate};
+	// wait until all threads are launched, the number of threads is only known after that
+	while(!state.isreleased.load(std::memory_order_acquire)) spinpause();
+	unsigned const threads{state.barrier.threads};
+	std::size_t const count{state.count};
+	X *RSBD8_RESTRICT pcounts{reinterpret_cast<X *>(state.pindices + thread * stride)};
+	// equal slices, with the remainder distributed over the first threads
+	std::size_t const quotient{count / threads}, remainder{count % threads};
+	std::size_t const first{quotient * thread + std::min(static_cast<std::size_t>(thread), remainder)};
+	std::size_t const last{first + quotient + (thread < remainder)};
+
+	// count all digits of the slice in one go, the first sorting pass uses the mirrored slice for the reverse order
+	{
+		T const *RSBD8_RESTRICT pinput{state.input + (isrevorder? count - last : first)};
+		for(std::size_t i{last - first}; i; --i){
+			T const key{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(*pinput++)};
+			for(unsigned pass{}; offsetsloopcount<T> > pass; ++pass) ++pcounts[globalhistogrambucket<T>(key, pass)];
+		}
+	}
+	state.barrier.arriveandwait();
+	if(!thread){// plan the sorting passes, a pass is skipped if all items have the same digit in it
+		unsigned passcount{};
+		for(unsigned pass{}; offsetsloopcount<T> > pass; ++pass){
+			std::size_t total{};// the total of the first used bucket decides, the loop always ends as the counts of a pass add up to the total count
+			for(std::size_t bucket{static_cast<std::size_t>(pass) << radix}; !total; ++bucket) for(unsigned i{}; threads > i; ++i) total += reinterpret_cast<X *>(state.pindices + i * stride)[bucket];
+			if(count != total) state.passes[passcount++] = pass;
+		}
+		if(!passcount) state.passes[passcount++] = 0u;// all items are equal, but they still need to end up in the output
+		state.passcount = passcount;
+		// alternate between the output array and the intermediate array, so that the last sorting pass writes to the output array if possible
+		T *ptargetfirst{state.pfinal}, *ptargetsecond{state.pother};
+		if(!(passcount & 1u)) std::swap(ptargetfirst, ptargetsecond);
+		state.isfinalcopy = false;
+		if(state.isinplace && state.input == ptargetfirst){// the input array cannot be the target of the first pass
+			std::swap(ptargetfirst, ptargetsecond);
+			state.isfinalcopy = true;
+		}
+		state.targets[0] = ptargetfirst;
+		state.targets[1] = ptargetsecond;
+		globalhistogramoffsets<isdescsort, isabsvalue, issignmode, isfltpmode, T, X>(count, threads, state.pindices, state.passes[0]);
+	}
+	state.barrier.arriveandwait();
+	T const *psource{state.input};
+	unsigned const passcount{state.passcount};
+	for(unsigned index{}; passcount > index; ++index){
+		unsigned const pass{state.passes[index]};
+		if(index){// count the digits of this pass in the slice, using the output of the previous pass
+			std::memset(pcounts + (static_cast<std::size_t>(pass) << radix), 0, globalhistogramlength<isabsvalue, issignmode, isfltpmode, T>(pass) * sizeof(X));
+			T const *RSBD8_RESTRICT pinput{psource + first};
+			for(std::size_t i{last - first}; i; --i) ++pcounts[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(*pinput++), pass)];
+			state.barrier.arriveandwait();
+			if(!thread) globalhistogramoffsets<isdescsort, isabsvalue, issignmode, isfltpmode, T, X>(count, threads, state.pindices, pass);
+			state.barrier.arriveandwait();
+		}
+		// scatter the slice to the final positions of this pass
+		T *RSBD8_RESTRICT poutput{state.targets[index & 1u]};
+		if(isrevorder && !index){
+			T const *RSBD8_RESTRICT pinput{psource + (count - first)};
+			for(std::size_t i{last - first}; i; --i){
+				T const cur{*--pinput};
+				poutput[pcounts[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur), pass)]++] = cur;
+			}
+		}else{
+			T const *RSBD8_RESTRICT pinput{psource + first};
+			for(std::size_t i{last - first}; i; --i){
+				T const cur{*pinput++};
+				poutput[pcounts[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur), pass)]++] = cur;
+			}
+		}
+		psource = poutput;
+		if(passcount != index + 1u || state.isfinalcopy) state.barrier.arriveandwait();
+	}
+	if(state.isfinalcopy) std::memcpy(state.pfinal + first, psource + first, (last - first) * sizeof(T));
+}
+
+// launch the threads of a strategy that synchronises on a globalhistogrambarrier, and process the work of the first thread in the current thread
+template<typename S>
+RSBD8_FUNC_NORMAL void globalhistogramlaunch(unsigned threads, taskfuture<void> *RSBD8_RESTRICT pfutures, S &state, void (*pthread)(S *, unsigned)noexcept)noexcept{
+	// pfutures holds 2 less than the number of threads, as the current thread and the last launched thread will not be put in there
+	taskfuture<void> asynchandle;
+	unsigned placed{};
+	bool islastlaunched{};
+	try{
+		while(threads - 2u > placed){
+			new(pfutures + placed) taskfuture<void>{launchasync(pthread, &state, placed + 1u)};
+			++placed;
+		}
+		asynchandle = launchasync(pthread, &state, placed + 1u);
+		islastlaunched = true;
+	}catch(...){// launchasync() may fail gracefully here
+		assert(false);
+		// given the absolute rarity of this case, simply continue with the threads that were launched
+	}
+	state.barrier.threads = placed + 1u + islastlaunched;
+	state.isreleased.store(true, std::memory_order_release);
+	pthread(&state, 0u);
+	// wait for the other threads, the destructor of asynchandle waits for the last one
+	while(placed) pfutures[--placed].~taskfuture<void>();
+}
+
+// sort with the global histogram strategy, false is returned without sorting for the types that this strategy does not handle
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	bool> radixsortglobalhistogram(std::size_t count, unsigned threads, void *RSBD8_RESTRICT pfuturesplaceholder, void *RSBD8_RESTRICT pzeroedindices, T const *input, T *output, T *buffer, bool isinplace)noexcept{
+	if constexpr(!std::is_unsigned_v<T> || 64u < CHAR_BIT * sizeof(T) || isoffsetsbodysplitup<T>){
+		static_cast<void>(count);
+		static_cast<void>(threads);
+		static_cast<void>(pfuturesplaceholder);
+		static_cast<void>(pzeroedindices);
+		static_cast<void>(input);
+		static_cast<void>(output);
+		static_cast<void>(buffer);
+		static_cast<void>(isinplace);
+		return{false};
+	}else{
+		assert(1u < threads);
+		globalhistogramstate<T> state;
+		state.count = count;
+		state.pindices = reinterpret_cast<std::byte *>(pzeroedindices);
+		state.input = input;
+		state.pfinal = output;
+		state.pother = buffer;
+		state.isinplace = isinplace;
+		static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+		// select the smallest unsigned type for the indices
+		// architecture: this compiles into just a few conditional move instructions on most platforms
+		auto pthread{radixsortglobalhistogramthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t>};
+		if constexpr(ULLONG_MAX >= limit2way && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= count) pthread = radixsortglobalhistogramthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long long>;
+		if constexpr(ULONG_MAX >= limit2way && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= count) pthread = radixsortglobalhistogramthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long>;
+		if constexpr(UINT_MAX >= limit2way && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= count) pthread = radixsortglobalhistogramthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned>;
+		if constexpr(USHRT_MAX >= limit2way && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= count) pthread = radixsortglobalhistogramthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned short>;
+		if constexpr(UCHAR_MAX >= limit2way && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= count) pthread = radixsortglobalhistogramthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned char>;
+		globalhistogramlaunch<globalhistogramstate<T>>(threads, reinterpret_cast<taskfuture<void> *>(pfuturesplaceholder), state, pthread);
+		return{true};
+	}
+}
+
+// Helper functions for the MSD-then-LSD multithreading strategy without indirection
+
+// This strategy first partitions the input on its most significant digit with all threads, in the same way as a sorting pass of the global histogram strategy.
+// The parts that this creates (up to 2048, depending on the type) are then sorted independently, every thread takes the next unsorted part as soon as it is done with the previous one.
+// A part that is too large to stay in the data caches of a single core is partitioned again on its next digit, until the parts are small enough to be sorted with the remaining least significant digit passes.
+// For large arrays this keeps most of the sorting passes in the data caches, so the main memory is only read and written a few times, instead of once for every sorting pass.
+// The per-thread index counts of the other strategies are used here as well, each part uses the offsets of the digits below its own, so one item per thread is enough.
+// Only single-part types of up to 64 bits are handled here, like with the global histogram strategy.
+
+// the size of the parts that are sorted with least significant digit passes, such a part and its destination should fit in the level 2 data cache of a typical core
+constexpr std::size_t msdthenlsdpartsize{static_cast<std::size_t>(1u) << 19};
+
+// the shared state of all the threads of a single sorting function, this lives on the stack of the calling thread
+template<typename T>
+struct msdthenlsdstate{
+	globalhistogrambarrier barrier;
+	std::atomic_bool isreleased{};// set once all threads are launched
+	std::atomic_size_t nextpart{};// the next part to sort, in the order of the output
+	std::size_t count;
+	std::byte *pindices;// the index counts of every thread, one offsetstype item per thread
+	T const *input;
+	T *ppartitioned;// the destination of the partitioning on the most significant digit
+	T *pspare;// the other array, for the in-place variant this is the input array
+	T *pfinal;// the output array, either of the above two
+};
+
+// sort a part on the given number of least significant digits, it is in pcur and has to end up in pfinal (which is either pcur or pother), the same range of pother can be used freely
+template<bool isdescsort, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, typename X>
+RSBD8_FUNC_NORMAL void msdthenlsdpart(std::size_t count, unsigned digits, X *RSBD8_RESTRICT pcounts, T *pcur, T *pother, T *pfinal)noexcept{
+	static unsigned constexpr radix{typeradix<T>};
+	static std::size_t constexpr length{static_cast<std::size_t>(1u) << radix};
+	assert(digits < offsetsloopcount<T>);// the most significant digit is never handled here
+	if(1u < digits && msdthenlsdpartsize < count * sizeof(T)){// partition on the top digit of this part first
+		unsigned const pass{digits - 1u};
+		X *RSBD8_RESTRICT poffsets{pcounts + (static_cast<std::size_t>(pass) << radix)};// the offsets of the digits below this one are left alone by the parts below
+		std::memset(poffsets, 0, length * sizeof(X));
+		for(std::size_t i{}; count > i; ++i) ++poffsets[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(pcur[i]), pass) - (static_cast<std::size_t>(pass) << radix)];
+		std::size_t offset{};
+		bool isskipped{};
+		for(std::size_t i{}; length > i; ++i){
+			X &elem{poffsets[isdescsort? length - 1u - i : i]};
+			X const cur{elem};
+			if(count == cur){// all items have the same digit here
+				isskipped = true;
+				break;
+			}
+			elem = static_cast<X>(offset);
+			offset += cur;
+		}
+		if(isskipped){
+			msdthenlsdpart<isdescsort, isabsvalue, issignmode, isfltpmode, T, X>(count, pass, pcounts, pcur, pother, pfinal);
+			return;
+		}
+		for(std::size_t i{}; count > i; ++i){
+			T const cur{pcur[i]};
+			pother[poffsets[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur), pass) - (static_cast<std::size_t>(pass) << radix)]++] = cur;
+		}
+		// after scattering, the offsets are at the ends of the parts
+		T *pnextfinal{(pfinal == pcur)? pcur : pother};
+		std::size_t first{};
+		for(std::size_t i{}; length > i; ++i){
+			std::size_t const last{poffsets[isdescsort? length - 1u - i : i]};
+			if(first != last) msdthenlsdpart<isdescsort, isabsvalue, issignmode, isfltpmode, T, X>(last - first, pass, pcounts, pother + first, pcur + first, pnextfinal + first);
+			first = last;
+		}
+		return;
+	}
+	// count all remaining digits in one go
+	std::memset(pcounts, 0, (static_cast<std::size_t>(digits) << radix) * sizeof(X));
+	for(std::size_t i{}; count > i; ++i){
+		T const key{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(pcur[i])};
+		for(unsigned pass{}; digits > pass; ++pass) ++pcounts[globalhistogrambucket<T>(key, pass)];
+	}
+	T *psource{pcur}, *pdestination{pother};
+	for(unsigned pass{}; digits > pass; ++pass){
+		X *RSBD8_RESTRICT poffsets{pcounts + (static_cast<std::size_t>(pass) << radix)};
+		std::size_t offset{};
+		bool isskipped{};
+		for(std::size_t i{}; length > i; ++i){
+			X &elem{poffsets[isdescsort? length - 1u - i : i]};
+			X const cur{elem};
+			if(count == cur){// all items have the same digit here
+				isskipped = true;
+				break;
+			}
+			elem = static_cast<X>(offset);
+			offset += cur;
+		}
+		if(isskipped) continue;
+		for(std::size_t i{}; count > i; ++i){
+			T const cur{psource[i]};
+			pdestination[poffsets[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur), pass) - (static_cast<std::size_t>(pass) << radix)]++] = cur;
+		}
+		std::swap(psource, pdestination);
+	}
+	if(pfinal != psource) std::memcpy(pfinal, psource, count * sizeof(T));
+}
+
+// the work of every thread of the MSD-then-LSD strategy, thread 0 also handles the offsets in between the parallel phases
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, typename X>
+RSBD8_FUNC_NORMAL void radixsortmsdthenlsdthread(msdthenlsdstate<T> *pstate, unsigned thread)noexcept{
+	static unsigned constexpr top{offsetsloopcount<T> - 1u};
+	static std::size_t constexpr base{static_cast<std::size_t>(top) << typeradix<T>};
+	static std::size_t constexpr length{globalhistogramlength<isabsvalue, issignmode, isfltpmode, T>(top)};
+	static std::size_t constexpr stride{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
+	msdthenlsdstate<T> &state{*pstate};
+	// wait until all threads are launched, the number of threads is only known after that
+	while(!state.isreleased.load(std::memory_order_acquire)) spinpause();
+	unsigned const threads{state.barrier.threads};
+	std::size_t const count{state.count};
+	X *RSBD8_RESTRICT pcounts{reinterpret_cast<X *>(state.pindices + thread * stride)};
+	// equal slices, with the remainder distributed over the first threads, the reverse order uses the mirrored slice
+	std::size_t const quotient{count / threads}, remainder{count % threads};
+	std::size_t const first{quotient * thread + std::min(static_cast<std::size_t>(thread), remainder)};
+	std::size_t const last{first + quotient + (thread < remainder)};
+
+	// count the most significant digit of the slice, the indices are still zeroed here
+	{
+		T const *RSBD8_RESTRICT pinput{state.input + (isrevorder? count - last : first)};
+		for(std::size_t i{last - first}; i; --i) ++pcounts[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(*pinput++), top)];
+	}
+	state.barrier.arriveandwait();
+	if(!thread) globalhistogramoffsets<isdescsort, isabsvalue, issignmode, isfltpmode, T, X>(count, threads, state.pindices, top);
+	state.barrier.arriveandwait();
+	// partition the slice on the most significant digit
+	{
+		T *RSBD8_RESTRICT poutput{state.ppartitioned};
+		if constexpr(isrevorder){
+			T const *RSBD8_RESTRICT pinput{state.input + (count - first)};
+			for(std::size_t i{last - first}; i; --i){
+				T const cur{*--pinput};
+				poutput[pcounts[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur), top)]++] = cur;
+			}
+		}else{
+			T const *RSBD8_RESTRICT pinput{state.input + first};
+			for(std::size_t i{last - first}; i; --i){
+				T const cur{*pinput++};
+				poutput[pcounts[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur), top)]++] = cur;
+			}
+		}
+	}
+	state.barrier.arriveandwait();
+	// after scattering, the offsets of the last thread are at the ends of the parts
+	X const *RSBD8_RESTRICT pends{reinterpret_cast<X const *>(state.pindices + (threads - 1u) * stride) + base};
+	for(;;){
+		std::size_t const part{state.nextpart.fetch_add(1u, std::memory_order_relaxed)};
+		if(length <= part) break;
+		std::size_t const partlast{pends[isdescsort? length - 1u - part : part]};
+		std::size_t const partfirst{part? static_cast<std::size_t>(pends[isdescsort? length - part : part - 1u]) : 0u};
+		if(partfirst != partlast) msdthenlsdpart<isdescsort, isabsvalue, issignmode, isfltpmode, T, X>(partlast - partfirst, top, pcounts, state.ppartitioned + partfirst, state.pspare + partfirst, state.pfinal + partfirst);
+	}
+}
+
+// sort with the MSD-then-LSD strategy, false is returned without sorting for the types that this strategy does not handle
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	bool> radixsortmsdthenlsd(std::size_t count, unsigned threads, void *RSBD8_RESTRICT pfuturesplaceholder, void *RSBD8_RESTRICT pzeroedindices, T const *input, T *output, T *buffer, bool isinplace)noexcept{
+	if constexpr(!std::is_unsigned_v<T> || 64u < CHAR_BIT * sizeof(T) || isoffsetsbodysplitup<T>){
+		static_cast<void>(count);
+		static_cast<void>(threads);
+		static_cast<void>(pfuturesplaceholder);
+		static_cast<void>(pzeroedindices);
+		static_cast<void>(input);
+		static_cast<void>(output);
+		static_cast<void>(buffer);
+		static_cast<void>(isinplace);
+		return{false};
+	}else{
+		assert(1u < threads);
+		msdthenlsdstate<T> state;
+		state.count = count;
+		state.pindices = reinterpret_cast<std::byte *>(pzeroedindices);
+		state.input = input;
+		state.pfinal = output;
+		if(isinplace){// the input array cannot be partitioned into itself
+			state.ppartitioned = (input == output)? buffer : output;
+			state.pspare = (input == output)? output : buffer;
+		}else{// partition into the array that makes an unskipped least significant digit sort of the parts end up in the output array
+			state.ppartitioned = (offsetsloopcount<T> & 1u)? output : buffer;
+			state.pspare = (offsetsloopcount<T> & 1u)? buffer : output;
+		}
+		static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+		// select the smallest unsigned type for the indices
+		// architecture: this compiles into just a few conditional move instructions on most platforms
+		auto pthread{radixsortmsdthenlsdthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t>};
+		if constexpr(ULLONG_MAX >= limit2way && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= count) pthread = radixsortmsdthenlsdthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long long>;
+		if constexpr(ULONG_MAX >= limit2way && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= count) pthread = radixsortmsdthenlsdthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long>;
+		if constexpr(UINT_MAX >= limit2way && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= count) pthread = radixsortmsdthenlsdthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned>;
+		if constexpr(USHRT_MAX >= limit2way && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= count) pthread = radixsortmsdthenlsdthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned short>;
+		if constexpr(UCHAR_MAX >= limit2way && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= count) pthread = radixsortmsdthenlsdthread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned char>;
+		globalhistogramlaunch<msdthenlsdstate<T>>(threads, reinterpret_cast<taskfuture<void> *>(pfuturesplaceholder), state, pthread);
+		return{true};
+	}
+}
+
+// Helper functions for the sample sort multithreading strategy without indirection
+
+// The other strategies split the input into equal slices, and either merge the sorted slices afterwards or combine the index counts of the slices for every sorting pass.
+// This strategy splits the input into buckets of roughly equal size instead, by splitters taken from a sorted sample of the keys.
+// All threads count and scatter their own slice into the buckets, after which every bucket is sorted by a single-threaded sorting function, directly to its final position in the output, without a merging phase.
+// Keys that are equal to a splitter get a bucket of their own, which needs no sorting at all. This keeps the other buckets small when a few values dominate the input.
+// The single-threaded sorting functions use two items of index counts each, as allocated by getallocationparts() for 8 threads or more, so the buckets are sorted by all threads, which take the next bucket as soon as they are done with the previous one.
+// The functions here are shared with the variants with indirection, only single-part types of up to 64 bits are handled in both cases.
+
+// the maximum number of splitters, which keeps the samples and the bucket offsets on the stack
+constexpr unsigned samplesortmaxsplitters{127u};
+// the number of sampled keys for every bucket
+constexpr unsigned samplesortoversampling{16u};
+
+// the shared state of all the threads of a single sorting function, this lives on the stack of the calling thread
+// E is the item type of the arrays, T is the type of the filtered keys, F retrieves the filtered key of an item and G sorts a bucket with a single-threaded sorting function
+template<typename T, typename E, typename F, typename G>
+struct samplesortstate{
+	globalhistogrambarrier barrier;
+	std::atomic_bool isreleased{};// set once all threads are launched
+	std::atomic_uint nextbucket{};// the next bucket to sort
+	std::size_t count;
+	std::size_t stride;// the size of one offsetstype item of index counts
+	std::byte *pindices;// the index counts of every thread, one item per thread when counting and two items per thread when sorting the buckets
+	E const *input;
+	E *pscattered;// the destination of the scattering into the buckets, never the input array
+	E *pother;// the other array, used as the buffer when sorting the buckets
+	E *pfinal;// the output array, either of the above two
+	F getkey;
+	G sortbucket;
+	unsigned splittercount;
+	T splitters[samplesortmaxsplitters];// sorted and unique
+	std::size_t bucketends[samplesortmaxsplitters * 2u + 1u];// the end offsets of the buckets, the keys that are equal to a splitter are in the odd buckets
+
+	RSBD8_FUNC_INLINE samplesortstate(F getkeyin, G sortbucketin)noexcept : getkey{getkeyin}, sortbucket{sortbucketin}{}
+};
+
+// the work of every thread of the sample sort strategy, thread 0 also handles the offsets in between the parallel phases
+template<bool isrevorder, typename X, typename T, typename E, typename F, typename G>
+RSBD8_FUNC_NORMAL void radixsortsamplesortthread(samplesortstate<T, E, F, G> *pstate, unsigned thread)noexcept{
+	samplesortstate<T, E, F, G> &state{*pstate};
+	// wait until all threads are launched, the number of threads is only known after that
+	while(!state.isreleased.load(std::memory_order_acquire)) spinpause();
+	unsigned const threads{state.barrier.threads};
+	std::size_t const count{state.count};
+	unsigned const bucketcount{state.splittercount * 2u + 1u};
+	X *RSBD8_RESTRICT pcounts{reinterpret_cast<X *>(state.pindices + thread * state.stride)};
+	// equal slices, with the remainder distributed over the first threads, the reverse order uses the mirrored slice
+	std::size_t const quotient{count / threads}, remainder{count % threads};
+	std::size_t const first{quotient * thread + std::min(static_cast<std::size_t>(thread), remainder)};
+	std::size_t const last{first + quotient + (thread < remainder)};
+	// binary search for the bucket of a key
+	auto getbucket{[&state](T key)noexcept{
+		unsigned lo{}, hi{state.splittercount};
+		while(lo < hi){
+			unsigned const middle{(lo + hi) >> 1};
+			if(state.splitters[middle] < key) lo = middle + 1u;
+			else hi = middle;
+		}
+		return static_cast<std::size_t>(lo << 1 | static_cast<unsigned>(state.splittercount != lo && state.splitters[lo] == key));
+	}};
+
+	// count the buckets of the slice, the indices are still zeroed here
+	{
+		E const *RSBD8_RESTRICT pinput{state.input + (isrevorder? count - last : first)};
+		for(std::size_t i{last - first}; i; --i) ++pcounts[getbucket(state.getkey(*pinput++))];
+	}
+	state.barrier.arriveandwait();
+	if(!thread){// turn the counts into the offsets of every thread, the threads are visited in the order of their slices, this keeps the sort stable
+		std::size_t offset{};
+		for(unsigned bucket{}; bucketcount > bucket; ++bucket){
+			for(unsigned i{}; threads > i; ++i){
+				X &elem{reinterpret_cast<X *>(state.pindices + i * state.stride)[bucket]};
+				X const cur{elem};
+				elem = static_cast<X>(offset);
+				offset += cur;
+			}
+			state.bucketends[bucket] = offset;
+		}
+		assert(count == offset);
+	}
+	state.barrier.arriveandwait();
+	// scatter the slice into the buckets
+	{
+		E *RSBD8_RESTRICT poutput{state.pscattered};
+		if constexpr(isrevorder){
+			E const *RSBD8_RESTRICT pinput{state.input + (count - first)};
+			for(std::size_t i{last - first}; i; --i){
+				E const cur{*--pinput};
+				poutput[pcounts[getbucket(state.getkey(cur))]++] = cur;
+			}
+		}else{
+			E const *RSBD8_RESTRICT pinput{state.input + first};
+			for(std::size_t i{last - first}; i; --i){
+				E const cur{*pinput++};
+				poutput[pcounts[getbucket(state.getkey(cur))]++] = cur;
+			}
+		}
+	}
+	state.barrier.arriveandwait();
+	// sort the buckets, every thread uses two items of index counts, the counts of the scattering phase are no longer needed here
+	void *pbucketindices{state.pindices + static_cast<std::size_t>(thread) * 2u * state.stride};
+	bool const movetobuffer{state.pfinal != state.pscattered};
+	for(;;){
+		unsigned const bucket{state.nextbucket.fetch_add(1u, std::memory_order_relaxed)};
+		if(bucketcount <= bucket) break;
+		std::size_t const bucketfirst{bucket? state.bucketends[bucket - 1u] : 0u}, bucketsize{state.bucketends[bucket] - bucketfirst};
+		if(1u < bucketsize && !(bucket & 1u)){// the items were reversed already when scattering for isrevorder
+			std::memset(pbucketindices, 0, state.stride * 2u);
+			state.sortbucket(bucketsize, pbucketindices, state.pscattered + bucketfirst, state.pother + bucketfirst, movetobuffer);
+		}else if(movetobuffer) std::memcpy(state.pfinal + bucketfirst, state.pscattered + bucketfirst, bucketsize * sizeof(E));// a bucket with equal keys, or with less than two items
+	}
+}
+
+// sort with the sample sort strategy, for both the variants with and without indirection
+// the output array is the final destination, the in-place variants pass the input array as either the output array or the buffer array
+template<bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, typename E, typename F, typename G>
+RSBD8_FUNC_NORMAL void radixsortsamplesortmain(std::size_t count, unsigned threads, void *RSBD8_RESTRICT pfuturesplaceholder, void *RSBD8_RESTRICT pzeroedindices, E const *input, E *output, E *buffer, F getkey, G sortbucket)noexcept{
+	// the splitters and the buckets need to fit in the index counts of a single thread
+	static unsigned constexpr maxsplitters{static_cast<unsigned>(std::min(static_cast<std::size_t>(samplesortmaxsplitters), (offsetslength<isabsvalue, issignmode, isfltpmode, T> - 1u) >> 1))};
+	assert(1u < threads);
+	samplesortstate<T, E, F, G> state{getkey, sortbucket};
+	state.count = count;
+	state.pindices = reinterpret_cast<std::byte *>(pzeroedindices);
+	state.input = input;
+	state.pfinal = output;
+	state.pscattered = (input == buffer)? output : buffer;
+	state.pother = (input == buffer)? buffer : output;
+	// take evenly spaced samples, and use evenly spaced keys of these as the splitters
+	unsigned const buckets{std::min(threads, maxsplitters + 1u)};
+	std::size_t const samplecount{std::min(count, static_cast<std::size_t>(buckets) * samplesortoversampling)};
+	std::size_t const step{count / samplecount};
+	T samples[(samplesortmaxsplitters + 1u) * samplesortoversampling];
+	for(std::size_t i{}; samplecount > i; ++i) samples[i] = getkey(input[i * step + (step >> 1)]);
+	std::sort(samples, samples + samplecount);
+	unsigned splittercount{};
+	for(unsigned i{1u}; buckets > i; ++i){
+		T const splitter{samples[samplecount * i / buckets]};
+		if(!splittercount || state.splitters[splittercount - 1u] != splitter) state.splitters[splittercount++] = splitter;
+	}
+	state.splittercount = splittercount;
+	static std::size_t constexpr limit2way{base2waythreshold<false, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	// select the smallest unsigned type for the indices
+	// architecture: this compiles into just a few conditional move instructions on most platforms
+	auto pthread{radixsortsamplesortthread<isrevorder, std::size_t, T, E, F, G>};
+	state.stride = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>);
+	if constexpr(ULLONG_MAX >= limit2way && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= count){
+		pthread = radixsortsamplesortthread<isrevorder, unsigned long long, T, E, F, G>;
+		state.stride = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+	}
+	if constexpr(ULONG_MAX >= limit2way && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= count){
+		pthread = radixsortsamplesortthread<isrevorder, unsigned long, T, E, F, G>;
+		state.stride = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+	}
+	if constexpr(UINT_MAX >= limit2way && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= count){
+		pthread = radixsortsamplesortthread<isrevorder, unsigned, T, E, F, G>;
+		state.stride = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+	}
+	if constexpr(USHRT_MAX >= limit2way && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= count){
+		pthread = radixsortsamplesortthread<isrevorder, unsigned short, T, E, F, G>;
+		state.stride = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+	}
+	if constexpr(UCHAR_MAX >= limit2way && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= count){
+		pthread = radixsortsamplesortthread<isrevorder, unsigned char, T, E, F, G>;
+		state.stride = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+	}
+	globalhistogramlaunch<samplesortstate<T, E, F, G>>(threads, reinterpret_cast<taskfuture<void> *>(pfuturesplaceholder), state, pthread);
+}
+
+// sort with the sample sort strategy, false is returned without sorting for the types that this strategy does not handle
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	bool> radixsortsamplesort(std::size_t count, unsigned threads, void *RSBD8_RESTRICT pfuturesplaceholder, void *RSBD8_RESTRICT pzeroedindices, T const *input, T *output, T *buffer)noexcept{
+	if constexpr(!std::is_unsigned_v<T> || 64u < CHAR_BIT * sizeof(T) || isoffsetsbodysplitup<T>){
+		static_cast<void>(count);
+		static_cast<void>(threads);
+		static_cast<void>(pfuturesplaceholder);
+		static_cast<void>(pzeroedindices);
+		static_cast<void>(input);
+		static_cast<void>(output);
+		static_cast<void>(buffer);
+		return{false};
+	}else{
+		// the descending order simply inverts the filtered keys
+		auto getkey{[](T cur)noexcept{
+			T const key{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur)};
+			return static_cast<T>(isdescsort? ~key : key);
+		}};
+		auto sortbucket{[](std::size_t bucketcount, void *RSBD8_RESTRICT pbucketindices, T *RSBD8_RESTRICT pbucket, T *RSBD8_RESTRICT pbucketbuffer, bool movetobuffer)noexcept{
+			// select the smallest unsigned type for the indices
+			// architecture: this compiles into just a few conditional move instructions on most platforms
+			auto pcall{radixsortnoallocmultimain<isdescsort, false, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
+			if constexpr(ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= bucketcount) pcall = radixsortnoallocmultimain<isdescsort, false, isabsvalue, issignmode, isfltpmode, T, unsigned long long, false>;
+			if constexpr(ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= bucketcount) pcall = radixsortnoallocmultimain<isdescsort, false, isabsvalue, issignmode, isfltpmode, T, unsigned long, false>;
+			if constexpr(UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= bucketcount) pcall = radixsortnoallocmultimain<isdescsort, false, isabsvalue, issignmode, isfltpmode, T, unsigned, false>;
+			if constexpr(USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= bucketcount) pcall = radixsortnoallocmultimain<isdescsort, false, isabsvalue, issignmode, isfltpmode, T, unsigned short, false>;
+			if constexpr(UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= bucketcount) pcall = radixsortnoallocmultimain<isdescsort, false, isabsvalue, issignmode, isfltpmode, T, unsigned char, false>;
+			pcall(bucketcount, 1u, nullptr, pbucketindices, pbucket, pbucketbuffer, movetobuffer);// architecture: indirect calls only have a modest performance penalty on most platforms
+		}};
+		radixsortsamplesortmain<isrevorder, isabsvalue, issignmode, isfltpmode, T, T>(count, threads, pfuturesplaceholder, pzeroedindices, input, output, buffer, getkey, sortbucket);
+		return{true};
+	}
+}
+#endif// !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+
+#if !defined(RSBD8_THREAD_MAXIMUM) || 24 <= (RSBD8_THREAD_MAXIMUM)
+// Helper functions for more than 18-way multithreading without indirection
+
+// The fixed 8-, 12- and 18-way functions split the input into two or three parts that are sorted by a 4- or 6-way function each, and merge those afterwards.
+// These functions generalise that into a tree of splits into halves and thirds, with a 4- or 6-way function sorting every leaf part.
+// Every node of the tree merges its parts as soon as these are sorted, using the same split offsets as the fixed functions and all the threads of the leaf parts below it.
+// The index counts of every leaf part stay limited to the threads of that leaf, so the serial accumulation of these does not grow with the total thread count.
+
+// the shape of the tree, the number of leaf parts is always a product of twos and threes
+struct multiwayplan{
+	unsigned leafcount;
+	unsigned leafthreads;
+};
+
+// the number of parts that a node is split into, depending on the number of leaf parts below it
+RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr unsigned multiwaysplitways(unsigned leafcount)noexcept{
+	return{(leafcount % 3u)? 2u : 3u};
+}
+
+// the largest product of twos and threes that does not exceed the maximum
+RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr unsigned multiwayleafcount(unsigned maximum)noexcept{
+	unsigned leafcount{1u};
+	for(unsigned long long powerof3{1u}; maximum >= powerof3; powerof3 *= 3u){
+		unsigned long long product{powerof3};
+		while(maximum >= product << 1) product <<= 1;
+		if(leafcount < product) leafcount = static_cast<unsigned>(product);
+	}
+	return{leafcount};
+}
+
+// select the tree that puts the most threads to use, every leaf part has to be at least as large as the 4-way multithreading threshold
+// 6-way leaf parts are preferred when equal, as fewer leaf parts require fewer merging levels
+RSBD8_NODISCARD RSBD8_FUNC_INLINE multiwayplan getmultiwayplan(std::size_t count, unsigned allowedthreads, std::size_t runtimelimit4way)noexcept{
+	assert(runtimelimit4way);
+	std::size_t const maximumleaves{count / runtimelimit4way};
+	unsigned leafcount6{multiwayleafcount(static_cast<unsigned>(std::min(maximumleaves, static_cast<std::size_t>(allowedthreads / 6u))))};
+	unsigned leafcount4{multiwayleafcount(static_cast<unsigned>(std::min(maximumleaves, static_cast<std::size_t>(allowedthreads >> 2))))};
+	if(leafcount6 * 6u >= leafcount4 * 4u) return{leafcount6, 6u};
+	return{leafcount4, 4u};
+}
+
+// sort a range of items over a number of leaf parts, the input is sorted into the output, and the buffer is used for the intermediate results
+// the input is either the output or the buffer array for the in-place version, and this alternates the output between the two arrays for every level of splitting
+// every leaf part uses the futures placeholder and index count memory as if all the leaf threads are counted one after another
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, bool isinplace, typename F>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	void> radixsortmultiwaynode(std::size_t count, unsigned leafcount, unsigned leafthreads, F pcall, std::size_t indexsizeofleaf, taskfuture<void> *pfutures, std::byte *pindices,
+		std::conditional_t<isinplace, T, T const> *input, T *output, T *buffer)noexcept{
+	assert(output != buffer);
+	assert(isinplace? input == output || input == buffer : input != output && input != buffer);
+	assert(leafcount);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+	assert(buffer);
+
+	if(1u == leafcount){// sort a leaf part
+		taskfuture<void> asyncreturnhandle;
+		if constexpr(isinplace){
+			bool movetobuffer{input != output};// the output is then the buffer array
+			asyncreturnhandle = pcall(count, leafthreads, pfutures, pindices, input, movetobuffer? output : buffer, movetobuffer);// architecture: indirect calls only have a modest performance penalty on most platforms
+		}else asyncreturnhandle = pcall(count, leafthreads, pfutures, pindices, input, output, buffer);// architecture: indirect calls only have a modest performance penalty on most platforms
+		return;// the destructor of the handle waits for the companion thread
+	}
+
+	// the split matches the one expected by the merging functions
+	unsigned ways{multiwaysplitways(leafcount)};
+	unsigned partleaves{leafcount / ways};
+	std::size_t const offsets[4]{0u, (3u == ways)? count / 3u : count >> 1, (3u == ways)? count / 3u + (count + 1u) / 3u : count, count};
+	{
+		taskfuture<void> asynchandles[2];// the destructors of these wait for the parts above the first one
+		for(unsigned part{1u}; ways > part; ++part){
+			std::size_t offset{offsets[part]};
+			std::size_t firstleaf{static_cast<std::size_t>(part) * partleaves};
+			// sort the parts into the buffer, using the output as their buffer
+			try{
+				asynchandles[part - 1u] = launchasync(radixsortmultiwaynode<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, isinplace, F>, offsets[part + 1u] - offset, partleaves, leafthreads, pcall, indexsizeofleaf,
+					pfutures + firstleaf * leafthreads, pindices + firstleaf * indexsizeofleaf, input + offset, buffer + offset, output + offset);
+			}catch(...){// launchasync() may fail gracefully here
+				assert(false);
+				// given the absolute rarity of this case, simply process this part in the current thread
+				radixsortmultiwaynode<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, isinplace, F>(offsets[part + 1u] - offset, partleaves, leafthreads, pcall, indexsizeofleaf,
+					pfutures + firstleaf * leafthreads, pindices + firstleaf * indexsizeofleaf, input + offset, buffer + offset, output + offset);
+			}
+		}
+		// process the lower part (rounded down) here
+		radixsortmultiwaynode<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, isinplace, F>(offsets[1], partleaves, leafthreads, pcall, indexsizeofleaf,
+			pfutures, pindices, input, buffer, output);
+	}
+
+	// merging phase, with all the threads of the leaf parts below this node
+	mergepathmulti<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, ways, leafcount * leafthreads, buffer, output);
+}
+
+// sort with more than 18 threads in a tree of leaf parts, false is returned without sorting if the tree would not put more threads to use than the 18-way function
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	bool> radixsortcopynoallocmultiway(std::size_t count, unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder, void *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer)noexcept{
+	assert(input != output);
+	assert(input != buffer);
+	assert(output != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+	assert(buffer);
+
+	multiwayplan const plan{getmultiwayplan(count, allowedthreads, runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>())};
+	if(18u >= plan.leafcount * plan.leafthreads) return{false};
+	static std::size_t constexpr limit8way{base8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	static std::size_t constexpr filterlimit{(limit8way + 2u) / 3u};
+	std::size_t const leafcounttop{(count + plan.leafcount - 1u) / plan.leafcount};// no leaf part is larger than this
+	// select the smallest unsigned type for the indices, the same for all leaf parts
+	// architecture: this compiles into just a few conditional move instructions on most platforms
+	auto pcall{radixsortcopynoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t>};
+	std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>)};
+	if(6u == plan.leafthreads){
+		if constexpr(ULLONG_MAX >= filterlimit && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= leafcounttop){
+			pcall = radixsortcopynoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long long>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+		}
+		if constexpr(ULONG_MAX >= filterlimit && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= leafcounttop){
+			pcall = radixsortcopynoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+		}
+		if constexpr(UINT_MAX >= filterlimit && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= leafcounttop){
+			pcall = radixsortcopynoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+		}
+		if constexpr(USHRT_MAX >= filterlimit && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= leafcounttop){
+			pcall = radixsortcopynoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned short>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+		}
+		if constexpr(UCHAR_MAX >= filterlimit && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= leafcounttop){
+			pcall = radixsortcopynoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned char>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+		}
+	}else{// 4-way leaf parts
+		pcall = radixsortcopynoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t>;
+		if constexpr(ULLONG_MAX >= filterlimit && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= leafcounttop){
+			pcall = radixsortcopynoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long long>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+		}
+		if constexpr(ULONG_MAX >= filterlimit && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= leafcounttop){
+			pcall = radixsortcopynoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+		}
+		if constexpr(UINT_MAX >= filterlimit && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= leafcounttop){
+			pcall = radixsortcopynoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+		}
+		if constexpr(USHRT_MAX >= filterlimit && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= leafcounttop){
+			pcall = radixsortcopynoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned short>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+		}
+		if constexpr(UCHAR_MAX >= filterlimit && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= leafcounttop){
+			pcall = radixsortcopynoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned char>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+		}
+	}
+	radixsortmultiwaynode<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>(count, plan.leafcount, plan.leafthreads, pcall, indexsizeofpcall * plan.leafthreads,
+		reinterpret_cast<taskfuture<void> *>(pfuturesplaceholder), reinterpret_cast<std::byte *>(pzeroedindices), input, output, buffer);
+	return{true};
+}
+
+// sort with more than 18 threads in a tree of leaf parts, false is returned without sorting if the tree would not put more threads to use than the 18-way function
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	bool> radixsortnoallocmultiway(std::size_t count, unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder, void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, bool movetobuffer)noexcept{
+	assert(input != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(buffer);
+
+	multiwayplan const plan{getmultiwayplan(count, allowedthreads, runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>())};
+	if(18u >= plan.leafcount * plan.leafthreads) return{false};
+	static std::size_t constexpr limit8way{base8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	static std::size_t constexpr filterlimit{(limit8way + 2u) / 3u};
+	std::size_t const leafcounttop{(count + plan.leafcount - 1u) / plan.leafcount};// no leaf part is larger than this
+	// select the smallest unsigned type for the indices, the same for all leaf parts
+	// architecture: this compiles into just a few conditional move instructions on most platforms
+	auto pcall{radixsortnoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t>};
+	std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>)};
+	if(6u == plan.leafthreads){
+		if constexpr(ULLONG_MAX >= filterlimit && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= leafcounttop){
+			pcall = radixsortnoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long long>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+		}
+		if constexpr(ULONG_MAX >= filterlimit && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= leafcounttop){
+			pcall = radixsortnoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+		}
+		if constexpr(UINT_MAX >= filterlimit && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= leafcounttop){
+			pcall = radixsortnoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+		}
+		if constexpr(USHRT_MAX >= filterlimit && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= leafcounttop){
+			pcall = radixsortnoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned short>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+		}
+		if constexpr(UCHAR_MAX >= filterlimit && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= leafcounttop){
+			pcall = radixsortnoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned char>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+		}
+	}else{// 4-way leaf parts
+		pcall = radixsortnoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t>;
+		if constexpr(ULLONG_MAX >= filterlimit && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= leafcounttop){
+			pcall = radixsortnoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long long>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+		}
+		if constexpr(ULONG_MAX >= filterlimit && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= leafcounttop){
+			pcall = radixsortnoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+		}
+		if constexpr(UINT_MAX >= filterlimit && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= leafcounttop){
+			pcall = radixsortnoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+		}
+		if constexpr(USHRT_MAX >= filterlimit && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= leafcounttop){
+			pcall = radixsortnoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned short>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+		}
+		if constexpr(UCHAR_MAX >= filterlimit && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= leafcounttop){
+			pcall = radixsortnoallocmulti4thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned char>;
+			indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+		}
+	}
+	// the output is either the input or the buffer array, and the other one is used for the intermediate results
+	radixsortmultiwaynode<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>(count, plan.leafcount, plan.leafthreads, pcall, indexsizeofpcall * plan.leafthreads,
+		reinterpret_cast<taskfuture<void> *>(pfuturesplaceholder), reinterpret_cast<std::byte *>(pzeroedindices), input, movetobuffer? buffer : input, movetobuffer? input : buffer);
+	return{true};
+}
+#endif// !defined(RSBD8_THREAD_MAXIMUM) || 24 <= (RSBD8_THREAD_MAXIMUM)
+
 #if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
 // Up to 18-way multithreading functions without indirection
 
@@ -56797,16 +58624,33 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	static std::size_t constexpr limit8way{base8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit8way{runtime8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	auto pcall{radixsortcopynoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
-		if(limit4way <= count && 3u < allowedthreads){// 4-way limit
+		if(7u < allowedthreads){// the strategies without a merging phase, if selected and if the type is handled by these
+			multithreadingstrategy const strategy{activemultithreadingstrategy.load(std::memory_order_relaxed)};
+			unsigned const strategythreads{static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)))};
+			if(multithreadingstrategy::globalhistogram == strategy){
+				if(radixsortglobalhistogram<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, strategythreads, pfuturesplaceholder, pzeroedindices, input, output, buffer, false)) return;
+			}else if(multithreadingstrategy::msdthenlsd == strategy){
+				if(radixsortmsdthenlsd<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, strategythreads, pfuturesplaceholder, pzeroedindices, input, output, buffer, false)) return;
+			}else if(multithreadingstrategy::samplesort == strategy)
+				if(radixsortsamplesort<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, strategythreads, pfuturesplaceholder, pzeroedindices, input, output, buffer)) return;
+		}
+#if !defined(RSBD8_THREAD_MAXIMUM) || 24 <= (RSBD8_THREAD_MAXIMUM)
+		if(23u < allowedthreads)// more than 18-way, if the input is large enough for it
+			if(radixsortcopynoallocmultiway<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, allowedthreads, pfuturesplaceholder, pzeroedindices, input, output, buffer)) return;
+#endif
+		if(runtimelimit4way <= count && 3u < allowedthreads){// 4-way limit
 			// select the smallest unsigned type for the indices
 			// architecture: this compiles into just a few conditional move instructions on most platforms
 			std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>)};
-			if(((limit8way <= count)? 11u : 5u) < allowedthreads){// 6-, 12- or 18-way
+			if(((runtimelimit8way <= count)? 11u : 5u) < allowedthreads){// 6-, 12- or 18-way
 				pcall = radixsortcopynoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t>;
 				if constexpr(ULLONG_MAX >= limit4way && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= count){
 					pcall = radixsortcopynoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long long>;
@@ -56852,10 +58696,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				}
 			}
 			std::size_t finalcount{count};// depending on multithreading, this will be either count or one half/third of count (rounded down)
-			std::future<void> asyncreturnhandle;
+			unsigned splitways{2u};// the number of sorted parts to merge, halves or thirds
+			taskfuture<void> asyncreturnhandle;
 			{
-				autowrapfutureonfuture<true> asynchandlemid, asynchandletop;// this is to avoid having the child std::async tasks wait on the grandchild std::async tasks and instead do both here
-				if(limit8way <= count){// 8-way limit
+				autowrapfutureonfuture<true> asynchandlemid, asynchandletop;// this is to avoid having the child tasks wait on the grandchild tasks and instead do both here
+				if(runtimelimit8way <= count){// 8-way limit
 					static std::size_t constexpr filterlimit{(limit8way + 2u) / 3u};
 					if(17u < allowedthreads){// 18-way
 						std::size_t const thirdcount{count / 3u};// rounded down
@@ -56889,26 +58734,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 						unsigned allowedthreadstemp{allowedthreads / 3u};
 						assert(1u < allowedthreadstemp);// each of the three parts will use at least two threads
 						indexsizeofpcall *= allowedthreadstemp;
-						std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+						taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 						std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 						try{
 							// process the middle third (rounded in between) separately if possible
-							asynchandlemid = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, output + thirdcount)};// use the otherwise unused space
+							asynchandlemid = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, output + thirdcount)};// use the otherwise unused space
 							pcall = pcallsmaller;
 							allowedthreads = allowedthreadstemp;
 							pfuturesiter += allowedthreadstemp;// 2 unused slots per split
 							pindicesiter += indexsizeofpcall;
 							std::swap(output, buffer);// swap the buffer pointers for processing the rest
 							finalcount = thirdcount;
+							splitways = 3u;
 							try{
 								// process the top third (rounded up) separately if possible
-								asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, output + twothirdscount, buffer + twothirdscount)};// use the otherwise unused space
-							}catch(...){// std::async may fail gracefully here
+								asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, output + twothirdscount, buffer + twothirdscount)};// use the otherwise unused space
+							}catch(...){// launchasync() may fail gracefully here
 								assert(false);
 								// given the absolute rarity of this case, simply process this part in the current thread
 								pcall(thirdcounttop, allowedthreads, pfuturesplaceholder, pzeroedindices, input + twothirdscount, output + twothirdscount, buffer + twothirdscount);
 							}
-						}catch(...){// std::async may fail gracefully here
+						}catch(...){// launchasync() may fail gracefully here
 							assert(false);
 						}
 					}else if(7u < allowedthreads){// 8- or 12-way
@@ -56964,16 +58810,16 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 						unsigned allowedthreadstemp{allowedthreads >> 1};
 						assert(1u < allowedthreadstemp);// each of the two parts will use at least two threads
 						indexsizeofpcall *= allowedthreadstemp;
-						std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+						taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 						std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 						try{
 							// process the upper half (rounded up) separately if possible
-							asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, output + halfcount)};// use the otherwise unused space
+							asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, output + halfcount)};// use the otherwise unused space
 							pcall = pcallsmaller;
 							allowedthreads = allowedthreadstemp;
 							std::swap(output, buffer);// swap the buffer pointers for processing the rest
 							finalcount = halfcount;
-						}catch(...){// std::async may fail gracefully here
+						}catch(...){// launchasync() may fail gracefully here
 							assert(false);
 						}
 					}
@@ -56987,27 +58833,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// this cannot be synchronised by a simple spinlock, as the processing above will most likely involve waiting on two other threads to finish
 				// note that output and buffer were swapped in the initial phase
 				asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
-				if(17u < allowedthreads){// 18-way
-					try{
-						// process the upper half separately if possible
-						asyncreturnhandle = std::async(std::launch::async, mergethirdsmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, output, buffer);
-					}catch(...){// std::async may fail gracefully here
-						assert(false);
-						// given the absolute rarity of this case, simply process this part in the current thread
-						mergethirdsmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, output, buffer);
-					}
-					mergethirdsmain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, output, buffer);
-				}else{// 8- or 12-way
-					try{
-						// process the upper half separately if possible
-						asyncreturnhandle = std::async(std::launch::async, mergehalvesmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, output, buffer);
-					}catch(...){// std::async may fail gracefully here
-						assert(false);
-						// given the absolute rarity of this case, simply process this part in the current thread
-						mergehalvesmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, output, buffer);
-					}
-					mergehalvesmain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, output, buffer);
-				}
+				// every part was sorted with the same number of threads, so all of these are available for merging
+				mergepathmulti<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, splitways, allowedthreads * splitways, output, buffer);
 			}
 			return;
 		}else{// dual-threaded
@@ -57068,16 +58895,33 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	static std::size_t constexpr limit8way{base8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	std::size_t const runtimelimit8way{runtime8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
 	auto pcall{radixsortnoallocmultimain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t, false>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
-		if(limit4way <= count && 3u < allowedthreads){// 4-way limit
+		if(7u < allowedthreads){// the strategies without a merging phase, if selected and if the type is handled by these
+			multithreadingstrategy const strategy{activemultithreadingstrategy.load(std::memory_order_relaxed)};
+			unsigned const strategythreads{static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1)))};
+			if(multithreadingstrategy::globalhistogram == strategy){
+				if(radixsortglobalhistogram<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, strategythreads, pfuturesplaceholder, pzeroedindices, input, movetobuffer? buffer : input, movetobuffer? input : buffer, true)) return;
+			}else if(multithreadingstrategy::msdthenlsd == strategy){
+				if(radixsortmsdthenlsd<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, strategythreads, pfuturesplaceholder, pzeroedindices, input, movetobuffer? buffer : input, movetobuffer? input : buffer, true)) return;
+			}else if(multithreadingstrategy::samplesort == strategy)
+				if(radixsortsamplesort<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, strategythreads, pfuturesplaceholder, pzeroedindices, input, movetobuffer? buffer : input, movetobuffer? input : buffer)) return;
+		}
+#if !defined(RSBD8_THREAD_MAXIMUM) || 24 <= (RSBD8_THREAD_MAXIMUM)
+		if(23u < allowedthreads)// more than 18-way, if the input is large enough for it
+			if(radixsortnoallocmultiway<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, allowedthreads, pfuturesplaceholder, pzeroedindices, input, buffer, movetobuffer)) return;
+#endif
+		if(runtimelimit4way <= count && 3u < allowedthreads){// 4-way limit
 			// select the smallest unsigned type for the indices
 			// architecture: this compiles into just a few conditional move instructions on most platforms
 			std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>)};
-			if(((limit8way <= count)? 11u : 5u) < allowedthreads){// 6-, 12- or 18-way
+			if(((runtimelimit8way <= count)? 11u : 5u) < allowedthreads){// 6-, 12- or 18-way
 				pcall = radixsortnoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, std::size_t>;
 				if constexpr(ULLONG_MAX >= limit4way && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= count){
 					pcall = radixsortnoallocmulti6thread<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, unsigned long long>;
@@ -57123,10 +58967,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				}
 			}
 			std::size_t finalcount{count};// depending on multithreading, this will be either count or one half/third of count (rounded down)
-			std::future<void> asyncreturnhandle;
+			unsigned splitways{2u};// the number of sorted parts to merge, halves or thirds
+			taskfuture<void> asyncreturnhandle;
 			{
-				autowrapfutureonfuture<true> asynchandlemid, asynchandletop;// this is to avoid having the child std::async tasks wait on the grandchild std::async tasks and instead do both here
-				if(limit8way <= count){// 8-way limit
+				autowrapfutureonfuture<true> asynchandlemid, asynchandletop;// this is to avoid having the child tasks wait on the grandchild tasks and instead do both here
+				if(runtimelimit8way <= count){// 8-way limit
 					static std::size_t constexpr filterlimit{(limit8way + 2u) / 3u};
 					if(17u < allowedthreads){// 18-way
 						std::size_t const thirdcount{count / 3u};// rounded down
@@ -57160,26 +59005,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 						unsigned allowedthreadstemp{allowedthreads / 3u};
 						assert(1u < allowedthreadstemp);// each of the three parts will use at least two threads
 						indexsizeofpcall *= allowedthreadstemp;
-						std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+						taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 						std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 						try{
 							// process the middle third (rounded in between) separately if possible
-							asynchandlemid = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, !movetobuffer)};// use the otherwise unused space
+							asynchandlemid = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, !movetobuffer)};// use the otherwise unused space
 							pcall = pcallsmaller;
 							allowedthreads = allowedthreadstemp;
 							pfuturesiter += allowedthreadstemp;// 2 unused slots per split
 							pindicesiter += indexsizeofpcall;
 							movetobuffer = !movetobuffer;// swap the buffer pointers for processing the rest
 							finalcount = thirdcount;
+							splitways = 3u;
 							try{
 								// process the top third (rounded up) separately if possible
-								asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, buffer + twothirdscount, movetobuffer)};// use the otherwise unused space
-							}catch(...){// std::async may fail gracefully here
+								asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, buffer + twothirdscount, movetobuffer)};// use the otherwise unused space
+							}catch(...){// launchasync() may fail gracefully here
 								assert(false);
 								// given the absolute rarity of this case, simply process this part in the current thread
 								pcall(thirdcounttop, allowedthreads, pfuturesplaceholder, pzeroedindices, input + twothirdscount, buffer + twothirdscount, movetobuffer);
 							}
-						}catch(...){// std::async may fail gracefully here
+						}catch(...){// launchasync() may fail gracefully here
 							assert(false);
 						}
 					}else if(7u < allowedthreads){// 8- or 12-way
@@ -57235,16 +59081,16 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 						unsigned allowedthreadstemp{allowedthreads >> 1};
 						assert(1u < allowedthreadstemp);// each of the two parts will use at least two threads
 						indexsizeofpcall *= allowedthreadstemp;
-						std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+						taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 						std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 						try{
 							// process the upper half (rounded up) separately if possible
-							asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, !movetobuffer)};// use the otherwise unused space
+							asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, !movetobuffer)};// use the otherwise unused space
 							pcall = pcallsmaller;
 							allowedthreads = allowedthreadstemp;
 							movetobuffer = !movetobuffer;// swap the buffer pointers for processing the rest
 							finalcount = halfcount;
-						}catch(...){// std::async may fail gracefully here
+						}catch(...){// launchasync() may fail gracefully here
 							assert(false);
 						}
 					}
@@ -57263,27 +59109,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 					buffer = tmp;
 				}
 				asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
-				if(17u < allowedthreads){// 18-way
-					try{
-						// process the upper half separately if possible
-						asyncreturnhandle = std::async(std::launch::async, mergethirdsmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, input, buffer);
-					}catch(...){// std::async may fail gracefully here
-						assert(false);
-						// given the absolute rarity of this case, simply process this part in the current thread
-						mergethirdsmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, input, buffer);
-					}
-					mergethirdsmain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, input, buffer);
-				}else{// 8- or 12-way
-					try{
-						// process the upper half separately if possible
-						asyncreturnhandle = std::async(std::launch::async, mergehalvesmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>, count, input, buffer);
-					}catch(...){// std::async may fail gracefully here
-						assert(false);
-						// given the absolute rarity of this case, simply process this part in the current thread
-						mergehalvesmtc<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, input, buffer);
-					}
-					mergehalvesmain<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, input, buffer);
-				}
+				// every part was sorted with the same number of threads, so all of these are available for merging
+				mergepathmulti<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, splitways, allowedthreads * splitways, input, buffer);
 			}
 			return;
 		}else{// dual-threaded
@@ -57329,6 +59156,87 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 }
 #endif// !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
 
+#if !defined(RSBD8_THREAD_MAXIMUM) || 4 <= (RSBD8_THREAD_MAXIMUM)
+// Helper functions for NUMA-aware sorting across nodes without indirection
+
+// the number of nodes that are actually used, as the merge-path functions handle up to one run per node
+RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr unsigned numausednodes(unsigned nodecount)noexcept{
+	return{(mergepathwaysmaximum < nodecount)? mergepathwaysmaximum : nodecount};
+}
+
+// run a number of tasks on newly spawned threads and wait for all of them to finish
+// the function is called with the task number and whether it runs on a newly spawned thread, as only those can be bound to a node
+template<typename F>
+RSBD8_FUNC_NORMAL void numarunparts(unsigned taskcount, F const &function)noexcept{
+	assert(numatopology::nodemaximum >= taskcount);
+	std::thread threads[numatopology::nodemaximum];
+	for(unsigned i{}; taskcount > i; ++i){
+		try{
+			threads[i] = std::thread{function, i, true};
+		}catch(...){// std::thread may fail gracefully here
+			assert(false);
+			// given the absolute rarity of this case, simply process this part in the current thread
+			function(i, false);
+		}
+	}
+	for(std::thread &elem : threads) if(elem.joinable()) elem.join();
+}
+
+// bind the current thread to a node, and let any tasks that it launches inherit the binding
+RSBD8_FUNC_INLINE void numabindthread(numatopology const &topology, unsigned node)noexcept{
+	if(topology.bindthread(node)) isnodeboundthread = true;// without binding, the thread simply runs wherever the operating system schedules it
+}
+
+// sort the items over a number of nodes, the input is sorted into the output, and the buffer is used for the intermediate results
+// the input and output are the same array for the in-place version
+// every node first sorts its own part of the input into the buffer, and then merges its own part of the output from the sorted parts of all nodes with the merge-path functions
+// both phases use all processors of every node, the tasks launched by the thread of a node inherit its binding
+// the memory that is written to first by the threads of a node will be allocated on that node by most operating systems, which places most of the buffer memory node-locally
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, bool isinplace>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	void> numasortnodes(numatopology const &topology, unsigned nodecount, std::size_t count,
+		std::conditional_t<isinplace, T, T const> *input, T *output, T *buffer, void *const *pfuturesplaceholders, void *const *pzeroedindices, bool ismovingpages)noexcept{
+	assert(output != buffer);
+	assert(isinplace? input == output : input != output && input != buffer);
+	assert(2u <= nodecount && mergepathwaysmaximum >= nodecount);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+	assert(buffer);
+
+	// equal parts, with the remainder distributed over the first parts
+	std::size_t offsets[mergepathwaysmaximum + 1u];
+	std::size_t const quotient{count / nodecount}, remainder{count % nodecount};
+	for(unsigned node{}; nodecount >= node; ++node) offsets[node] = quotient * node + std::min(static_cast<std::size_t>(node), remainder);
+
+	// sorting phase, every node sorts its part into the buffer, using the output as its buffer for the copy version
+	numarunparts(nodecount, [&topology, &offsets, input, output, buffer, pfuturesplaceholders, pzeroedindices, ismovingpages](unsigned node, bool isspawnedpart)noexcept{
+		if(isspawnedpart) numabindthread(topology, node);
+		std::size_t const offset{offsets[node]}, partcount{offsets[node + 1u] - offset};
+		if(ismovingpages) static_cast<void>(topology.movepages(input + offset, partcount * sizeof(T), node));
+		if constexpr(isinplace){
+			radixsortnoallocmulti<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(partcount, topology.cpucount(node), pfuturesplaceholders[node], pzeroedindices[node], input + offset, buffer + offset, true);
+		}else radixsortcopynoallocmulti<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(partcount, topology.cpucount(node), pfuturesplaceholders[node], pzeroedindices[node], input + offset, buffer + offset, output + offset);
+	});
+
+	// merging phase, every node merges its part of the output, which starts with the same offset as its sorted part
+	auto getkey{mergepathgetkey<isabsvalue, issignmode, isfltpmode, T>(buffer)};
+	numarunparts(nodecount, [&topology, nodecount, &offsets, output, buffer, getkey](unsigned node, bool isspawnedpart)noexcept{
+		if(isspawnedpart) numabindthread(topology, node);
+		std::size_t const offset{offsets[node]}, partcount{offsets[node + 1u] - offset};
+		// do not split into parts of just a few items
+		unsigned parts{topology.cpucount(node)};
+		if(partcount < static_cast<std::size_t>(parts) * 1024u) parts = static_cast<unsigned>(partcount >> 10 | 1u);
+		mergepathrange<isdescsort, isrevorder, T, decltype(getkey)>(offset, partcount, nodecount, offsets, 0u, parts, parts, buffer, output, getkey);
+	});
+}
+#endif// !defined(RSBD8_THREAD_MAXIMUM) || 4 <= (RSBD8_THREAD_MAXIMUM)
+
 #if !defined(RSBD8_THREAD_MAXIMUM) || 4 <= (RSBD8_THREAD_MAXIMUM)
 // Helper functions for merging the halves from multithreading inputs with indirection
 
@@ -57752,7 +59660,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	128u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
 	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
 #if !defined(RSBD8_THREAD_MAXIMUM) || 6 <= (RSBD8_THREAD_MAXIMUM)
-	std::future<void>
+	taskfuture<void>
 #else
 	void
 #endif
@@ -57774,12 +59682,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 6 <= (RSBD8_THREAD_MAXIMUM)// pre-computed index size (X)
 	auto pcall{radixsortcopynoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, true, vararguments...>};
 	std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
 #else
 	auto pcall{radixsortcopynoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -57809,11 +59719,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		}
 #endif
 		std::size_t finalcount{count};// depending on multithreading, this will be either count or one half of count (rounded down)
-		std::future<void> asyncreturnhandle;
+		taskfuture<void> asyncreturnhandle;
 		{
 			autowrapfutureonfuture<std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>> asynchandle;// this is to avoid having the child std::async task wait on the grandchild std::async task and instead do both here
 #if defined(RSBD8_THREAD_MAXIMUM) && 6 > (RSBD8_THREAD_MAXIMUM)
-			if(limit4way <= count && 3u < allowedthreads){// 4-way limit
+			if(runtimelimit4way <= count && 3u < allowedthreads){// 4-way limit
 #endif
 				std::size_t const halfcounttop{(count + 1u) >> 1};// rounded up
 				std::size_t const halfcount{count >> 1};// rounded down
@@ -57845,16 +59755,16 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				unsigned allowedthreadstemp{allowedthreads >> 1};
 				assert(1u < allowedthreadstemp);// each of the two parts will use at least two threads
 				indexsizeofpcall *= allowedthreadstemp;
-				std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+				taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 				std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 				try{
 					// process the upper half (rounded up) separately if possible
-					asynchandle = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, output + halfcount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+					asynchandle = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, output + halfcount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
 					pcall = pcallsmaller;
 					allowedthreads = allowedthreadstemp;
 					std::swap(output, buffer);// swap the buffer pointers for processing the rest
 					finalcount = halfcount;
-				}catch(...){// std::async may fail gracefully here
+				}catch(...){// launchasync() may fail gracefully here
 					assert(false);
 				}
 #if defined(RSBD8_THREAD_MAXIMUM) && 6 > (RSBD8_THREAD_MAXIMUM)
@@ -57871,8 +59781,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 			asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
 			try{
 				// process the upper half separately if possible
-				asyncreturnhandle = std::async(std::launch::async, mergehalvesmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
-			}catch(...){// std::async may fail gracefully here
+				asyncreturnhandle = launchasync(mergehalvesmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 				// given the absolute rarity of this case, simply process this part in the current thread
 				mergehalvesmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
@@ -57916,7 +59826,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	128u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
 	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
 #if !defined(RSBD8_THREAD_MAXIMUM) || 6 <= (RSBD8_THREAD_MAXIMUM)
-	std::future<void>
+	taskfuture<void>
 #else
 	void
 #endif
@@ -57935,12 +59845,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 6 <= (RSBD8_THREAD_MAXIMUM)// pre-computed index size (X)
 	auto pcall{radixsortnoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, true, vararguments...>};
 	std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
 #else
 	auto pcall{radixsortnoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -57970,11 +59882,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		}
 #endif
 		std::size_t finalcount{count};// depending on multithreading, this will be either count or one half of count (rounded down)
-		std::future<void> asyncreturnhandle;
+		taskfuture<void> asyncreturnhandle;
 		{
 			autowrapfutureonfuture<std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>> asynchandle;// this is to avoid having the child std::async task wait on the grandchild std::async task and instead do both here
 #if defined(RSBD8_THREAD_MAXIMUM) && 6 > (RSBD8_THREAD_MAXIMUM)
-			if(limit4way <= count && 3u < allowedthreads){// 4-way limit
+			if(runtimelimit4way <= count && 3u < allowedthreads){// 4-way limit
 #endif
 				std::size_t const halfcounttop{(count + 1u) >> 1};// rounded up
 				std::size_t const halfcount{count >> 1};// rounded down
@@ -58006,16 +59918,16 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				unsigned allowedthreadstemp{allowedthreads >> 1};
 				assert(1u < allowedthreadstemp);// each of the two parts will use at least two threads
 				indexsizeofpcall *= allowedthreadstemp;
-				std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+				taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 				std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 				try{
 					// process the upper half (rounded up) separately if possible
-					asynchandle = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, !movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+					asynchandle = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, !movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
 					pcall = pcallsmaller;
 					allowedthreads = allowedthreadstemp;
 					movetobuffer = !movetobuffer;// swap the buffer pointers for processing the rest
 					finalcount = halfcount;
-				}catch(...){// std::async may fail gracefully here
+				}catch(...){// launchasync() may fail gracefully here
 					assert(false);
 				}
 #if defined(RSBD8_THREAD_MAXIMUM) && 6 > (RSBD8_THREAD_MAXIMUM)
@@ -58037,8 +59949,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 			asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
 			try{
 				// process the upper half separately if possible
-				asyncreturnhandle = std::async(std::launch::async, mergehalvesmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, input, buffer, std::forward<vararguments>(varparameters)...);
-			}catch(...){// std::async may fail gracefully here
+				asyncreturnhandle = launchasync(mergehalvesmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, input, buffer, std::forward<vararguments>(varparameters)...);
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 				// given the absolute rarity of this case, simply process this part in the current thread
 				mergehalvesmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, input, buffer, std::forward<vararguments>(varparameters)...);
@@ -58874,7 +60786,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	128u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
 	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
 #if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
-	std::future<void>
+	taskfuture<void>
 #else
 	void
 #endif
@@ -58896,12 +60808,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)// pre-computed index size (X)
 	auto pcall{radixsortcopynoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, true, vararguments...>};
 	std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
 #else
 	auto pcall{radixsortcopynoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -58931,11 +60845,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		}
 #endif
 		std::size_t finalcount{count};// depending on multithreading, this will be either count or one third of count (rounded down)
-		std::future<void> asyncreturnhandle;
+		taskfuture<void> asyncreturnhandle;
 		{
-			autowrapfutureonfuture<std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>> asynchandlemid, asynchandletop;// this is to avoid having the child std::async tasks wait on the grandchild std::async tasks and instead do both here
+			autowrapfutureonfuture<std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>> asynchandlemid, asynchandletop;// this is to avoid having the child tasks wait on the grandchild tasks and instead do both here
 #if defined(RSBD8_THREAD_MAXIMUM) && 8 > (RSBD8_THREAD_MAXIMUM)
-			if(limit4way <= count && 5u < allowedthreads){// 6-way limit
+			if(runtimelimit4way <= count && 5u < allowedthreads){// 6-way limit
 #endif
 				std::size_t const thirdcount{count / 3u};// rounded down
 				std::size_t const thirdcountmid{(count + 1u) / 3u};
@@ -58969,11 +60883,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				unsigned allowedthreadstemp{allowedthreads / 3u};
 				assert(1u < allowedthreadstemp);// each of the three parts will use at least two threads
 				indexsizeofpcall *= allowedthreadstemp;
-				std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+				taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 				std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 				try{
 					// process the middle third (rounded in between) separately if possible
-					asynchandlemid = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, output + thirdcount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+					asynchandlemid = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, output + thirdcount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
 					pcall = pcallsmaller;
 					allowedthreads = allowedthreadstemp;
 					pfuturesiter += allowedthreadstemp;// 2 unused slots per split
@@ -58982,13 +60896,13 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 					finalcount = thirdcount;
 					try{
 						// process the top third (rounded up) separately if possible
-						asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, output + twothirdscount, buffer + twothirdscount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
-					}catch(...){// std::async may fail gracefully here
+						asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, output + twothirdscount, buffer + twothirdscount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+					}catch(...){// launchasync() may fail gracefully here
 						assert(false);
 						// given the absolute rarity of this case, simply process this part in the current thread
 						pcall(thirdcounttop, allowedthreads, pfuturesplaceholder, pzeroedindices, input + twothirdscount, output + twothirdscount, buffer + twothirdscount, std::forward<vararguments>(varparameters)...);
 					}
-				}catch(...){// std::async may fail gracefully here
+				}catch(...){// launchasync() may fail gracefully here
 					assert(false);
 				}
 #if defined(RSBD8_THREAD_MAXIMUM) && 8 > (RSBD8_THREAD_MAXIMUM)
@@ -59005,8 +60919,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 			asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
 			try{
 				// process the upper half separately if possible
-				asyncreturnhandle = std::async(std::launch::async, mergethirdsmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
-			}catch(...){// std::async may fail gracefully here
+				asyncreturnhandle = launchasync(mergethirdsmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 				// given the absolute rarity of this case, simply process this part in the current thread
 				mergethirdsmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
@@ -59050,7 +60964,7 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	128u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
 	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
 #if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
-	std::future<void>
+	taskfuture<void>
 #else
 	void
 #endif
@@ -59069,12 +60983,14 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)// pre-computed index size (X)
 	auto pcall{radixsortnoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, X, true, vararguments...>};
 	std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, X>)};
 #else
 	auto pcall{radixsortnoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
@@ -59104,11 +61020,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 		}
 #endif
 		std::size_t finalcount{count};// depending on multithreading, this will be either count or one third of count (rounded down)
-		std::future<void> asyncreturnhandle;
+		taskfuture<void> asyncreturnhandle;
 		{
-			autowrapfutureonfuture<std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>> asynchandlemid, asynchandletop;// this is to avoid having the child std::async tasks wait on the grandchild std::async tasks and instead do both here
+			autowrapfutureonfuture<std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>> asynchandlemid, asynchandletop;// this is to avoid having the child tasks wait on the grandchild tasks and instead do both here
 #if defined(RSBD8_THREAD_MAXIMUM) && 8 > (RSBD8_THREAD_MAXIMUM)
-			if(limit4way <= count && 5u < allowedthreads){// 6-way limit
+			if(runtimelimit4way <= count && 5u < allowedthreads){// 6-way limit
 #endif
 				std::size_t const thirdcount{count / 3u};// rounded down
 				std::size_t const thirdcountmid{(count + 1u) / 3u};
@@ -59142,11 +61058,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				unsigned allowedthreadstemp{allowedthreads / 3u};
 				assert(1u < allowedthreadstemp);// each of the three parts will use at least two threads
 				indexsizeofpcall *= allowedthreadstemp;
-				std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+				taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 				std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 				try{
 					// process the middle third (rounded in between) separately if possible
-					asynchandlemid = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, !movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+					asynchandlemid = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, !movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
 					pcall = pcallsmaller;
 					allowedthreads = allowedthreadstemp;
 					pfuturesiter += allowedthreadstemp;// 2 unused slots per split
@@ -59155,13 +61071,13 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 					finalcount = thirdcount;
 					try{
 						// process the top third (rounded up) separately if possible
-						asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, buffer + twothirdscount, movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
-					}catch(...){// std::async may fail gracefully here
+						asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, buffer + twothirdscount, movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+					}catch(...){// launchasync() may fail gracefully here
 						assert(false);
 						// given the absolute rarity of this case, simply process this part in the current thread
 						pcall(thirdcounttop, allowedthreads, pfuturesplaceholder, pzeroedindices, input + twothirdscount, buffer + twothirdscount, movetobuffer, std::forward<vararguments>(varparameters)...);
 					}
-				}catch(...){// std::async may fail gracefully here
+				}catch(...){// launchasync() may fail gracefully here
 					assert(false);
 				}
 #if defined(RSBD8_THREAD_MAXIMUM) && 8 > (RSBD8_THREAD_MAXIMUM)
@@ -59183,8 +61099,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 			asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
 			try{
 				// process the upper half separately if possible
-				asyncreturnhandle = std::async(std::launch::async, mergethirdsmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, input, buffer, std::forward<vararguments>(varparameters)...);
-			}catch(...){// std::async may fail gracefully here
+				asyncreturnhandle = launchasync(mergethirdsmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, input, buffer, std::forward<vararguments>(varparameters)...);
+			}catch(...){// launchasync() may fail gracefully here
 				assert(false);
 				// given the absolute rarity of this case, simply process this part in the current thread
 				mergethirdsmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, input, buffer, std::forward<vararguments>(varparameters)...);
@@ -59219,6 +61135,313 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 }
 #endif// !defined(RSBD8_THREAD_MAXIMUM) || 6 <= (RSBD8_THREAD_MAXIMUM)
 
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+// Helper functions for merge-path merging from multithreading inputs with indirection
+
+// merge two or three sorted runs with the given number of threads, this uses the same merge-path functions as the variants without indirection
+template<auto indirection1, bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, std::ptrdiff_t indirection2, bool isindexed2, typename V, typename... vararguments>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
+	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
+	void> mergepathmulti(std::size_t count, unsigned ways, unsigned allowedthreads, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
+	using W = typename std::conditional_t<std::is_class_v<T> || std::is_union_v<T> || isabsvalue || !issignmode || isfltpmode, std::enable_if<true, T>, std::make_signed<T>>::type;// for simple signed comparisons, use signed W
+	assert(input != output);
+	assert(allowedthreads);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	auto getkey{[input, &varparameters...](std::size_t index)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+		auto im{indirectinput1<indirection1, isindexed2, false, W, V>(input[index], std::forward<vararguments>(varparameters)...)};
+		auto cur{indirectinput2<indirection1, indirection2, isindexed2, false, W>(im, std::forward<vararguments>(varparameters)...)};
+		return convertinput<isabsvalue, issignmode, isfltpmode, W>(cur);// convert the value for integer comparison
+	}};
+	// do not split into parts of just a few items
+	unsigned parts{allowedthreads};
+	if(count < static_cast<std::size_t>(parts) * 1024u) parts = static_cast<unsigned>(count >> 10 | 1u);
+	std::size_t runoffsets[4];
+	mergepathruns(count, ways, runoffsets);
+	mergepathrange<isdescsort, isrevorder, V *, decltype(getkey)>(0u, count, ways, runoffsets, 0u, parts, parts, input, output, getkey);
+}
+#endif// !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+// Helper functions for the sample sort multithreading strategy with indirection
+
+// sort with the sample sort strategy, false is returned without sorting for the types that this strategy does not handle
+// the threads of this strategy cannot pass on exceptions, so getter functions that are not marked noexcept are not handled here either
+template<auto indirection1, bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, std::ptrdiff_t indirection2, bool isindexed2, typename V, typename... vararguments>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
+	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
+	bool> radixsortsamplesort(std::size_t count, unsigned threads, void *RSBD8_RESTRICT pfuturesplaceholder, void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *input, V *RSBD8_RESTRICT *output, V *RSBD8_RESTRICT *buffer, vararguments&&... varparameters)noexcept{
+	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
+	if constexpr(!std::is_unsigned_v<T> || 64u < CHAR_BIT * sizeof(T) || isoffsetsbodysplitup<T> ||
+		!std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+		static_cast<void>(count);
+		static_cast<void>(threads);
+		static_cast<void>(pfuturesplaceholder);
+		static_cast<void>(pzeroedindices);
+		static_cast<void>(input);
+		static_cast<void>(output);
+		static_cast<void>(buffer);
+		(static_cast<void>(varparameters), ...);
+		return{false};
+	}else{
+		// the descending order simply inverts the filtered keys
+		auto getkey{[&varparameters...](V *RSBD8_RESTRICT cur)noexcept{
+			auto im{indirectinput1<indirection1, isindexed2, false, T, V>(cur, std::forward<vararguments>(varparameters)...)};
+			T const key{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(indirectinput2<indirection1, indirection2, isindexed2, false, T>(im, std::forward<vararguments>(varparameters)...))};
+			return static_cast<T>(isdescsort? ~key : key);
+		}};
+		auto sortbucket{[&varparameters...](std::size_t bucketcount, void *RSBD8_RESTRICT pbucketindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT pbucket, V *RSBD8_RESTRICT *RSBD8_RESTRICT pbucketbuffer, bool movetobuffer)noexcept{
+			// select the smallest unsigned type for the indices
+			// architecture: this compiles into just a few conditional move instructions on most platforms
+			auto pcall{radixsortnoallocmultimain<indirection1, isdescsort, false, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
+			if constexpr(ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= bucketcount) pcall = radixsortnoallocmultimain<indirection1, isdescsort, false, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long long, false, vararguments...>;
+			if constexpr(ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= bucketcount) pcall = radixsortnoallocmultimain<indirection1, isdescsort, false, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long, false, vararguments...>;
+			if constexpr(UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= bucketcount) pcall = radixsortnoallocmultimain<indirection1, isdescsort, false, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned, false, vararguments...>;
+			if constexpr(USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= bucketcount) pcall = radixsortnoallocmultimain<indirection1, isdescsort, false, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned short, false, vararguments...>;
+			if constexpr(UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= bucketcount) pcall = radixsortnoallocmultimain<indirection1, isdescsort, false, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned char, false, vararguments...>;
+			pcall(bucketcount, 1u, nullptr, pbucketindices, pbucket, pbucketbuffer, movetobuffer, std::forward<vararguments>(varparameters)...);// architecture: indirect calls only have a modest performance penalty on most platforms
+		}};
+		radixsortsamplesortmain<isrevorder, isabsvalue, issignmode, isfltpmode, T, V *RSBD8_RESTRICT>(count, threads, pfuturesplaceholder, pzeroedindices, input, output, buffer, getkey, sortbucket);
+		return{true};
+	}
+}
+#endif// !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+
+#if !defined(RSBD8_THREAD_MAXIMUM) || 24 <= (RSBD8_THREAD_MAXIMUM)
+// Helper functions for more than 18-way multithreading with indirection
+
+// These use the same tree of leaf parts as the variants without indirection, with the merge-path functions with indirection for every node.
+// The tree is only used if retrieving the keys cannot throw, as the tasks of the tree cannot pass on exceptions.
+
+// sort a range of items over a number of leaf parts, the input is sorted into the output, and the buffer is used for the intermediate results
+// the input is either the output or the buffer array for the in-place version, and this alternates the output between the two arrays for every level of splitting
+// every leaf part uses the futures placeholder and index count memory as if all the leaf threads are counted one after another
+template<auto indirection1, bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, std::ptrdiff_t indirection2, bool isindexed2, typename V, bool isinplace, typename F, typename... vararguments>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
+	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
+	void> radixsortmultiwaynode(std::size_t count, unsigned leafcount, unsigned leafthreads, F pcall, std::size_t indexsizeofleaf, taskfuture<void> *pfutures, std::byte *pindices,
+		std::conditional_t<isinplace, V *RSBD8_RESTRICT, V *const RSBD8_RESTRICT> *input, V *RSBD8_RESTRICT *output, V *RSBD8_RESTRICT *buffer, vararguments&&... varparameters)noexcept{
+	assert(output != buffer);
+	assert(isinplace? input == output || input == buffer : input != output && input != buffer);
+	assert(leafcount);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+	assert(buffer);
+
+	if(1u == leafcount){// sort a leaf part
+		taskfuture<void> asyncreturnhandle;
+		if constexpr(isinplace){
+			bool movetobuffer{input != output};// the output is then the buffer array
+			asyncreturnhandle = pcall(count, leafthreads, pfutures, pindices, input, movetobuffer? output : buffer, movetobuffer, std::forward<vararguments>(varparameters)...);// architecture: indirect calls only have a modest performance penalty on most platforms
+		}else asyncreturnhandle = pcall(count, leafthreads, pfutures, pindices, input, output, buffer, std::forward<vararguments>(varparameters)...);// architecture: indirect calls only have a modest performance penalty on most platforms
+		return;// the destructor of the handle waits for the companion thread
+	}
+
+	// the split matches the one expected by the merging functions
+	unsigned ways{multiwaysplitways(leafcount)};
+	unsigned partleaves{leafcount / ways};
+	std::size_t const offsets[4]{0u, (3u == ways)? count / 3u : count >> 1, (3u == ways)? count / 3u + (count + 1u) / 3u : count, count};
+	{
+		taskfuture<void> asynchandles[2];// the destructors of these wait for the parts above the first one
+		for(unsigned part{1u}; ways > part; ++part){
+			std::size_t offset{offsets[part]};
+			std::size_t firstleaf{static_cast<std::size_t>(part) * partleaves};
+			// sort the parts into the buffer, using the output as their buffer
+			try{
+				asynchandles[part - 1u] = launchasync(radixsortmultiwaynode<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, isinplace, F, vararguments...>, offsets[part + 1u] - offset, partleaves, leafthreads, pcall, indexsizeofleaf,
+					pfutures + firstleaf * leafthreads, pindices + firstleaf * indexsizeofleaf, input + offset, buffer + offset, output + offset, std::forward<vararguments>(varparameters)...);
+			}catch(...){// launchasync() may fail gracefully here
+				assert(false);
+				// given the absolute rarity of this case, simply process this part in the current thread
+				radixsortmultiwaynode<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, isinplace, F, vararguments...>(offsets[part + 1u] - offset, partleaves, leafthreads, pcall, indexsizeofleaf,
+					pfutures + firstleaf * leafthreads, pindices + firstleaf * indexsizeofleaf, input + offset, buffer + offset, output + offset, std::forward<vararguments>(varparameters)...);
+			}
+		}
+		// process the lower part (rounded down) here
+		radixsortmultiwaynode<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, isinplace, F, vararguments...>(offsets[1], partleaves, leafthreads, pcall, indexsizeofleaf,
+			pfutures, pindices, input, buffer, output, std::forward<vararguments>(varparameters)...);
+	}
+
+	// merging phase, with all the threads of the leaf parts below this node
+	mergepathmulti<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, ways, leafcount * leafthreads, buffer, output, std::forward<vararguments>(varparameters)...);
+}
+
+// sort with more than 18 threads in a tree of leaf parts, false is returned without sorting if the tree would not put more threads to use than the 18-way function
+template<auto indirection1, bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, std::ptrdiff_t indirection2, bool isindexed2, typename V, typename... vararguments>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
+	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
+	bool> radixsortcopynoallocmultiway(std::size_t count, unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder, void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
+	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
+	assert(input != output);
+	assert(input != buffer);
+	assert(output != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+	assert(buffer);
+
+	if constexpr(!std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+		static_cast<void>(count);
+		static_cast<void>(allowedthreads);
+		static_cast<void>(pfuturesplaceholder);
+		static_cast<void>(pzeroedindices);
+		(static_cast<void>(varparameters), ...);
+		return{false};
+	}else{
+		multiwayplan const plan{getmultiwayplan(count, allowedthreads, runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>())};
+		if(18u >= plan.leafcount * plan.leafthreads) return{false};
+		static std::size_t constexpr limit8way{base8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+		static std::size_t constexpr filterlimit{(limit8way + 2u) / 3u};
+		std::size_t const leafcounttop{(count + plan.leafcount - 1u) / plan.leafcount};// no leaf part is larger than this
+		// select the smallest unsigned type for the indices, the same for all leaf parts
+		// architecture: this compiles into just a few conditional move instructions on most platforms
+		auto pcall{radixsortcopynoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, vararguments...>};
+		std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>)};
+		if(6u == plan.leafthreads){
+			if constexpr(ULLONG_MAX >= filterlimit && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= leafcounttop){
+				pcall = radixsortcopynoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long long, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+			}
+			if constexpr(ULONG_MAX >= filterlimit && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= leafcounttop){
+				pcall = radixsortcopynoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+			}
+			if constexpr(UINT_MAX >= filterlimit && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= leafcounttop){
+				pcall = radixsortcopynoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+			}
+			if constexpr(USHRT_MAX >= filterlimit && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= leafcounttop){
+				pcall = radixsortcopynoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned short, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+			}
+			if constexpr(UCHAR_MAX >= filterlimit && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= leafcounttop){
+				pcall = radixsortcopynoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned char, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+			}
+		}else{// 4-way leaf parts
+			pcall = radixsortcopynoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, vararguments...>;
+			if constexpr(ULLONG_MAX >= filterlimit && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= leafcounttop){
+				pcall = radixsortcopynoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long long, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+			}
+			if constexpr(ULONG_MAX >= filterlimit && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= leafcounttop){
+				pcall = radixsortcopynoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+			}
+			if constexpr(UINT_MAX >= filterlimit && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= leafcounttop){
+				pcall = radixsortcopynoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+			}
+			if constexpr(USHRT_MAX >= filterlimit && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= leafcounttop){
+				pcall = radixsortcopynoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned short, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+			}
+			if constexpr(UCHAR_MAX >= filterlimit && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= leafcounttop){
+				pcall = radixsortcopynoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned char, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+			}
+		}
+		radixsortmultiwaynode<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, false, decltype(pcall), vararguments...>(count, plan.leafcount, plan.leafthreads, pcall, indexsizeofpcall * plan.leafthreads,
+			reinterpret_cast<taskfuture<void> *>(pfuturesplaceholder), reinterpret_cast<std::byte *>(pzeroedindices), input, output, buffer, std::forward<vararguments>(varparameters)...);
+		return{true};
+	}
+}
+
+// sort with more than 18 threads in a tree of leaf parts, false is returned without sorting if the tree would not put more threads to use than the 18-way function
+template<auto indirection1, bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, std::ptrdiff_t indirection2, bool isindexed2, typename V, typename... vararguments>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>) &&
+	8u < CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
+	bool> radixsortnoallocmultiway(std::size_t count, unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder, void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer, vararguments&&... varparameters)noexcept{
+	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
+	assert(input != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(buffer);
+
+	if constexpr(!std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+		static_cast<void>(count);
+		static_cast<void>(allowedthreads);
+		static_cast<void>(pfuturesplaceholder);
+		static_cast<void>(pzeroedindices);
+		static_cast<void>(movetobuffer);
+		(static_cast<void>(varparameters), ...);
+		return{false};
+	}else{
+		multiwayplan const plan{getmultiwayplan(count, allowedthreads, runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>())};
+		if(18u >= plan.leafcount * plan.leafthreads) return{false};
+		static std::size_t constexpr limit8way{base8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+		static std::size_t constexpr filterlimit{(limit8way + 2u) / 3u};
+		std::size_t const leafcounttop{(count + plan.leafcount - 1u) / plan.leafcount};// no leaf part is larger than this
+		// select the smallest unsigned type for the indices, the same for all leaf parts
+		// architecture: this compiles into just a few conditional move instructions on most platforms
+		auto pcall{radixsortnoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, vararguments...>};
+		std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>)};
+		if(6u == plan.leafthreads){
+			if constexpr(ULLONG_MAX >= filterlimit && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= leafcounttop){
+				pcall = radixsortnoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long long, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+			}
+			if constexpr(ULONG_MAX >= filterlimit && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= leafcounttop){
+				pcall = radixsortnoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+			}
+			if constexpr(UINT_MAX >= filterlimit && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= leafcounttop){
+				pcall = radixsortnoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+			}
+			if constexpr(USHRT_MAX >= filterlimit && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= leafcounttop){
+				pcall = radixsortnoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned short, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+			}
+			if constexpr(UCHAR_MAX >= filterlimit && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= leafcounttop){
+				pcall = radixsortnoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned char, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+			}
+		}else{// 4-way leaf parts
+			pcall = radixsortnoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, vararguments...>;
+			if constexpr(ULLONG_MAX >= filterlimit && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= leafcounttop){
+				pcall = radixsortnoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long long, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+			}
+			if constexpr(ULONG_MAX >= filterlimit && ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= leafcounttop){
+				pcall = radixsortnoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+			}
+			if constexpr(UINT_MAX >= filterlimit && UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= leafcounttop){
+				pcall = radixsortnoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+			}
+			if constexpr(USHRT_MAX >= filterlimit && USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= leafcounttop){
+				pcall = radixsortnoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned short, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+			}
+			if constexpr(UCHAR_MAX >= filterlimit && UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= leafcounttop){
+				pcall = radixsortnoallocmulti4thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned char, vararguments...>;
+				indexsizeofpcall = sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+			}
+		}
+		// the output is either the input or the buffer array, and the other one is used for the intermediate results
+		radixsortmultiwaynode<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, true, decltype(pcall), vararguments...>(count, plan.leafcount, plan.leafthreads, pcall, indexsizeofpcall * plan.leafthreads,
+			reinterpret_cast<taskfuture<void> *>(pfuturesplaceholder), reinterpret_cast<std::byte *>(pzeroedindices), input, movetobuffer? buffer : input, movetobuffer? input : buffer, std::forward<vararguments>(varparameters)...);
+		return{true};
+	}
+}
+#endif// !defined(RSBD8_THREAD_MAXIMUM) || 24 <= (RSBD8_THREAD_MAXIMUM)
+
 #if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
 // Up to 18-way multithreading functions with indirection
 
@@ -59240,16 +61463,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	static std::size_t constexpr limit8way{base8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit8way{runtime8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	auto pcall{radixsortcopynoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
-		if(limit4way <= count && 3u < allowedthreads){// 4-way limit
+		if(7u < allowedthreads && multithreadingstrategy::samplesort == activemultithreadingstrategy.load(std::memory_order_relaxed))// the sample sort strategy, if selected and if the type is handled by it
+			if(radixsortsamplesort<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1))),
+				pfuturesplaceholder, pzeroedindices, input, output, buffer, std::forward<vararguments>(varparameters)...)) return;
+#if !defined(RSBD8_THREAD_MAXIMUM) || 24 <= (RSBD8_THREAD_MAXIMUM)
+		if(23u < allowedthreads)// more than 18-way, if the input is large enough for it
+			if(radixsortcopynoallocmultiway<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, allowedthreads, pfuturesplaceholder, pzeroedindices, input, output, buffer, std::forward<vararguments>(varparameters)...)) return;
+#endif
+		if(runtimelimit4way <= count && 3u < allowedthreads){// 4-way limit
 			// select the smallest unsigned type for the indices
 			// architecture: this compiles into just a few conditional move instructions on most platforms
 			std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>)};
-			if(((limit8way <= count)? 11u : 5u) < allowedthreads){// 6-, 12- or 18-way
+			if(((runtimelimit8way <= count)? 11u : 5u) < allowedthreads){// 6-, 12- or 18-way
 				pcall = radixsortcopynoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, vararguments...>;
 				if constexpr(ULLONG_MAX >= limit4way && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= count){
 					pcall = radixsortcopynoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long long, vararguments...>;
@@ -59295,10 +61528,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				}
 			}
 			std::size_t finalcount{count};// depending on multithreading, this will be either count or one half/third of count (rounded down)
-			std::future<void> asyncreturnhandle;
+			unsigned splitways{2u};// the number of sorted parts to merge, halves or thirds
+			taskfuture<void> asyncreturnhandle;
 			{
-				autowrapfutureonfuture<std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>> asynchandlemid, asynchandletop;// this is to avoid having the child std::async tasks wait on the grandchild std::async tasks and instead do both here
-				if(limit8way <= count){// 8-way limit
+				autowrapfutureonfuture<std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>> asynchandlemid, asynchandletop;// this is to avoid having the child tasks wait on the grandchild tasks and instead do both here
+				if(runtimelimit8way <= count){// 8-way limit
 					static std::size_t constexpr filterlimit{(limit8way + 2u) / 3u};
 					if(17u < allowedthreads){// 18-way
 						std::size_t const thirdcount{count / 3u};// rounded down
@@ -59332,26 +61566,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 						unsigned allowedthreadstemp{allowedthreads / 3u};
 						assert(1u < allowedthreadstemp);// each of the three parts will use at least two threads
 						indexsizeofpcall *= allowedthreadstemp;
-						std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+						taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 						std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 						try{
 							// process the middle third (rounded in between) separately if possible
-							asynchandlemid = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, output + thirdcount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+							asynchandlemid = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, output + thirdcount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
 							pcall = pcallsmaller;
 							allowedthreads = allowedthreadstemp;
 							pfuturesiter += allowedthreadstemp;// 2 unused slots per split
 							pindicesiter += indexsizeofpcall;
 							std::swap(output, buffer);// swap the buffer pointers for processing the rest
 							finalcount = thirdcount;
+							splitways = 3u;
 							try{
 								// process the top third (rounded up) separately if possible
-								asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, output + twothirdscount, buffer + twothirdscount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
-							}catch(...){// std::async may fail gracefully here
+								asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, output + twothirdscount, buffer + twothirdscount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+							}catch(...){// launchasync() may fail gracefully here
 								assert(false);
 								// given the absolute rarity of this case, simply process this part in the current thread
 								pcall(thirdcounttop, allowedthreads, pfuturesplaceholder, pzeroedindices, input + twothirdscount, output + twothirdscount, buffer + twothirdscount, std::forward<vararguments>(varparameters)...);
 							}
-						}catch(...){// std::async may fail gracefully here
+						}catch(...){// launchasync() may fail gracefully here
 							assert(false);
 						}
 					}else if(7u < allowedthreads){// 8- or 12-way
@@ -59407,16 +61642,16 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 						unsigned allowedthreadstemp{allowedthreads >> 1};
 						assert(1u < allowedthreadstemp);// each of the two parts will use at least two threads
 						indexsizeofpcall *= allowedthreadstemp;
-						std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+						taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 						std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 						try{
 							// process the upper half (rounded up) separately if possible
-							asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, output + halfcount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+							asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, output + halfcount, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
 							pcall = pcallsmaller;
 							allowedthreads = allowedthreadstemp;
 							std::swap(output, buffer);// swap the buffer pointers for processing the rest
 							finalcount = halfcount;
-						}catch(...){// std::async may fail gracefully here
+						}catch(...){// launchasync() may fail gracefully here
 							assert(false);
 						}
 					}
@@ -59430,27 +61665,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				// this cannot be synchronised by a simple spinlock, as the processing above will most likely involve waiting on two other threads to finish
 				// note that output and buffer were swapped in the initial phase
 				asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
-				if(17u < allowedthreads){// 18-way
-					try{
-						// process the upper half separately if possible
-						asyncreturnhandle = std::async(std::launch::async, mergethirdsmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
-					}catch(...){// std::async may fail gracefully here
-						assert(false);
-						// given the absolute rarity of this case, simply process this part in the current thread
-						mergethirdsmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
-					}
-					mergethirdsmain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
-				}else{// 8- or 12-way
-					try{
-						// process the upper half separately if possible
-						asyncreturnhandle = std::async(std::launch::async, mergehalvesmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
-					}catch(...){// std::async may fail gracefully here
-						assert(false);
-						// given the absolute rarity of this case, simply process this part in the current thread
-						mergehalvesmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
-					}
-					mergehalvesmain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
-				}
+				// every part was sorted with the same number of threads, so all of these are available for merging
+				mergepathmulti<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, splitways, allowedthreads * splitways, output, buffer, std::forward<vararguments>(varparameters)...);
 			}
 			return;
 		}else{// dual-threaded
@@ -59510,16 +61726,26 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 	static std::size_t constexpr limit2way{base2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	static std::size_t constexpr limit4way{base4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	static std::size_t constexpr limit8way{base8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit2way{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit4way{runtime4waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
+	std::size_t const runtimelimit8way{runtime8waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, true>()};
 	auto pcall{radixsortnoallocmultimain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, false, vararguments...>};
-	if(limit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
+	if(runtimelimit2way <= count && 1u < allowedthreads)RSBD8_LIKELY{// 2-way limit
 #if defined(RSBD8_THREAD_MAXIMUM)
 		if(static_cast<unsigned>(RSBD8_THREAD_MAXIMUM) < allowedthreads) allowedthreads = static_cast<unsigned>(RSBD8_THREAD_MAXIMUM);
 #endif
-		if(limit4way <= count && 3u < allowedthreads){// 4-way limit
+		if(7u < allowedthreads && multithreadingstrategy::samplesort == activemultithreadingstrategy.load(std::memory_order_relaxed))// the sample sort strategy, if selected and if the type is handled by it
+			if(radixsortsamplesort<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), (count + 1u) / ((runtimelimit2way + 1u) >> 1))),
+				pfuturesplaceholder, pzeroedindices, input, movetobuffer? buffer : input, movetobuffer? input : buffer, std::forward<vararguments>(varparameters)...)) return;
+#if !defined(RSBD8_THREAD_MAXIMUM) || 24 <= (RSBD8_THREAD_MAXIMUM)
+		if(23u < allowedthreads)// more than 18-way, if the input is large enough for it
+			if(radixsortnoallocmultiway<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, allowedthreads, pfuturesplaceholder, pzeroedindices, input, buffer, movetobuffer, std::forward<vararguments>(varparameters)...)) return;
+#endif
+		if(runtimelimit4way <= count && 3u < allowedthreads){// 4-way limit
 			// select the smallest unsigned type for the indices
 			// architecture: this compiles into just a few conditional move instructions on most platforms
 			std::size_t indexsizeofpcall{sizeof(offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>)};
-			if(((limit8way <= count)? 11u : 5u) < allowedthreads){// 6-, 12- or 18-way
+			if(((runtimelimit8way <= count)? 11u : 5u) < allowedthreads){// 6-, 12- or 18-way
 				pcall = radixsortnoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, std::size_t, vararguments...>;
 				if constexpr(ULLONG_MAX >= limit4way && ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= count){
 					pcall = radixsortnoallocmulti6thread<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, unsigned long long, vararguments...>;
@@ -59565,10 +61791,11 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 				}
 			}
 			std::size_t finalcount{count};// depending on multithreading, this will be either count or one half/third of count (rounded down)
-			std::future<void> asyncreturnhandle;
+			unsigned splitways{2u};// the number of sorted parts to merge, halves or thirds
+			taskfuture<void> asyncreturnhandle;
 			{
-				autowrapfutureonfuture<std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>> asynchandlemid, asynchandletop;// this is to avoid having the child std::async tasks wait on the grandchild std::async tasks and instead do both here
-				if(limit8way <= count){// 8-way limit
+				autowrapfutureonfuture<std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>> asynchandlemid, asynchandletop;// this is to avoid having the child tasks wait on the grandchild tasks and instead do both here
+				if(runtimelimit8way <= count){// 8-way limit
 					static std::size_t constexpr filterlimit{(limit8way + 2u) / 3u};
 					if(17u < allowedthreads){// 18-way
 						std::size_t const thirdcount{count / 3u};// rounded down
@@ -59602,26 +61829,27 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 						unsigned allowedthreadstemp{allowedthreads / 3u};
 						assert(1u < allowedthreadstemp);// each of the three parts will use at least two threads
 						indexsizeofpcall *= allowedthreadstemp;
-						std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+						taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 						std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 						try{
 							// process the middle third (rounded in between) separately if possible
-							asynchandlemid = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, !movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+							asynchandlemid = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, thirdcountmid, allowedthreadstemp, pfuturesiter, pindicesiter, input + thirdcount, buffer + thirdcount, !movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
 							pcall = pcallsmaller;
 							allowedthreads = allowedthreadstemp;
 							pfuturesiter += allowedthreadstemp;// 2 unused slots per split
 							pindicesiter += indexsizeofpcall;
 							movetobuffer = !movetobuffer;// swap the buffer pointers for processing the rest
 							finalcount = thirdcount;
+							splitways = 3u;
 							try{
 								// process the top third (rounded up) separately if possible
-								asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, buffer + twothirdscount, movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
-							}catch(...){// std::async may fail gracefully here
+								asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcall, thirdcounttop, allowedthreads, pfuturesiter, pindicesiter, input + twothirdscount, buffer + twothirdscount, movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+							}catch(...){// launchasync() may fail gracefully here
 								assert(false);
 								// given the absolute rarity of this case, simply process this part in the current thread
 								pcall(thirdcounttop, allowedthreads, pfuturesplaceholder, pzeroedindices, input + twothirdscount, buffer + twothirdscount, movetobuffer, std::forward<vararguments>(varparameters)...);
 							}
-						}catch(...){// std::async may fail gracefully here
+						}catch(...){// launchasync() may fail gracefully here
 							assert(false);
 						}
 					}else if(7u < allowedthreads){// 8- or 12-way
@@ -59677,16 +61905,16 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 						unsigned allowedthreadstemp{allowedthreads >> 1};
 						assert(1u < allowedthreadstemp);// each of the two parts will use at least two threads
 						indexsizeofpcall *= allowedthreadstemp;
-						std::future<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<std::future<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
+						taskfuture<void> *RSBD8_RESTRICT pfuturesiter{reinterpret_cast<taskfuture<void> *RSBD8_RESTRICT>(pfuturesplaceholder) + allowedthreadstemp};// 2 unused slots per split
 						std::byte *RSBD8_RESTRICT pindicesiter{reinterpret_cast<std::byte *RSBD8_RESTRICT>(pzeroedindices) + indexsizeofpcall};
 						try{
 							// process the upper half (rounded up) separately if possible
-							asynchandletop = new(pfuturesiter - 2) std::future<std::future<void>>{std::async(std::launch::async, pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, !movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
+							asynchandletop = new(pfuturesiter - 2) taskfuture<taskfuture<void>>{launchasync(pcallsmaller, halfcounttop, allowedthreadstemp, pfuturesiter, pindicesiter, input + halfcount, buffer + halfcount, !movetobuffer, std::forward<vararguments>(varparameters)...)};// use the otherwise unused space
 							pcall = pcallsmaller;
 							allowedthreads = allowedthreadstemp;
 							movetobuffer = !movetobuffer;// swap the buffer pointers for processing the rest
 							finalcount = halfcount;
-						}catch(...){// std::async may fail gracefully here
+						}catch(...){// launchasync() may fail gracefully here
 							assert(false);
 						}
 					}
@@ -59705,27 +61933,8 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 					buffer = tmp;
 				}
 				asyncreturnhandle.get();// wait for everything to finish, this will properly handle possible exceptions before the next statement, too
-				if(17u < allowedthreads){// 18-way
-					try{
-						// process the upper half separately if possible
-						asyncreturnhandle = std::async(std::launch::async, mergethirdsmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, input, buffer, std::forward<vararguments>(varparameters)...);
-					}catch(...){// std::async may fail gracefully here
-						assert(false);
-						// given the absolute rarity of this case, simply process this part in the current thread
-						mergethirdsmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, input, buffer, std::forward<vararguments>(varparameters)...);
-					}
-					mergethirdsmain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, input, buffer, std::forward<vararguments>(varparameters)...);
-				}else{// 8- or 12-way
-					try{
-						// process the upper half separately if possible
-						asyncreturnhandle = std::async(std::launch::async, mergehalvesmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>, count, input, buffer, std::forward<vararguments>(varparameters)...);
-					}catch(...){// std::async may fail gracefully here
-						assert(false);
-						// given the absolute rarity of this case, simply process this part in the current thread
-						mergehalvesmtc<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, input, buffer, std::forward<vararguments>(varparameters)...);
-					}
-					mergehalvesmain<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, input, buffer, std::forward<vararguments>(varparameters)...);
-				}
+				// every part was sorted with the same number of threads, so all of these are available for merging
+				mergepathmulti<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V, vararguments...>(count, splitways, allowedthreads * splitways, input, buffer, std::forward<vararguments>(varparameters)...);
 			}
 			return;
 		}else{// dual-threaded
@@ -59771,230 +61980,1962 @@ RSBD8_FUNC_NORMAL std::enable_if_t<
 }
 #endif// !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
 
-// Helper functions for determining absolute, signed and floating-point attributes at compile-time
-//
-// These fuctions are used by the wrapper functions to determine the correct template parameters to pass to the actual sorting functions.
+// Helper functions for the streaming sort builder
 
-template<sortingmode mode, typename T>
-constexpr bool isabsvalue{
-	(sortingmode::nativeabs <= mode && std::is_signed_v<T> ||
-#if 0xFFFFFFFFFFFFFFFFu <= UINTPTR_MAX
-		std::is_same_v<T, test128<true, false, false>> ||
-		std::is_same_v<T, test128<true, false, true>> ||
-		std::is_same_v<T, test128<true, true, false>> ||
-		std::is_same_v<T, test128<true, true, true>> ||
-#else
-		std::is_same_v<T, test64<true, false, false>> ||
-		std::is_same_v<T, test64<true, false, true>> ||
-		std::is_same_v<T, test64<true, true, false>> ||
-		std::is_same_v<T, test64<true, true, true>> ||
+// the types that the streaming sort builder counts while the items are appended, which are the same as the ones of the global histogram multithreading strategy
+// other types are simply sorted by radixsortnoalloc() when finalising
+template<typename T>
+bool constexpr issortbuildercounted{std::is_unsigned_v<T> && 8u < CHAR_BIT * sizeof(T) && 64u >= CHAR_BIT * sizeof(T) && !isoffsetsbodysplitup<T>};
+
+// count all digits of a chunk of items in one go
+template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL void sortbuildercount(std::size_t count, T const *RSBD8_RESTRICT input, std::size_t *RSBD8_RESTRICT pcounts)noexcept{
+	for(std::size_t i{count}; i; --i){
+		T const key{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(*input++)};
+		for(unsigned pass{}; offsetsloopcount<T> > pass; ++pass) ++pcounts[globalhistogrambucket<T>(key, pass)];
+	}
+}
+
+// sort the items with the index counts of all digits, which are turned into offsets one sorting pass at a time
+// the sorting passes alternate between the input and buffer arrays without a final copy, and the array that holds the sorted items is returned
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL T *sortbuilderfinalise(std::size_t count, std::size_t *RSBD8_RESTRICT pcounts, T *input, T *buffer)noexcept{
+	T *psource{input}, *pdestination{buffer};
+	bool isfirst{true};
+	for(unsigned pass{}; offsetsloopcount<T> > pass; ++pass){
+		std::size_t *RSBD8_RESTRICT poffsets{pcounts + (static_cast<std::size_t>(pass) << typeradix<T>)};
+		std::size_t const length{globalhistogramlength<isabsvalue, issignmode, isfltpmode, T>(pass)};
+		std::size_t offset{};
+		bool isskipped{};
+		for(std::size_t i{}; length > i; ++i){
+			std::size_t &elem{poffsets[isdescsort? length - 1u - i : i]};
+			std::size_t const cur{elem};
+			if(count == cur){// all items have the same digit here
+				isskipped = true;
+				break;
+			}
+			elem = offset;
+			offset += cur;
+		}
+		if(isskipped) continue;
+		if(isrevorder && isfirst){// the first sorting pass reads the items in reverse
+			T const *RSBD8_RESTRICT pinput{psource + count};
+			for(std::size_t i{count}; i; --i){
+				T const cur{*--pinput};
+				pdestination[pcounts[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur), pass)]++] = cur;
+			}
+		}else{
+			T const *RSBD8_RESTRICT pinput{psource};
+			for(std::size_t i{count}; i; --i){
+				T const cur{*pinput++};
+				pdestination[pcounts[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur), pass)]++] = cur;
+			}
+		}
+		isfirst = false;
+		std::swap(psource, pdestination);
+	}
+	if(isrevorder && isfirst) std::reverse(input, input + count);// all items are equal, but their order still has to be reversed
+	return{psource};
+}
+
+// Helper functions for presortedness detection
+
+// the types that are scanned for presortedness, which are the same as the ones of the global histogram multithreading strategy
+template<typename T>
+bool constexpr ispresortednessscanned{issortbuildercounted<T>};
+
+// the maximum number of runs that are merged instead of sorted, merging up to three runs at a time then takes no more than half as many passes as sorting
+template<typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE constexpr std::size_t presortedmaximumruns()noexcept{
+	std::size_t runs{1u};
+	for(unsigned pass{offsetsloopcount<T> >> 1}; pass; --pass) runs *= 3u;
+	return{runs};
+}
+
+// the filtered key of an item, inverted for descending sorting, so that the wanted order is always ascending on it as an unsigned integer
+template<bool isdescsort, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE T presortedkey(T cur)noexcept{
+	T const key{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur)};
+	if constexpr(isdescsort) return{static_cast<T>(~key)};
+	else return{key};
+}
+
+// scan for the runs that are in the sorting order, and store the start offsets of the runs with the count as the final entry
+// the number of runs is returned, or 0 if there are too many of them, in which case the scan usually stops after just a few items
+// if every pair of items is in the reverse of the sorting order, the items only need to be reversed, and isreversed is set
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL std::size_t presortedscan(std::size_t count, T const *RSBD8_RESTRICT input, std::size_t *RSBD8_RESTRICT pruns, bool &isreversed)noexcept{
+	assert(1u < count);
+	static std::size_t constexpr maximumruns{presortedmaximumruns<T>()};
+	std::size_t runs{1u};
+	bool isdescending{true};
+	pruns[0] = 0u;
+	T previous{presortedkey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(*input++)};
+	for(std::size_t i{1u}; count > i; ++i){
+		T const cur{presortedkey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(*input++)};
+		// equal items continue a run, unless their order is to be reversed
+		if(isrevorder? previous < cur : previous <= cur){
+			if(maximumruns < runs) return{0u};
+			isdescending = false;
+		}else{
+			if(maximumruns > runs) pruns[runs] = i;
+			++runs;
+			if(maximumruns < runs && !isdescending) return{0u};
+		}
+		previous = cur;
+	}
+	isreversed = isdescending;
+	if(maximumruns < runs) return{0u};
+	pruns[runs] = count;
+	return{runs};
+}
+
+// reverse the items into the output, which can be the input array, every part handles its own range of the output
+template<typename T>
+RSBD8_FUNC_NORMAL void presortedreverse(std::size_t count, unsigned firstpart, unsigned partcount, unsigned totalparts, T const *input, T *output)noexcept{
+	assert(partcount);
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	if(1u < partcount){
+		unsigned const upperparts{partcount >> 1};
+		taskfuture<void> asynchandle;// the destructor of this waits for the upper parts
+		try{
+			// process the upper parts separately if possible
+			asynchandle = launchasync(presortedreverse<T>, count, firstpart + partcount - upperparts, upperparts, totalparts, input, output);
+		}catch(...){// launchasync() may fail gracefully here
+			assert(false);
+			// given the absolute rarity of this case, simply process these parts in the current thread
+			presortedreverse<T>(count, firstpart + partcount - upperparts, upperparts, totalparts, input, output);
+		}
+		// process the lower parts (rounded up) here
+		presortedreverse<T>(count, firstpart, partcount - upperparts, totalparts, input, output);
+		return;
+	}
 #endif
-		std::is_same_v<T, longdoubletest128<true, false, false>> ||
-		std::is_same_v<T, longdoubletest128<true, false, true>> ||
-		std::is_same_v<T, longdoubletest128<true, true, false>> ||
-		std::is_same_v<T, longdoubletest128<true, true, true>> ||
-		std::is_same_v<T, longdoubletest96<true, false, false>> ||
-		std::is_same_v<T, longdoubletest96<true, false, true>> ||
-		std::is_same_v<T, longdoubletest96<true, true, false>> ||
-		std::is_same_v<T, longdoubletest96<true, true, true>> ||
-		std::is_same_v<T, longdoubletest80<true, false, false>> ||
-		std::is_same_v<T, longdoubletest80<true, false, true>> ||
-		std::is_same_v<T, longdoubletest80<true, true, false>> ||
-		std::is_same_v<T, longdoubletest80<true, true, true>>) ||
-	(sortingmode::native > mode && static_cast<bool>(1u & static_cast<unsigned char>(mode)))
-};
+	// in place, the items are swapped in pairs, so only the first half of the output is handled
+	bool const isinplace{input == output};
+	std::size_t const length{isinplace? count >> 1 : count};
+	std::size_t const quotient{length / totalparts}, remainder{length % totalparts};
+	std::size_t const first{quotient * firstpart + std::min(static_cast<std::size_t>(firstpart), remainder)};
+	std::size_t const last{first + quotient + (firstpart < remainder)};
+	if(isinplace) for(std::size_t i{first}; last > i; ++i) std::swap(output[i], output[count - 1u - i]);
+	else for(std::size_t i{first}; last > i; ++i) output[i] = input[count - 1u - i];
+}
 
-template<sortingmode mode, typename T>
-constexpr bool issignmode{
-	(sortingmode::native <= mode && sortingmode::nativeabs >= mode &&
-		std::is_signed_v<T> ||
-#if 0xFFFFFFFFFFFFFFFFu <= UINTPTR_MAX
-		std::is_same_v<T, test128<false, true, false>> ||
-		std::is_same_v<T, test128<false, true, true>> ||
-		std::is_same_v<T, test128<true, true, false>> ||
-		std::is_same_v<T, test128<true, true, true>> ||
-#else
-		std::is_same_v<T, test64<false, true, false>> ||
-		std::is_same_v<T, test64<false, true, true>> ||
-		std::is_same_v<T, test64<true, true, false>> ||
-		std::is_same_v<T, test64<true, true, true>> ||
+// merge the runs up to three at a time with the merge-path functions, and alternate between the arrays for every merging pass
+// the first merging pass reads from the input array, and the array that holds the result is returned
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL T *presortedmerge(std::size_t count, std::size_t runs, std::size_t *RSBD8_RESTRICT pruns,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+	unsigned allowedthreads,
 #endif
-		std::is_same_v<T, longdoubletest128<false, true, false>> ||
-		std::is_same_v<T, longdoubletest128<false, true, true>> ||
-		std::is_same_v<T, longdoubletest128<true, true, false>> ||
-		std::is_same_v<T, longdoubletest128<true, true, true>> ||
-		std::is_same_v<T, longdoubletest96<false, true, false>> ||
-		std::is_same_v<T, longdoubletest96<false, true, true>> ||
-		std::is_same_v<T, longdoubletest96<true, true, false>> ||
-		std::is_same_v<T, longdoubletest96<true, true, true>> ||
-		std::is_same_v<T, longdoubletest80<false, true, false>> ||
-		std::is_same_v<T, longdoubletest80<false, true, true>> ||
-		std::is_same_v<T, longdoubletest80<true, true, false>> ||
-		std::is_same_v<T, longdoubletest80<true, true, true>>) ||
-	(sortingmode::native > mode && static_cast<bool>(1u << 1 & static_cast<unsigned char>(mode)))
-};
+	T const *input, T *first, T *second)noexcept{
+	assert(1u < runs);
+	T const *psource{input};
+	T *pdestination{first}, *pother{second};
+	for(;;){
+		std::size_t merged{};
+		for(std::size_t run{}; runs > run; run += 3u){
+			unsigned const ways{static_cast<unsigned>(std::min(runs - run, static_cast<std::size_t>(3u)))};
+			std::size_t const start{pruns[run]};
+			std::size_t const length{pruns[run + ways] - start};
+			pruns[merged++] = start;
+			if(1u == ways){// a lone final run is copied
+				std::memcpy(pdestination + start, psource + start, length * sizeof(T));
+				continue;
+			}
+			std::size_t runoffsets[4]{0u, pruns[run + 1u] - start, pruns[run + 2u] - start, length};
+			if(2u == ways) runoffsets[2] = length;
+			T const *RSBD8_RESTRICT pinput{psource + start};
+			auto getkey{[pinput](std::size_t index)noexcept{
+				return presortedkey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(pinput[index]);
+			}};
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+			// do not split into parts of just a few items
+			unsigned parts{allowedthreads};
+			if(length < static_cast<std::size_t>(parts) * 1024u) parts = static_cast<unsigned>(length >> 10 | 1u);
+			if(1u < parts) mergepathrange<false, isrevorder, T, decltype(getkey)>(0u, length, ways, runoffsets, 0u, parts, parts, pinput, pdestination + start, getkey);
+			else
+#endif
+			{
+				std::size_t const splits[3]{runoffsets[0], runoffsets[1], runoffsets[2]};
+				mergepathpart<false, isrevorder, T, decltype(getkey)>(ways, runoffsets, splits, 0u, length, pinput, pdestination + start, getkey);
+			}
+		}
+		pruns[merged] = count;
+		runs = merged;
+		if(1u == runs) return{pdestination};
+		psource = pdestination;
+		std::swap(pdestination, pother);
+	}
+}
 
-template<sortingmode mode, typename T>
-constexpr bool isfltpmode{
-	(sortingmode::native <= mode &&
-		std::is_floating_point_v<T> ||
-#if 0xFFFFFFFFFFFFFFFFu <= UINTPTR_MAX
-		std::is_same_v<T, test128<false, false, true>> ||
-		std::is_same_v<T, test128<false, true, true>> ||
-		std::is_same_v<T, test128<true, false, true>> ||
-		std::is_same_v<T, test128<true, true, true>> ||
-#else
-		std::is_same_v<T, test64<false, false, true>> ||
-		std::is_same_v<T, test64<false, true, true>> ||
-		std::is_same_v<T, test64<true, false, true>> ||
-		std::is_same_v<T, test64<true, true, true>> ||
+// sort the items if they are in the sorting order, in the reverse of it, or in just a few runs, false is returned without sorting otherwise
+// the output can be the input array, and the buffer can be the input array if the output is not
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL bool presortedsort(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	unsigned allowedthreads,
 #endif
-		std::is_same_v<T, longdoubletest128<false, false, true>> ||
-		std::is_same_v<T, longdoubletest128<false, true, true>> ||
-		std::is_same_v<T, longdoubletest128<true, false, true>> ||
-		std::is_same_v<T, longdoubletest128<true, true, true>> ||
-		std::is_same_v<T, longdoubletest96<false, false, true>> ||
-		std::is_same_v<T, longdoubletest96<false, true, true>> ||
-		std::is_same_v<T, longdoubletest96<true, false, true>> ||
-		std::is_same_v<T, longdoubletest96<true, true, true>> ||
-		std::is_same_v<T, longdoubletest80<false, false, true>> ||
-		std::is_same_v<T, longdoubletest80<false, true, true>> ||
-		std::is_same_v<T, longdoubletest80<true, false, true>> ||
-		std::is_same_v<T, longdoubletest80<true, true, true>>) ||
-	(sortingmode::native > mode && static_cast<bool>(1u << 2 & static_cast<unsigned char>(mode)))
-};
+	T const *input, T *output, T *buffer)noexcept{
+	assert(output != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+	assert(buffer);
 
-template<sortingdirection direction>
-constexpr bool isdescsort{
-	static_cast<bool>(1u & static_cast<unsigned char>(direction))
-};
+	if(2u > count) return{false};// leave these to the regular sorting functions
+	std::size_t pruns[presortedmaximumruns<T>() + 1u];
+	bool isreversed{};
+	std::size_t const runs{presortedscan<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, input, pruns, isreversed)};
+	if(isreversed){
+		unsigned parts{1u};
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		// do not split into parts of just a few items
+		if(1u < allowedthreads){
+			parts = allowedthreads;
+			if(count < static_cast<std::size_t>(parts) * 4096u) parts = static_cast<unsigned>(count >> 12 | 1u);
+		}
+#endif
+		presortedreverse<T>(count, 0u, parts, parts, input, output);
+	}else if(1u == runs){// already sorted
+		if(input != output) std::memcpy(output, input, count * sizeof(T));
+	}else if(runs){
+		// the first merging pass cannot write to the input array, and the final merging pass should write to the output array if possible
+		unsigned passes{};
+		for(std::size_t merged{runs}; 1u < merged; merged = (merged + 2u) / 3u) ++passes;
+		T *pfirst{(input != output && (buffer == input || passes & 1u))? output : buffer};
+		T *psecond{(output == pfirst)? buffer : output};
+		T *presult{presortedmerge<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count, runs, pruns,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+			allowedthreads,
+#endif
+			input, pfirst, psecond)};
+		if(output != presult) std::memcpy(output, presult, count * sizeof(T));
+	}else return{false};
+	return{true};
+}
 
-template<sortingdirection direction>
-constexpr bool isrevorderwithindirection{
-	static_cast<bool>(1u << 1 & static_cast<unsigned char>(direction))
-};
+// Helper functions for merging a batch into sorted items
 
-template<sortingdirection direction, typename T, bool isabsvalue, bool issignmode, bool isfltpmode>
-constexpr bool isrevorderwithoutindirection{
-	static_cast<bool>(1u << 1 & static_cast<unsigned char>(direction)) && (
-		// reverse ordering is useless if there are no non-uniqe value configurations (padding, sign bits)
-		std::is_same_v<T, longdoubletest128<false, false, false>> ||
-		std::is_same_v<T, longdoubletest128<false, false, true>> ||
-		std::is_same_v<T, longdoubletest128<false, true, false>> ||
-		std::is_same_v<T, longdoubletest128<false, true, true>> ||
-		std::is_same_v<T, longdoubletest128<true, false, false>> ||
-		std::is_same_v<T, longdoubletest128<true, false, true>> ||
-		std::is_same_v<T, longdoubletest128<true, true, false>> ||
-		std::is_same_v<T, longdoubletest128<true, true, true>> ||
-		std::is_same_v<T, longdoubletest96<false, false, false>> ||
-		std::is_same_v<T, longdoubletest96<false, false, true>> ||
-		std::is_same_v<T, longdoubletest96<false, true, false>> ||
-		std::is_same_v<T, longdoubletest96<false, true, true>> ||
-		std::is_same_v<T, longdoubletest96<true, false, false>> ||
-		std::is_same_v<T, longdoubletest96<true, false, true>> ||
-		std::is_same_v<T, longdoubletest96<true, true, false>> ||
-		std::is_same_v<T, longdoubletest96<true, true, true>> ||
-		(std::is_same_v<T, long double> &&
-			64 == LDBL_MANT_DIG &&
-			16384 == LDBL_MAX_EXP &&
-			128u >= CHAR_BIT * sizeof(long double) &&
-			64u < CHAR_BIT * sizeof(long double)) ||
-		(isabsvalue && issignmode) ||// both regular absolute modes
-		(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
-};
-}// namespace helper
+// merge the sorted items with the sorted batch that directly follows them into the output with the merge-path functions
+template<bool isdescsort, bool isrevorder, typename E, typename F>
+RSBD8_FUNC_NORMAL void mergebatchruns(std::size_t sortedcount, std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+	unsigned allowedthreads,
+#endif
+	E const *RSBD8_RESTRICT input, E *RSBD8_RESTRICT output, F getkey)noexcept(std::is_nothrow_invocable_v<F, std::size_t>){
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
 
-// Generic large array allocation and deallocation functions
+	std::size_t const runoffsets[4]{0u, sortedcount, count, count};
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+	// do not split into parts of just a few items
+	unsigned parts{allowedthreads};
+	if(count < static_cast<std::size_t>(parts) * 1024u) parts = static_cast<unsigned>(count >> 10 | 1u);
+	if(1u < parts) mergepathrange<isdescsort, isrevorder, E, F>(0u, count, 2u, runoffsets, 0u, parts, parts, input, output, getkey);
+	else
+#endif
+	{
+		std::size_t const splits[3]{0u, sortedcount, count};
+		mergepathpart<isdescsort, isrevorder, E, F>(2u, runoffsets, splits, 0u, count, input, output, getkey);
+	}
+}
 
-// allocation failed if the pbuffer member of the output is a nullptr
-// the memory space held by pfuturesplaceholder is only a reservation, without any initialisation
-// the indices have to be zeroed beforehand during allocation
-template<typename T>
-struct combinedallocation{
-	T *RSBD8_RESTRICT pbuffer;
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	void *RSBD8_RESTRICT pfuturesplaceholder;
+// merge the sorted items with the sorted batch that directly follows them into the output, without indirection
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	!std::is_same_v<bool, T> &&
+	(std::is_unsigned_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T),
+	void> mergebatch(std::size_t sortedcount, std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+	unsigned allowedthreads,
 #endif
-	void *RSBD8_RESTRICT pzeroedindices;
-};
+	T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output)noexcept{
+	auto getkey{mergepathgetkey<isabsvalue, issignmode, isfltpmode, T>(input)};
+	mergebatchruns<isdescsort, isrevorder, T, decltype(getkey)>(sortedcount, count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+		allowedthreads,
+#endif
+		input, output, getkey);
+}
 
-template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T, bool isbufferpointers, bool isbufferallocated = true>
-RSBD8_NODISCARD RSBD8_FUNC_INLINE
-#if !defined(_WIN32) && defined(_POSIX_C_SOURCE)// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-	std::pair<combinedallocation<std::conditional_t<isbufferpointers, T *RSBD8_RESTRICT, T>>, std::size_t>
-#else
-	combinedallocation<std::conditional_t<isbufferpointers, T *RSBD8_RESTRICT, T>>
+// merge the sorted items with the sorted batch that directly follows them into the output, with indirection
+template<auto indirection1, bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, std::ptrdiff_t indirection2, bool isindexed2, typename V, typename... vararguments>
+RSBD8_FUNC_NORMAL std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>),
+	void> mergebatch(std::size_t sortedcount, std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+	unsigned allowedthreads,
 #endif
-	allocatearray(std::size_t count
+	V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	using T = tounifunsigned<std::remove_pointer_t<std::decay_t<memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>, isabsvalue, issignmode, isfltpmode>;
+	using W = typename std::conditional_t<std::is_class_v<T> || std::is_union_v<T> || isabsvalue || !issignmode || isfltpmode, std::enable_if<true, T>, std::make_signed<T>>::type;// for simple signed comparisons, use signed W
+
+	auto getkey{[input, &varparameters...](std::size_t index)noexcept(std::is_nothrow_invocable_v<decltype(splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+		auto im{indirectinput1<indirection1, isindexed2, false, W, V>(input[index], std::forward<vararguments>(varparameters)...)};
+		auto cur{indirectinput2<indirection1, indirection2, isindexed2, false, W>(im, std::forward<vararguments>(varparameters)...)};
+		return convertinput<isabsvalue, issignmode, isfltpmode, W>(cur);// convert the value for integer comparison
+	}};
+	mergebatchruns<isdescsort, isrevorder, V *RSBD8_RESTRICT, decltype(getkey)>(sortedcount, count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+		allowedthreads,
+#endif
+		input, output, getkey);
+}
+
+// Helper functions for sorting keys with a separate payload array
+
+// the number of offsets of every part, the low offsets for the forward half of a part are followed by the high offsets for the backward half of it
+template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+std::size_t constexpr keyvaluecountslength{2u * offsetslength<isabsvalue, issignmode, isfltpmode, T>};
+
+// the number of parts to split the items into, this uses the 2-way multithreading threshold of the sorting functions without indirection, and every part gets at least half of it
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE unsigned keyvalueparts(std::size_t count
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 	, unsigned allowedthreads
-#endif
-#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-	, std::size_t largepagesize = 0u
-#elif defined(_POSIX_C_SOURCE)
-	, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
 	)noexcept{
-	assert(count);
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	std::size_t const threshold{runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T, false>()};
+	if(2u > allowedthreads || threshold > count) return{1u};
+	return{static_cast<unsigned>(std::min(static_cast<std::size_t>(allowedthreads), count / std::max(threshold >> 1, static_cast<std::size_t>(1u))))};
+#else// single-threaded-only
+	static_cast<void>(count);
+	return{1u};
+#endif
+}
 
-	// the items are padded to full cache lines together, to avoid false sharing with other data in the same cache line, as well as to ensure that the buffers are aligned to at least the size of a cache line, which is a common requirement for optimal performance on many platforms
-	// the actual padding is placed in between the first and second members, to keep either natural or up to cache line alignment for std::future<void>
+// process every part with the given function, the upper parts are processed by other threads if possible
+template<typename F>
+RSBD8_FUNC_NORMAL void keyvalueforparts(unsigned firstpart, unsigned partcount, F const &function)noexcept{
+	assert(partcount);
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-	// determine the maximum element size for the indices, this will usually take just a few condional moves
-	std::size_t multithreadindicessize{sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>)};
-	if constexpr(ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= count){
-		multithreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+	if(1u < partcount){
+		unsigned const upperparts{partcount >> 1};
+		taskfuture<void> asynchandle;// the destructor of this waits for the upper parts
+		try{
+			// process the upper parts separately if possible
+			asynchandle = launchasync(keyvalueforparts<F>, firstpart + partcount - upperparts, upperparts, std::cref(function));
+		}catch(...){// launchasync() may fail gracefully here
+			assert(false);
+			// given the absolute rarity of this case, simply process these parts in the current thread
+			keyvalueforparts<F>(firstpart + partcount - upperparts, upperparts, function);
+		}
+		// process the lower parts (rounded up) here
+		keyvalueforparts<F>(firstpart, partcount - upperparts, function);
+		return;
 	}
-	if constexpr(ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= count){
-		multithreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+#endif
+	function(firstpart);
+}
+
+// scatter a part of the keys and payloads to their positions for a sorting pass
+// the front half of the part is scattered forward from the low offsets, and the back half backward from the high offsets, which keeps the sort stable
+// the first sorting pass of the reverse order reads the part from the mirrored position in reverse, and the first sorting pass of an index permutation generates the payloads as the positions in the input array
+template<bool isreversed, bool isindexgenerated, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, typename P>
+RSBD8_FUNC_NORMAL void keyvaluescatter(std::size_t count, std::size_t first, std::size_t last, unsigned pass, std::size_t *RSBD8_RESTRICT plow, std::size_t *RSBD8_RESTRICT phigh, T const *RSBD8_RESTRICT keys, P const *RSBD8_RESTRICT payloads, T *RSBD8_RESTRICT outkeys, P *RSBD8_RESTRICT outpayloads)noexcept{
+	std::ptrdiff_t const step{isreversed? -1 : 1};
+	std::size_t front{isreversed? count - 1u - first : first}, back{isreversed? count - last : last - 1u};
+	for(std::size_t i{(last - first) >> 1}; i; --i){
+		T const keyfront{keys[front]};
+		T const keyback{keys[back]};
+		std::size_t const destinationfront{plow[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(keyfront), pass)]++};
+		std::size_t const destinationback{--phigh[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(keyback), pass)]};
+		outkeys[destinationfront] = keyfront;
+		outkeys[destinationback] = keyback;
+		if constexpr(isindexgenerated){
+			outpayloads[destinationfront] = static_cast<P>(front);
+			outpayloads[destinationback] = static_cast<P>(back);
+		}else{
+			outpayloads[destinationfront] = payloads[front];
+			outpayloads[destinationback] = payloads[back];
+		}
+		front += static_cast<std::size_t>(step);
+		back -= static_cast<std::size_t>(step);
 	}
-	if constexpr(UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= count){
-		multithreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+	if(1u & (last - first)){// the middle item
+		T const key{keys[front]};
+		std::size_t const destination{plow[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(key), pass)]++};
+		outkeys[destination] = key;
+		if constexpr(isindexgenerated) outpayloads[destination] = static_cast<P>(front);
+		else outpayloads[destination] = payloads[front];
 	}
-	if constexpr(USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= count){
-		multithreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+}
+
+// sort the keys together with the payloads in least significant digit order, every part counts and scatters its own slice of the arrays in every sorting pass
+// a sorting pass is skipped if all keys have the same digit in it, and the sorting passes alternate between the output and buffer arrays, so that the last one writes to the output arrays if possible
+// the output arrays can be the input arrays, and the index counts of all the parts have to be zeroed beforehand
+// with isindexgenerated set the payloads array is not used, and the payloads are the positions of the keys in the input array instead
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, typename P, bool isindexgenerated = false>
+RSBD8_FUNC_NORMAL void keyvaluesort(std::size_t count, unsigned parts, std::size_t *RSBD8_RESTRICT pzeroedcounts, T const *keys, P const *payloads, T *outkeys, P *outpayloads, T *bufferkeys, P *bufferpayloads)noexcept{
+	assert(1u < count);
+	assert(parts);
+	static std::size_t constexpr length{offsetslength<isabsvalue, issignmode, isfltpmode, T>};
+	static std::size_t constexpr stride{keyvaluecountslength<isabsvalue, issignmode, isfltpmode, T>};
+	// equal slices, with the remainder distributed over the first parts
+	std::size_t const quotient{count / parts}, remainder{count % parts};
+	auto slicefirst{[quotient, remainder](unsigned part)noexcept{
+		return quotient * part + std::min(static_cast<std::size_t>(part), remainder);
+	}};
+
+	// count all digits of every slice in one go, the first sorting pass uses the mirrored slice for the reverse order
+	keyvalueforparts(0u, parts, [&](unsigned part)noexcept{
+		std::size_t const first{slicefirst(part)}, last{slicefirst(part + 1u)};
+		sortbuildercount<isabsvalue, issignmode, isfltpmode, T>(last - first, keys + (isrevorder? count - last : first), pzeroedcounts + part * stride);
+	});
+	// plan the sorting passes, a pass is skipped if all keys have the same digit in it
+	unsigned passes[offsetsloopcount<T>];
+	unsigned passcount{};
+	for(unsigned pass{}; offsetsloopcount<T> > pass; ++pass){
+		std::size_t total{};// the total of the first used bucket decides, the loop always ends as the counts of a pass add up to the total count
+		for(std::size_t bucket{static_cast<std::size_t>(pass) << typeradix<T>}; !total; ++bucket) for(unsigned i{}; parts > i; ++i) total += pzeroedcounts[i * stride + bucket];
+		if(count != total) passes[passcount++] = pass;
 	}
-	if constexpr(UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= count){
-		multithreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+	if(!passcount){// all keys are equal, but their order may still have to be reversed
+		if constexpr(isindexgenerated){
+			if(keys != outkeys) std::memcpy(outkeys, keys, count * sizeof(T));
+			for(std::size_t i{}; count > i; ++i) outpayloads[i] = static_cast<P>(isrevorder? count - 1u - i : i);
+		}else if constexpr(isrevorder){
+			presortedreverse<T>(count, 0u, parts, parts, keys, outkeys);
+			presortedreverse<P>(count, 0u, parts, parts, payloads, outpayloads);
+		}else if(keys != outkeys){
+			std::memcpy(outkeys, keys, count * sizeof(T));
+			std::memcpy(outpayloads, payloads, count * sizeof(P));
+		}
+		return;
 	}
-	std::size_t multithreadfuturessize{allowedthreads * sizeof(std::future<void>) - sizeof(std::future<void>[2])};// 2 less than the available threads, as the main and companion threads will not be put in here
-	std::size_t singlethreadindicessize{multithreadindicessize << static_cast<unsigned>(8u < CHAR_BIT * sizeof(T) ||// single-threaded mode simply uses a double set of indices, except for the fill-mode single-pass type
-		isbufferpointers ||// indirection
-		(isabsvalue && issignmode) ||// both regular absolute modes
-		(!isabsvalue && issignmode && isfltpmode))};// regular floating-point mode
-	multithreadindicessize *= allowedthreads;
-	if(1u >= allowedthreads) multithreadfuturessize = 0u, multithreadindicessize = singlethreadindicessize;
-	std::size_t allocsize{multithreadfuturessize + multithreadindicessize};
-	if constexpr(isbufferallocated) allocsize += count * (isbufferpointers? sizeof(void *) : sizeof(T));
-	if constexpr(1u < std::hardware_constructive_interference_size){// use cache line alignment for performance
-		allocsize += std::hardware_constructive_interference_size - 1u;// round up
-		allocsize &= -static_cast<std::ptrdiff_t>(std::hardware_constructive_interference_size);// finalise cache line alignment
+	// the first sorting pass cannot write to the input arrays
+	bool const isfirstoutput{keys != outkeys && passcount & 1u};
+	T *targetkeys[2]{isfirstoutput? outkeys : bufferkeys, isfirstoutput? bufferkeys : outkeys};
+	P *targetpayloads[2]{isfirstoutput? outpayloads : bufferpayloads, isfirstoutput? bufferpayloads : outpayloads};
+	T const *sourcekeys{keys};
+	P const *sourcepayloads{payloads};
+	for(unsigned index{}; passcount > index; ++index){
+		unsigned const pass{passes[index]};
+		std::size_t const base{static_cast<std::size_t>(pass) << typeradix<T>};
+		std::size_t const passlength{globalhistogramlength<isabsvalue, issignmode, isfltpmode, T>(pass)};
+		if(index && 1u < parts){// count the digits of this pass in every slice, using the output of the previous pass
+			keyvalueforparts(0u, parts, [&](unsigned part)noexcept{
+				std::size_t const first{slicefirst(part)}, last{slicefirst(part + 1u)};
+				std::size_t *RSBD8_RESTRICT pcounts{pzeroedcounts + part * stride};
+				std::memset(pcounts + base, 0, passlength * sizeof(std::size_t));
+				T const *RSBD8_RESTRICT pinput{sourcekeys + first};
+				for(std::size_t i{last - first}; i; --i) ++pcounts[globalhistogrambucket<T>(globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(*pinput++), pass)];
+			});
+		}
+		// turn the counts into the low and high offsets of every part, the parts are visited in the order of their slices, this keeps the sort stable
+		std::size_t offset{};
+		for(std::size_t i{}; passlength > i; ++i){
+			std::size_t const bucket{base + (isdescsort? passlength - 1u - i : i)};
+			for(unsigned part{}; parts > part; ++part){
+				std::size_t *RSBD8_RESTRICT pcounts{pzeroedcounts + part * stride};
+				std::size_t const cur{pcounts[bucket]};
+				pcounts[bucket] = offset;
+				offset += cur;
+				pcounts[length + bucket] = offset;
+			}
+		}
+		assert(count == offset);
+		T *RSBD8_RESTRICT poutkeys{targetkeys[index & 1u]};
+		P *RSBD8_RESTRICT poutpayloads{targetpayloads[index & 1u]};
+		keyvalueforparts(0u, parts, [&](unsigned part)noexcept{
+			std::size_t *RSBD8_RESTRICT pcounts{pzeroedcounts + part * stride};
+			if((isrevorder || isindexgenerated) && !index) keyvaluescatter<isrevorder, isindexgenerated, isabsvalue, issignmode, isfltpmode, T, P>(count, slicefirst(part), slicefirst(part + 1u), pass, pcounts, pcounts + length, sourcekeys, sourcepayloads, poutkeys, poutpayloads);
+			else keyvaluescatter<false, false, isabsvalue, issignmode, isfltpmode, T, P>(count, slicefirst(part), slicefirst(part + 1u), pass, pcounts, pcounts + length, sourcekeys, sourcepayloads, poutkeys, poutpayloads);
+		});
+		sourcekeys = poutkeys;
+		sourcepayloads = poutpayloads;
 	}
+	if(outkeys != sourcekeys){// the input arrays were the output arrays, and the number of sorting passes is odd
+		std::memcpy(outkeys, sourcekeys, count * sizeof(T));
+		std::memcpy(outpayloads, sourcepayloads, count * sizeof(P));
+	}
+}
+
+// Helper functions for applying a permutation to columns
+
+// the minimum number of items of every part, gathering is limited by the memory bandwidth, so splitting into smaller parts hardly helps
+std::size_t constexpr permutationminimumpart{static_cast<std::size_t>(1) << 15};
+// the number of items ahead of the current one for which the random reads are prefetched
+std::size_t constexpr permutationlookahead{16u};
+
+// the number of parts to split the items into
+RSBD8_NODISCARD RSBD8_FUNC_INLINE unsigned permutationparts(std::size_t count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	, unsigned allowedthreads
+#endif
+	)noexcept{
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	std::size_t const maximum{count / permutationminimumpart};
+	return{static_cast<unsigned>(std::max(std::min(static_cast<std::size_t>(allowedthreads), maximum), static_cast<std::size_t>(1u)))};
 #else// single-threaded-only
-	// determine the maximum element size for the indices, this will usually take just a few condional moves
-	std::size_t singlethreadindicessize{sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, std::size_t>)};
-	if constexpr(ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= count){
-		singlethreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, unsigned long long>);
+	static_cast<void>(count);
+	return{1u};
+#endif
+}
+
+// gather a part of a column in the order of the indices, the indices and the output are read and written sequentially
+template<typename T, typename I>
+RSBD8_FUNC_NORMAL void permutationgather(std::size_t first, std::size_t last, I const *RSBD8_RESTRICT indices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output)noexcept{
+	std::size_t i{first};
+	if(last - first > permutationlookahead) for(std::size_t const prefetched{last - permutationlookahead}; prefetched > i; ++i){
+		prefetchcurrent<0>(input + indices[i + permutationlookahead]);
+		prefetchforward(indices + i);
+		prefetchwriteforward(output + i);
+		output[i] = input[indices[i]];
 	}
-	if constexpr(ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= count){
-		singlethreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, unsigned long>);
+	for(; last > i; ++i) output[i] = input[indices[i]];
+}
+
+// gather all parts of a column, and copy the result back to the column if the output is the buffer
+template<typename T, typename I>
+RSBD8_FUNC_NORMAL void permutationcolumn(std::size_t count, unsigned parts, I const *indices, T const *input, T *output, T *column)noexcept{
+	std::size_t const quotient{count / parts}, remainder{count % parts};
+	auto slicefirst{[quotient, remainder](unsigned part)noexcept{
+		return quotient * part + std::min(static_cast<std::size_t>(part), remainder);
+	}};
+	keyvalueforparts(0u, parts, [&](unsigned part)noexcept{
+		permutationgather<T, I>(slicefirst(part), slicefirst(part + 1u), indices, input, output);
+	});
+	// all parts have to be gathered before any part of the column is overwritten
+	if(column) keyvalueforparts(0u, parts, [&](unsigned part)noexcept{
+		std::size_t const first{slicefirst(part)};
+		std::memcpy(column + first, output + first, (slicefirst(part + 1u) - first) * sizeof(T));
+	});
+}
+
+// Helper functions for partial sorting
+
+// move the items that can be among the first k items of the sorting order to the front of the array, starting at the most significant digit, and return the number of these items
+// only the candidates are counted for a digit: the retained items of which all the higher digits are the same as those of the k-th item, the other retained items are certainly among the first k items
+// this stops as soon as at most twice k items are retained, and the retained items keep their order, so sorting these gives the same first k items as sorting all items
+template<bool isdescsort, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL std::size_t partialselect(std::size_t count, std::size_t k, T *input)noexcept{
+	assert(k && count > k);
+	static unsigned constexpr radix{typeradix<T>};
+	static unsigned constexpr bits{CHAR_BIT * sizeof(T)};
+	std::size_t counts[static_cast<std::size_t>(1u) << radix];
+	std::size_t retained{count};
+	T prefix{};// the higher digits of the candidates
+	unsigned prefixshift{bits};// all retained items are candidates at the start
+	for(unsigned pass{offsetsloopcount<T>}; pass-- && k < retained >> 1;){
+		unsigned const shift{pass * radix};
+		unsigned const width{std::min(radix, bits - shift)};
+		T const mask{static_cast<T>((static_cast<T>(1u) << (width - 1u) << 1) - 1u)};
+		auto iscandidate{[prefix, prefixshift](T key)noexcept{
+			return bits == prefixshift || prefix == static_cast<T>(key >> prefixshift);
+		}};
+		std::memset(counts, 0, (static_cast<std::size_t>(1u) << width) * sizeof(std::size_t));
+		std::size_t certain{};
+		for(std::size_t i{}; retained > i; ++i){
+			T const key{presortedkey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(input[i])};
+			if(iscandidate(key)) ++counts[key >> shift & mask];
+			else ++certain;
+		}
+		// find the digit of the k-th item, the certain items go before all candidates
+		assert(certain < k);
+		std::size_t const needed{k - certain};
+		std::size_t total{};
+		T bucket{};
+		for(;; ++bucket){
+			total += counts[bucket];
+			if(needed <= total) break;
+		}
+		if(retained - certain != total){// discard the candidates with a higher digit, the order of the retained items is kept
+			std::size_t kept{};
+			for(std::size_t i{}; retained > i; ++i){
+				T const key{presortedkey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(input[i])};
+				if(!iscandidate(key) || bucket >= (key >> shift & mask)){
+					if(kept != i) std::swap(input[kept], input[i]);
+					++kept;
+				}
+			}
+			retained = kept;
+		}
+		prefix = (bits == prefixshift)? bucket : static_cast<T>(prefix << (width - 1u) << 1 | bucket);
+		prefixshift = shift;
 	}
-	if constexpr(UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= count){
-		singlethreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, unsigned>);
+	return{retained};
+}
+
+// Helper functions for selecting items by their rank
+
+// count the digit of the candidates of every rank for a part of the items, the first pass has a single histogram for all ranks
+template<bool isdescsort, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL void selectcount(std::size_t first, std::size_t last, T const *RSBD8_RESTRICT input, std::size_t histograms, T const *RSBD8_RESTRICT pprefixes, unsigned prefixshift, unsigned shift, T mask, std::size_t *RSBD8_RESTRICT pcounts)noexcept{
+	static unsigned constexpr radix{typeradix<T>};
+	static unsigned constexpr bits{CHAR_BIT * sizeof(T)};
+	for(std::size_t i{first}; last > i; ++i){
+		T const key{presortedkey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(input[i])};
+		std::size_t const digit{static_cast<std::size_t>(key >> shift & mask)};
+		if(bits == prefixshift) ++pcounts[digit];
+		else for(std::size_t r{}; histograms > r; ++r){
+			if(pprefixes[r] == static_cast<T>(key >> prefixshift)) ++pcounts[r << radix | digit];
+		}
 	}
-	if constexpr(USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= count){
-		singlethreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, unsigned short>);
+}
+
+// move the candidates of all ranks to the output array (which can be the input array), keeping their order, and return the number of these
+template<bool isdescsort, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL std::size_t selectgather(std::size_t count, T const *input, T *output, std::size_t rankcount, T const *RSBD8_RESTRICT pprefixes, unsigned prefixshift)noexcept{
+	std::size_t kept{};
+	for(std::size_t i{}; count > i; ++i){
+		T const cur{input[i]};
+		T const key{presortedkey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(cur)};
+		for(std::size_t r{}; rankcount > r; ++r){
+			if(pprefixes[r] == static_cast<T>(key >> prefixshift)){
+				output[kept++] = cur;
+				break;
+			}
+		}
 	}
-	if constexpr(UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= count){
-		singlethreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, unsigned char>);
+	return{kept};
+}
+
+// find the item of every rank in the sorting order, starting at the most significant digit, and only counting the next digit for the candidates: the items of which all the higher digits are the same as those of the item of the rank
+// the candidates are moved to a buffer as soon as they are at most half of the items that are counted, and the order of equal items decides between the candidates with the same key in the end
+// the histogram of the most significant digit can be given to skip the first pass, as counted by histogramcount()
+// false is returned if the memory cannot be allocated, while a failure to allocate the buffer only causes the next passes to read all the items again
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL bool selectranks(std::size_t count, T const *input, std::size_t rankcount, std::size_t const *ranks, T *outputs, std::size_t const *ptopcounts
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	, unsigned allowedthreads
+#endif
+	)noexcept{
+	assert(count && rankcount);
+	static unsigned constexpr radix{typeradix<T>};
+	static unsigned constexpr bits{CHAR_BIT * sizeof(T)};
+	unsigned const maximumparts{keyvalueparts<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+		)};
+	std::size_t *pcounts{new(std::nothrow) std::size_t[(maximumparts * rankcount << radix) + rankcount]};
+	if(!pcounts)RSBD8_UNLIKELY return{false};
+	T *pprefixes{new(std::nothrow) T[rankcount]};
+	if(!pprefixes)RSBD8_UNLIKELY{
+		delete[] pcounts;
+		return{false};
 	}
-	std::size_t allocsize{singlethreadindicessize};
-	if constexpr(isbufferallocated) allocsize += count * (isbufferpointers? sizeof(void *) : sizeof(T));
-	if constexpr(1u < std::hardware_constructive_interference_size){// use cache line alignment for performance
-		allocsize += std::hardware_constructive_interference_size - 1u;// round up
-		allocsize &= -static_cast<std::ptrdiff_t>(std::hardware_constructive_interference_size);// finalise cache line alignment
+	std::size_t *premaining{pcounts + (maximumparts * rankcount << radix)};// the rank among the candidates
+	for(std::size_t r{}; rankcount > r; ++r){
+		assert(count > ranks[r]);
+		premaining[r] = ranks[r];
 	}
+	T const *data{input};
+	T *pbuffer{};
+	std::size_t datacount{count};
+	unsigned prefixshift{bits};// all items are candidates at the start
+	for(unsigned pass{offsetsloopcount<T>}; pass--;){
+		unsigned const shift{pass * radix};
+		unsigned const width{std::min(radix, bits - shift)};
+		T const mask{static_cast<T>((static_cast<T>(1u) << (width - 1u) << 1) - 1u)};
+		std::size_t const histograms{(bits == prefixshift)? 1u : rankcount};
+		std::size_t const stride{histograms << radix};
+		if(bits == prefixshift && ptopcounts) std::memcpy(pcounts, ptopcounts, (static_cast<std::size_t>(1u) << width) * sizeof(std::size_t));
+		else{
+			unsigned const parts{keyvalueparts<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(datacount
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				, allowedthreads
+#endif
+				)};
+			std::memset(pcounts, 0, parts * stride * sizeof(std::size_t));
+			keyvalueforparts(0u, parts, [datacount, parts, data, histograms, pprefixes, prefixshift, shift, mask, stride, pcounts](unsigned part)noexcept{
+				selectcount<isdescsort, isabsvalue, issignmode, isfltpmode, T>(datacount * part / parts, datacount * (part + 1u) / parts, data, histograms, pprefixes, prefixshift, shift, mask, pcounts + part * stride);
+			});
+			for(unsigned part{1u}; parts > part; ++part){
+				std::size_t const *pcountspart{pcounts + part * stride};
+				for(std::size_t i{}; stride > i; ++i) pcounts[i] += pcountspart[i];
+			}
+		}
+		// find the digit of every rank, the lower digits of the candidates go before it
+		std::size_t candidates{};// this counts equal prefixes more than once
+		for(std::size_t r{}; rankcount > r; ++r){
+			std::size_t const *pcountsrank{pcounts + ((1u == histograms)? 0u : r << radix)};
+			std::size_t remaining{premaining[r]};
+			T bucket{};
+			while(remaining >= pcountsrank[bucket]) remaining -= pcountsrank[bucket++];
+			premaining[r] = remaining;
+			candidates += pcountsrank[bucket];
+			pprefixes[r] = (bits == prefixshift)? bucket : static_cast<T>(pprefixes[r] << (width - 1u) << 1 | bucket);
+		}
+		prefixshift = shift;
+		if(pass && candidates <= datacount >> 1){// the next passes only go over the candidates
+			if(!pbuffer) pbuffer = new(std::nothrow) T[candidates];
+			if(pbuffer){
+				datacount = selectgather<isdescsort, isabsvalue, issignmode, isfltpmode, T>(datacount, data, pbuffer, rankcount, pprefixes, prefixshift);
+				data = pbuffer;
+			}
+		}
+	}
+	// all items with the full key of a rank are equal in the sorting order, so pick the item of the rank among these in the order of equal items
+	for(std::size_t r{}; rankcount > r; ++r){
+		std::size_t remaining{premaining[r]};
+		for(std::size_t i{}; datacount > i; ++i){
+			T const cur{data[isrevorder? datacount - 1u - i : i]};
+			if(pprefixes[r] == presortedkey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(cur)){
+				if(!remaining--){
+					outputs[r] = cur;
+					break;
+				}
+			}
+		}
+	}
+	delete[] pbuffer;
+	delete[] pprefixes;
+	delete[] pcounts;
+	return{true};
+}
+
+// Helper functions for counting the digits of all sorting passes
+
+// count the digits of all sorting passes for a part of the items, in the order of the sorting direction
+template<bool isdescsort, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL void histogramcount(std::size_t first, std::size_t last, T const *RSBD8_RESTRICT input, std::size_t *RSBD8_RESTRICT pcounts)noexcept{
+	for(std::size_t i{first}; last > i; ++i){
+		T const key{presortedkey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(input[i])};
+		for(unsigned pass{}; offsetsloopcount<T> > pass; ++pass) ++pcounts[globalhistogrambucket<T>(key, pass)];
+	}
+}
+
+// count the digits of all sorting passes of the items into the zeroed counts, split over the allowed threads with the 2-way multithreading threshold
+// the other parts count into a temporary array, and a failure to allocate that only causes the counting to be single-threaded
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_NORMAL void histogramcountall(std::size_t count, T const *input, std::size_t *pcounts
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	, unsigned allowedthreads
+#endif
+	)noexcept{
+	static std::size_t constexpr length{static_cast<std::size_t>(offsetsloopcount<T>) << typeradix<T>};
+	unsigned parts{keyvalueparts<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+		)};
+	std::size_t *pother{};
+	if(1u < parts){
+		pother = new(std::nothrow) std::size_t[(parts - 1u) * length]{};
+		if(!pother)RSBD8_UNLIKELY parts = 1u;
+	}
+	keyvalueforparts(0u, parts, [count, parts, input, pcounts, pother](unsigned part)noexcept{
+		histogramcount<isdescsort, isabsvalue, issignmode, isfltpmode, T>(count * part / parts, count * (part + 1u) / parts, input, part? pother + (part - 1u) * length : pcounts);
+	});
+	for(unsigned part{1u}; parts > part; ++part){
+		std::size_t const *pcountspart{pother + (part - 1u) * length};
+		for(std::size_t i{}; length > i; ++i) pcounts[i] += pcountspart[i];
+	}
+	delete[] pother;
+}
+
+// Helper functions for sorting with the removal of equal items
+
+// sort the items with the index counts of all digits, and drop the equal items in the last sorting pass that is not skipped, the number of remaining items is returned
+// the equal items end up next to each other in every bucket of the last sorting pass, as the lower digits are in order already, so every item is only compared to the last one written to its bucket
+// the gaps that the dropped items leave at the end of the buckets are closed afterwards, which only moves the items behind the first gap
+// the input array can be the output array, and the remaining items always end up in the output array
+template<bool isdescsort, bool isrevorder, bool iskeeplast, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL std::size_t uniquesort(std::size_t count, std::size_t *RSBD8_RESTRICT pcounts, T const *input, T *output, T *buffer)noexcept{
+	assert(count);
+	static std::size_t constexpr digitmask{(static_cast<std::size_t>(1u) << typeradix<T>) - 1u};
+	// find the last sorting pass that is not skipped
+	unsigned passcount{}, lastpass{};
+	for(unsigned pass{}; offsetsloopcount<T> > pass; ++pass){
+		std::size_t const *poffsets{pcounts + (static_cast<std::size_t>(pass) << typeradix<T>)};
+		std::size_t const *poffsetsend{poffsets + globalhistogramlength<isabsvalue, issignmode, isfltpmode, T>(pass)};
+		if(poffsetsend == std::find(poffsets, poffsetsend, count)){// otherwise all items have the same digit here
+			++passcount;
+			lastpass = pass;
+		}
+	}
+	if(!passcount){// all items are equal, so only one of them remains
+		output[0] = input[(isrevorder != iskeeplast)? count - 1u : 0u];
+		return{1u};
+	}
+	// the last sorting pass writes to the output array if possible, but sorting in place cannot start with it
+	T const *psource{input};
+	T *pdestination{(input != output && passcount & 1u)? output : buffer};
+	bool isfirst{true};
+	std::size_t starts[digitmask + 1u];// the offsets of the buckets of the last sorting pass
+	for(unsigned pass{}; lastpass >= pass; ++pass){
+		std::size_t *RSBD8_RESTRICT poffsets{pcounts + (static_cast<std::size_t>(pass) << typeradix<T>)};
+		std::size_t const length{globalhistogramlength<isabsvalue, issignmode, isfltpmode, T>(pass)};
+		std::size_t offset{};
+		bool isskipped{};
+		for(std::size_t i{}; length > i; ++i){
+			std::size_t &elem{poffsets[isdescsort? length - 1u - i : i]};
+			std::size_t const cur{elem};
+			if(count == cur){// all items have the same digit here
+				isskipped = true;
+				break;
+			}
+			elem = offset;
+			offset += cur;
+		}
+		if(isskipped) continue;
+		if(lastpass == pass) std::memcpy(starts, poffsets, length * sizeof(std::size_t));
+		T *pscatter{pdestination};
+		auto scatter{[pass, lastpass, pcounts, pscatter, &starts](T cur)noexcept{
+			T const key{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur)};
+			std::size_t const bucket{globalhistogrambucket<T>(key, pass)};
+			std::size_t &end{pcounts[bucket]};
+			if(lastpass == pass && starts[bucket & digitmask] != end && key == globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(pscatter[end - 1u])){
+				if constexpr(iskeeplast) pscatter[end - 1u] = cur;// the later item replaces the earlier one
+			}else pscatter[end++] = cur;
+		}};
+		if(isrevorder && isfirst){// the first sorting pass reads the items in reverse
+			for(std::size_t i{count}; i;) scatter(psource[--i]);
+		}else for(std::size_t i{}; count > i; ++i) scatter(psource[i]);
+		isfirst = false;
+		psource = pdestination;
+		pdestination = (output == pdestination)? buffer : output;
+	}
+	// close the gaps between the buckets, in the order of the sorting direction
+	std::size_t const *poffsets{pcounts + (static_cast<std::size_t>(lastpass) << typeradix<T>)};
+	std::size_t const length{globalhistogramlength<isabsvalue, issignmode, isfltpmode, T>(lastpass)};
+	std::size_t remaining{};
+	for(std::size_t i{}; length > i; ++i){
+		std::size_t const bucket{isdescsort? length - 1u - i : i};
+		std::size_t const start{starts[bucket]};
+		std::size_t const size{poffsets[bucket] - start};
+		if(size && (output != psource || remaining != start)) std::memmove(output + remaining, psource + start, size * sizeof(T));
+		remaining += size;
+	}
+	return{remaining};
+}
+
+// Helper functions for grouping sorted items
+
+// count the runs of equal keys that start in a part of the sorted keys
+template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL std::size_t groupstarts(std::size_t first, std::size_t last, T const *RSBD8_RESTRICT keys)noexcept{
+	std::size_t starts{};
+	T previous{first? globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(keys[first - 1u]) : static_cast<T>(~globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(keys[0]))};
+	for(std::size_t i{first}; last > i; ++i){
+		T const key{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(keys[i])};
+		starts += previous != key;
+		previous = key;
+	}
+	return{starts};
+}
+
+// write the first key, the number of items and the aggregate of the payloads of every run of equal keys that starts in a part of the sorted keys, from the given position onwards
+// a run that continues into the next parts is completed here, so the parts do not need to be merged afterwards, and the payloads of a run are always aggregated in the same order
+template<groupaggregate aggregate, bool isaggregated, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, typename P, typename A>
+RSBD8_FUNC_NORMAL void groupwrite(std::size_t count, std::size_t first, std::size_t last, std::size_t position, T const *RSBD8_RESTRICT keys, P const *RSBD8_RESTRICT payloads, T *RSBD8_RESTRICT outkeys, std::size_t *RSBD8_RESTRICT outcounts, A *RSBD8_RESTRICT outaggregates)noexcept{
+	std::size_t i{first};
+	if(first){// skip the rest of a run that started in an earlier part
+		T const previous{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(keys[first - 1u])};
+		while(last > i && previous == globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(keys[i])) ++i;
+	}
+	while(last > i){
+		T const cur{keys[i]};
+		T const key{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur)};
+		std::size_t j{i + 1u};
+		if constexpr(isaggregated){
+			A total{static_cast<A>(payloads[i])};
+			for(; count > j && key == globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(keys[j]); ++j){
+				A const value{static_cast<A>(payloads[j])};
+				if constexpr(groupaggregate::sum == aggregate) total += value;
+				else if constexpr(groupaggregate::minimum == aggregate){
+					if(value < total) total = value;
+				}else if(total < value) total = value;
+			}
+			outaggregates[position] = total;
+		}else while(count > j && key == globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(keys[j])) ++j;
+		outkeys[position] = cur;
+		if(outcounts) outcounts[position] = j - i;
+		++position;
+		i = j;
+	}
+}
+
+// group the sorted keys and payloads into the output arrays with the allowed threads, and return the number of groups
+// every part first counts the runs that start in it, after which the output positions of the parts are known, and every part then writes its own runs
+template<groupaggregate aggregate, bool isaggregated, bool isabsvalue, bool issignmode, bool isfltpmode, typename T, typename P, typename A>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL std::size_t groupsorted(std::size_t count, unsigned parts, std::size_t *RSBD8_RESTRICT pstarts, T const *keys, P const *payloads, T *outkeys, std::size_t *outcounts, A *outaggregates)noexcept{
+	assert(count && parts);
+	keyvalueforparts(0u, parts, [count, parts, pstarts, keys](unsigned part)noexcept{
+		pstarts[part] = groupstarts<isabsvalue, issignmode, isfltpmode, T>(count * part / parts, count * (part + 1u) / parts, keys);
+	});
+	std::size_t groups{};
+	for(unsigned part{}; parts > part; ++part){
+		std::size_t const cur{pstarts[part]};
+		pstarts[part] = groups;
+		groups += cur;
+	}
+	keyvalueforparts(0u, parts, [count, parts, pstarts, keys, payloads, outkeys, outcounts, outaggregates](unsigned part)noexcept{
+		groupwrite<aggregate, isaggregated, isabsvalue, issignmode, isfltpmode, T, P, A>(count, count * part / parts, count * (part + 1u) / parts, pstarts[part], keys, payloads, outkeys, outcounts, outaggregates);
+	});
+	return{groups};
+}
+
+// Helper functions for sorting variable-length strings
+
+// the buckets of fewer strings than this are sorted by insertion sort on the remaining bytes
+std::size_t constexpr stringinsertionsortmaximum{32u};
+// the minimum number of strings for every thread that processes the child buckets of a split
+std::size_t constexpr stringminimumpart{static_cast<std::size_t>(1u) << 15};
+// the number of buckets of a string digit: one for the strings that end before it, and one for every byte value
+unsigned constexpr stringbuckets{1u + (1u << 8)};
+
+// the next 8 bytes of a string from the given depth onwards as a big-endian integer, zero-padded after the end
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::uint_least64_t stringprefix(std::string_view cur, std::size_t depth)noexcept{
+	std::uint_least64_t prefix{};
+	std::size_t const size{cur.size()};
+	for(std::size_t i{depth}; depth + 8u > i; ++i){
+		prefix <<= 8;
+		if(size > i) prefix |= static_cast<unsigned char>(cur[i]);
+	}
+	return{prefix};
+}
+
+// the bucket of a string at the given depth, the byte is taken from the cached prefix, which starts at the last multiple of 8 bytes
+RSBD8_NODISCARD RSBD8_FUNC_INLINE unsigned stringbucket(std::size_t size, std::uint_least64_t prefix, std::size_t depth)noexcept{
+	return{(size > depth)? 1u + static_cast<unsigned>(prefix >> (56u - 8u * static_cast<unsigned>(depth & 7u)) & 0xFFu) : 0u};
+}
+
+// stable insertion sort of a small bucket of strings of which the first depth bytes are equal
+template<bool isdescsort>
+RSBD8_FUNC_NORMAL void stringinsertionsort(std::size_t count, std::size_t depth, std::string_view *RSBD8_RESTRICT input)noexcept{
+	for(std::size_t i{1u}; count > i; ++i){
+		std::string_view const cur{input[i]};
+		std::string_view const curtail{cur.data() + depth, cur.size() - depth};
+		std::size_t j{i};
+		for(; j; --j){
+			std::string_view const previous{input[j - 1u]};
+			int const comparison{curtail.compare(std::string_view{previous.data() + depth, previous.size() - depth})};
+			if(isdescsort? 0 >= comparison : 0 <= comparison) break;
+			input[j] = previous;
+		}
+		input[j] = cur;
+	}
+}
+
+// sort a bucket of strings of which the first depth bytes are equal, one byte per sorting pass, with the next bytes cached in the prefixes
+// every sorting pass scatters the strings and prefixes to the buffers and copies them back, which keeps the sort stable
+// the largest child bucket is processed in the loop instead of recursively, which limits the recursion depth to the logarithm of the count
+// with more than one allowed thread, the child buckets of a split are divided over the threads in contiguous groups of about the same number of strings
+template<bool isdescsort>
+RSBD8_FUNC_NORMAL void stringsortbucket(std::size_t count, std::size_t depth, std::string_view *RSBD8_RESTRICT input, std::uint_least64_t *RSBD8_RESTRICT prefixes, std::string_view *RSBD8_RESTRICT buffer, std::uint_least64_t *RSBD8_RESTRICT bufferprefixes
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	, unsigned allowedthreads
+#endif
+	)noexcept{
+	for(;;){
+		if(stringinsertionsortmaximum > count){
+			stringinsertionsort<isdescsort>(count, depth, input);
+			return;
+		}
+		if(depth && !(depth & 7u)) for(std::size_t i{}; count > i; ++i) prefixes[i] = stringprefix(input[i], depth);// the cached bytes are used up
+		std::size_t offsets[stringbuckets]{};
+		for(std::size_t i{}; count > i; ++i) ++offsets[stringbucket(input[i].size(), prefixes[i], depth)];
+		if(count == offsets[0]) return;// all strings end here, so these are equal
+		if(count == *std::max_element(offsets + 1, offsets + stringbuckets)){// all strings have the same byte here
+			++depth;
+			continue;
+		}
+		std::size_t starts[stringbuckets];
+		std::size_t offset{};
+		for(unsigned i{}; stringbuckets > i; ++i){
+			unsigned const bucket{isdescsort? stringbuckets - 1u - i : i};
+			starts[bucket] = offset;
+			offset += offsets[bucket];
+			offsets[bucket] = starts[bucket];
+		}
+		for(std::size_t i{}; count > i; ++i){
+			std::size_t const destination{offsets[stringbucket(input[i].size(), prefixes[i], depth)]++};
+			buffer[destination] = input[i];
+			bufferprefixes[destination] = prefixes[i];
+		}
+		std::memcpy(input, buffer, count * sizeof(std::string_view));
+		std::memcpy(prefixes, bufferprefixes, count * sizeof(std::uint_least64_t));
+		// the strings of the first bucket end here, so these are equal and done
+		++depth;
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned const parts{static_cast<unsigned>(std::min({static_cast<std::size_t>(allowedthreads), static_cast<std::size_t>(stringbuckets - 1u), count / stringminimumpart}))};
+		if(1u < parts){// divide the child buckets over the threads, offsets now holds the ends of the buckets
+			unsigned partfirst[stringbuckets];
+			unsigned part{};
+			partfirst[0] = 1u;
+			std::size_t total{};
+			for(unsigned i{1u}; stringbuckets > i; ++i){
+				while(parts > part + 1u && total >= count / parts * (part + 1u)) partfirst[++part] = i;
+				total += offsets[i] - starts[i];
+			}
+			while(parts > part + 1u) partfirst[++part] = stringbuckets;
+			partfirst[parts] = stringbuckets;
+			keyvalueforparts(0u, parts, [count, depth, input, prefixes, buffer, bufferprefixes, allowedthreads, &starts, &offsets, &partfirst](unsigned part)noexcept{
+				for(unsigned i{partfirst[part]}; partfirst[part + 1u] > i; ++i){
+					std::size_t const size{offsets[i] - starts[i]};
+					if(1u < size) stringsortbucket<isdescsort>(size, depth, input + starts[i], prefixes + starts[i], buffer + starts[i], bufferprefixes + starts[i],
+						static_cast<unsigned>(std::max(static_cast<std::size_t>(allowedthreads) * size / count, static_cast<std::size_t>(1u))));
+				}
+			});
+			return;
+		}
+#endif
+		unsigned largest{1u};
+		for(unsigned i{2u}; stringbuckets > i; ++i) if(offsets[i] - starts[i] > offsets[largest] - starts[largest]) largest = i;
+		for(unsigned i{1u}; stringbuckets > i; ++i){
+			std::size_t const size{offsets[i] - starts[i]};
+			if(largest != i && 1u < size) stringsortbucket<isdescsort>(size, depth, input + starts[i], prefixes + starts[i], buffer + starts[i], bufferprefixes + starts[i]
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				, 1u
+#endif
+				);
+		}
+		count = offsets[largest] - starts[largest];
+		input += starts[largest];
+		prefixes += starts[largest];
+		buffer += starts[largest];
+		bufferprefixes += starts[largest];
+	}
+}
+
+// Helper functions for sorting keys wider than 128 bits
+
+// the minimum number of items of every part, as every part has its own counts for all the sorting passes
+std::size_t constexpr wideminimumpart{static_cast<std::size_t>(1) << 14};
+
+// the number of counts of every part, the counts of all sorting passes followed by the high offsets of the current sorting pass
+template<typename T>
+std::size_t constexpr widecountslength{(sizeof(T) + 1u) << 8};
+
+// the number of parts to split the items into
+RSBD8_NODISCARD RSBD8_FUNC_INLINE unsigned wideparts(std::size_t count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	, unsigned allowedthreads
+#endif
+	)noexcept{
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	std::size_t const maximum{count / wideminimumpart};
+	return{static_cast<unsigned>(std::max(std::min(static_cast<std::size_t>(allowedthreads), maximum), static_cast<std::size_t>(1u)))};
+#else// single-threaded-only
+	static_cast<void>(count);
+	return{1u};
+#endif
+}
+
+// the digit of a key for a sorting pass, one byte per sorting pass, starting at the least significant byte
+// the bytes order has the most significant byte first, and the words order has the least significant 64-bit word first, with every word in the native byte order
+template<widekeyorder order, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::size_t widedigit(T const &key, unsigned pass)noexcept{
+	if constexpr(widekeyorder::bytes == order){
+		return{reinterpret_cast<unsigned char const *>(&key)[sizeof(T) - 1u - pass]};
+	}else{
+		std::uint_least64_t word;
+		std::memcpy(&word, reinterpret_cast<std::byte const *>(&key) + (pass >> 3) * sizeof(std::uint_least64_t), sizeof(std::uint_least64_t));
+		return{static_cast<std::size_t>(word >> ((pass & 7u) << 3) & 0xFFu)};
+	}
+}
+
+// count the digits of all sorting passes of a slice of the items
+template<widekeyorder order, typename T, typename W, typename F>
+RSBD8_FUNC_NORMAL void widecount(std::size_t count, W const *RSBD8_RESTRICT input, std::size_t *RSBD8_RESTRICT pcounts, F const &getkey)noexcept{
+	for(std::size_t i{count}; i; --i){
+		T const key{getkey(*input++)};
+		for(unsigned pass{}; sizeof(T) > pass; ++pass) ++pcounts[static_cast<std::size_t>(pass) << 8 | widedigit<order, T>(key, pass)];
+	}
+}
+
+// scatter a part of the items to their positions for a sorting pass, like keyvaluescatter() does for keys and payloads
+template<bool isreversed, widekeyorder order, typename T, typename W, typename F>
+RSBD8_FUNC_NORMAL void widescatter(std::size_t count, std::size_t first, std::size_t last, unsigned pass, std::size_t *RSBD8_RESTRICT plow, std::size_t *RSBD8_RESTRICT phigh, W const *RSBD8_RESTRICT input, W *RSBD8_RESTRICT output, F const &getkey)noexcept{
+	std::ptrdiff_t const step{isreversed? -1 : 1};
+	std::size_t front{isreversed? count - 1u - first : first}, back{isreversed? count - last : last - 1u};
+	for(std::size_t i{(last - first) >> 1}; i; --i){
+		W const &itemfront{input[front]};
+		W const &itemback{input[back]};
+		output[plow[widedigit<order, T>(getkey(itemfront), pass)]++] = itemfront;
+		output[--phigh[widedigit<order, T>(getkey(itemback), pass)]] = itemback;
+		front += static_cast<std::size_t>(step);
+		back -= static_cast<std::size_t>(step);
+	}
+	if(1u & (last - first)){// the middle item
+		W const &item{input[front]};
+		output[plow[widedigit<order, T>(getkey(item), pass)]++] = item;
+	}
+}
+
+// sort the items by their wide keys in least significant digit order, every part counts and scatters its own slice of the array in every sorting pass, like keyvaluesort() does
+// a sorting pass is skipped if all keys have the same digit in it, and the sorting passes alternate between the input and buffer arrays, the result ends up in the input array
+// the items are either the keys themselves or pointers to the keys, getkey() returns the key of an item, and the counts of all the parts have to be zeroed beforehand
+template<bool isdescsort, bool isrevorder, widekeyorder order, typename T, typename W, typename F>
+RSBD8_FUNC_NORMAL void widesort(std::size_t count, unsigned parts, std::size_t *RSBD8_RESTRICT pzeroedcounts, W *input, W *buffer, F const &getkey)noexcept{
+	assert(1u < count);
+	assert(parts);
+	static std::size_t constexpr high{sizeof(T) << 8};
+	static std::size_t constexpr stride{widecountslength<T>};
+	// equal slices, with the remainder distributed over the first parts
+	std::size_t const quotient{count / parts}, remainder{count % parts};
+	auto slicefirst{[quotient, remainder](unsigned part)noexcept{
+		return quotient * part + std::min(static_cast<std::size_t>(part), remainder);
+	}};
+
+	// count all digits of every slice in one go, the first sorting pass uses the mirrored slice for the reverse order
+	keyvalueforparts(0u, parts, [&](unsigned part)noexcept{
+		std::size_t const first{slicefirst(part)}, last{slicefirst(part + 1u)};
+		widecount<order, T, W, F>(last - first, input + (isrevorder? count - last : first), pzeroedcounts + part * stride, getkey);
+	});
+	// plan the sorting passes, a pass is skipped if all keys have the digit of the first key in it
+	unsigned passes[sizeof(T)];
+	unsigned passcount{};
+	{
+		T const key{getkey(*input)};
+		for(unsigned pass{}; sizeof(T) > pass; ++pass){
+			std::size_t const bucket{static_cast<std::size_t>(pass) << 8 | widedigit<order, T>(key, pass)};
+			std::size_t total{};
+			for(unsigned part{}; parts > part; ++part) total += pzeroedcounts[part * stride + bucket];
+			if(count != total) passes[passcount++] = pass;
+		}
+	}
+	if(!passcount){// all keys are equal, but their order may still have to be reversed
+		if constexpr(isrevorder) std::reverse(input, input + count);
+		return;
+	}
+	W *targets[2]{buffer, input};
+	W const *source{input};
+	for(unsigned index{}; passcount > index; ++index){
+		unsigned const pass{passes[index]};
+		std::size_t const base{static_cast<std::size_t>(pass) << 8};
+		if(index && 1u < parts){// count the digits of this pass in every slice, using the output of the previous pass
+			keyvalueforparts(0u, parts, [&](unsigned part)noexcept{
+				std::size_t const first{slicefirst(part)}, last{slicefirst(part + 1u)};
+				std::size_t *RSBD8_RESTRICT pcounts{pzeroedcounts + part * stride + base};
+				std::memset(pcounts, 0, (static_cast<std::size_t>(1u) << 8) * sizeof(std::size_t));
+				W const *RSBD8_RESTRICT pinput{source + first};
+				for(std::size_t i{last - first}; i; --i) ++pcounts[widedigit<order, T>(getkey(*pinput++), pass)];
+			});
+		}
+		// turn the counts into the low and high offsets of every part, the parts are visited in the order of their slices, this keeps the sort stable
+		std::size_t offset{};
+		for(std::size_t i{}; (static_cast<std::size_t>(1u) << 8) > i; ++i){
+			std::size_t const digit{isdescsort? 0xFFu - i : i};
+			for(unsigned part{}; parts > part; ++part){
+				std::size_t *RSBD8_RESTRICT pcounts{pzeroedcounts + part * stride};
+				std::size_t const cur{pcounts[base + digit]};
+				pcounts[base + digit] = offset;
+				offset += cur;
+				pcounts[high + digit] = offset;
+			}
+		}
+		assert(count == offset);
+		W *RSBD8_RESTRICT poutput{targets[index & 1u]};
+		keyvalueforparts(0u, parts, [&](unsigned part)noexcept{
+			std::size_t *RSBD8_RESTRICT pcounts{pzeroedcounts + part * stride};
+			if(isrevorder && !index) widescatter<isrevorder, order, T, W, F>(count, slicefirst(part), slicefirst(part + 1u), pass, pcounts + base, pcounts + high, source, poutput, getkey);
+			else widescatter<false, order, T, W, F>(count, slicefirst(part), slicefirst(part + 1u), pass, pcounts + base, pcounts + high, source, poutput, getkey);
+		});
+		source = poutput;
+	}
+	if(input != source) std::memcpy(input, source, count * sizeof(W));// the number of sorting passes is odd
+}
+
+// Helper functions for sorting by several keys
+
+// the combined key of an item, the filtered keys are stored with the most significant byte first, in the order of the keys
+template<std::size_t size>
+struct multikeybytes{
+	unsigned char bytes[size];
+};
+
+// an item to sort, the combined key together with the pointer to the item
+template<std::size_t size, typename V>
+struct multikeyitem{
+	multikeybytes<size> key;
+	V *pointer;
+};
+
+// write a key to its place in the combined key, filtered in the same way as the sorting functions without a merging phase do, and with all bits inverted for the descending sorting direction
+// sorting the combined keys by their bytes then gives the order of all sorting modes and sorting directions of the keys
+template<bool isdescsort, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_FUNC_INLINE void multikeywrite(T value, unsigned char *RSBD8_RESTRICT out)noexcept{
+	using U = tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static_assert(sizeof(T) == sizeof(U), "misinterpreted key type");
+	U key;
+	std::memcpy(&key, &value, sizeof(U));
+	key = globalhistogramkey<isabsvalue, issignmode, isfltpmode, U>(key);
+	if constexpr(isdescsort) key = static_cast<U>(~key);
+	for(std::size_t i{}; sizeof(U) > i; ++i) out[i] = static_cast<unsigned char>(key >> ((sizeof(U) - 1u - i) * CHAR_BIT));
+}
+
+// Helper functions for external sorting of files
+
+// the maximum number of run files that are merged at once, this limits the number of simultaneously open files
+unsigned constexpr externalsortmaxfanin{128u};
+// the minimum size in bytes of a block of a file in the merging phase, fewer runs are merged at once if the memory budget does not allow blocks of at least this size
+std::size_t constexpr externalsortminblocksize{static_cast<std::size_t>(1) << 20};
+
+// this class reads a file sequentially in blocks, the next block is read asynchronously while the caller processes the current one
+template<typename T>
+class externalreader{
+	std::FILE *file{};
+	T *ppending{};// the destination of the block that is being read, or a nullptr once the end of the file is reached
+	std::size_t capacity{};// the number of items in a block
+	std::size_t pendingsize{};// the number of bytes read if the block was not read asynchronously
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	taskfuture<std::size_t> pending;
+#endif
+	bool isfailed{};
+
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL static std::size_t readblock(std::FILE *pfile, T *pdata, std::size_t count)noexcept{
+		return{std::fread(pdata, 1u, count * sizeof(T), pfile)};
+	}
+
+	RSBD8_FUNC_NORMAL void launch(T *pdata)noexcept{
+		ppending = pdata;
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		try{
+			pending = launchasync(&externalreader::readblock, file, pdata, capacity);
+			return;
+		}catch(...){}// launchasync() may fail gracefully here, simply read the block synchronously then
+#endif
+		pendingsize = readblock(file, pdata, capacity);
+	}
+
+public:
+	// disable copy and move mechanisms
+	externalreader(externalreader const &) = delete;
+	externalreader &operator=(externalreader const &) = delete;
+	externalreader()noexcept = default;
+	RSBD8_FUNC_NORMAL ~externalreader()noexcept{
+		close();
+	}
+
+	// open the file and start reading the first block into pfirst, false is returned if the file cannot be opened
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL bool open(char const *filename, T *pfirst, std::size_t blockcount)noexcept{
+		assert(!file);
+		assert(blockcount);
+		file = std::fopen(filename, "rb");
+		if(!file)RSBD8_UNLIKELY return{false};
+		capacity = blockcount;
+		launch(pfirst);
+		return{true};
+	}
+
+	// wait for the block that is being read, and start reading the next block into pnext, unless the end of the file was reached
+	// the number of items in the block is returned, 0 means that the end of the file was reached or that reading failed
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL std::size_t fetch(T *pnext, T *&pdata)noexcept{
+		if(!ppending) return{};
+		std::size_t size{pendingsize};
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		if(pending.valid()) size = pending.get();
+#endif
+		pdata = ppending;
+		ppending = nullptr;
+		if(size % sizeof(T) || std::ferror(file))RSBD8_UNLIKELY{// a read error, or the size of the file is not a multiple of the item size
+			isfailed = true;
+			return{};
+		}
+		size /= sizeof(T);
+		if(capacity == size) launch(pnext);// only the last block of the file is not completely filled
+		return{size};
+	}
+
+	// wait for the block that is being read and close the file, false is returned if reading failed
+	RSBD8_FUNC_NORMAL bool close()noexcept{
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		pending = taskfuture<std::size_t>{};// this waits for the task to complete
+#endif
+		ppending = nullptr;
+		if(file){
+			std::fclose(file);
+			file = nullptr;
+		}
+		bool succeeded{!isfailed};
+		isfailed = false;
+		return{succeeded};
+	}
+};
+
+// this class writes a file sequentially in blocks, every block is written asynchronously while the caller fills the next one
+template<typename T>
+class externalwriter{
+	std::FILE *file{};
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	taskfuture<bool> pending;
+#endif
+	bool isfailed{};
+
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL static bool writeblock(std::FILE *pfile, T const *pdata, std::size_t count)noexcept{
+		return{count == std::fwrite(pdata, sizeof(T), count, pfile)};
+	}
+
+	RSBD8_FUNC_NORMAL void wait()noexcept{
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		if(pending.valid() && !pending.get()) isfailed = true;
+#endif
+	}
+
+public:
+	// disable copy and move mechanisms
+	externalwriter(externalwriter const &) = delete;
+	externalwriter &operator=(externalwriter const &) = delete;
+	externalwriter()noexcept = default;
+	RSBD8_FUNC_NORMAL ~externalwriter()noexcept{
+		close();
+	}
+
+	// create the file, or truncate it if it exists, false is returned if that fails
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL bool open(char const *filename)noexcept{
+		assert(!file);
+		file = std::fopen(filename, "wb");
+		return{nullptr != file};
+	}
+
+	// wait for the previous block to be written, and start writing this block, which has to be left alone until the next call or close()
+	RSBD8_FUNC_NORMAL void write(T const *pdata, std::size_t count)noexcept{
+		wait();
+		if(isfailed || !count) return;
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		try{
+			pending = launchasync(&externalwriter::writeblock, file, pdata, count);
+			return;
+		}catch(...){}// launchasync() may fail gracefully here, simply write the block synchronously then
+#endif
+		if(!writeblock(file, pdata, count))RSBD8_UNLIKELY isfailed = true;
+	}
+
+	// wait for the last block to be written and close the file, false is returned if writing failed
+	RSBD8_FUNC_NORMAL bool close()noexcept{
+		wait();
+		if(file){
+			if(std::fclose(file))RSBD8_UNLIKELY isfailed = true;
+			file = nullptr;
+		}
+		bool succeeded{!isfailed};
+		isfailed = false;
+		return{succeeded};
+	}
+};
+
+// this class generates the names of the temporary run files, which are placed in the temporary directory if one is given, and next to the output file otherwise
+// the names are the name of the output file, followed by ".<run number>.rsbd8run", and these share a single buffer
+class externalrunnames{
+	char *pname{};
+	std::size_t prefixlength{};
+
+public:
+	// disable copy and move mechanisms
+	externalrunnames(externalrunnames const &) = delete;
+	externalrunnames &operator=(externalrunnames const &) = delete;
+	externalrunnames()noexcept = default;
+	RSBD8_FUNC_NORMAL ~externalrunnames()noexcept{
+		delete[] pname;
+	}
+
+	// set up the buffer for the names, false is returned if allocating it fails
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL bool init(char const *outputfilename, char const *temporarydirectory)noexcept{
+		char const *pbase{outputfilename};
+		if(temporarydirectory){// only use the file name part of the output file name
+			for(char const *iter{outputfilename}; *iter; ++iter) if('/' == *iter || '\\' == *iter) pbase = iter + 1;
+		}
+		std::size_t directorylength{temporarydirectory? std::strlen(temporarydirectory) : 0u};
+		std::size_t baselength{std::strlen(pbase)};
+		pname = new(std::nothrow) char[directorylength + 1u + baselength + 32u];
+		if(!pname)RSBD8_UNLIKELY return{false};
+		if(directorylength){
+			std::memcpy(pname, temporarydirectory, directorylength);
+			if('/' != temporarydirectory[directorylength - 1u] && '\\' != temporarydirectory[directorylength - 1u]) pname[directorylength++] = '/';
+		}
+		std::memcpy(pname + directorylength, pbase, baselength);
+		prefixlength = directorylength + baselength;
+		return{true};
+	}
+
+	// the name of a run file, which remains valid until the next call
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL char const *name(unsigned run)noexcept{
+		std::snprintf(pname + prefixlength, 32u, ".%u.rsbd8run", run);
+		return{pname};
+	}
+};
+
+// the state of a run file in the merging phase
+template<typename T>
+struct externalmergerun{
+	externalreader<T> reader;
+	T const *pcur;
+	T const *pend;
+	T *pblock;// the block that pcur points into, it is the destination of the next read once it is used up
+};
+
+// the filtered key of an item in the merging phase, the descending order simply inverts the filtered keys
+template<bool isdescsort, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE T externalmergekey(T cur)noexcept{
+	T key{globalhistogramkey<isabsvalue, issignmode, isfltpmode, T>(cur)};
+	return{static_cast<T>(isdescsort? ~key : key)};
+}
+
+// restore the heap of runs after the key of the top run changed, ties are broken by the order of the runs to keep the merging stable
+template<bool isrevorder, typename T>
+RSBD8_FUNC_INLINE void externalmergesiftdown(unsigned *pheap, unsigned heapsize, T const *pkeys, unsigned position)noexcept{
+	auto isless{[pkeys](unsigned a, unsigned b)noexcept->bool{
+		return{pkeys[a] < pkeys[b] || (pkeys[a] == pkeys[b] && (isrevorder? a > b : a < b))};
+	}};
+	unsigned moving{pheap[position]};
+	for(;;){
+		unsigned child{position * 2u + 1u};
+		if(heapsize <= child) break;
+		if(heapsize > child + 1u && isless(pheap[child + 1u], pheap[child])) ++child;
+		if(!isless(pheap[child], moving)) break;
+		pheap[position] = pheap[child];
+		position = child;
+	}
+	pheap[position] = moving;
+}
+
+// merge a number of consecutive runs into a file, and remove the runs afterwards if that succeeded
+// the memory is split into two blocks for every run and two for the output file, so that all files are read and written asynchronously
+// the output file is created before the names of the runs are generated, as its name can be in the buffer of the run names
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL std::enable_if_t<
+	std::is_unsigned_v<T> &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> externalmerge(unsigned runcount, unsigned const *pruns, externalrunnames &names, char const *outputfilename, T *pmemory, std::size_t memorycount)noexcept{
+	assert(1u < runcount);
+	std::size_t blockcount{memorycount / (2u * static_cast<std::size_t>(runcount) + 2u)};
+	assert(blockcount);
+	externalwriter<T> writer;
+	bool succeeded{writer.open(outputfilename)};
+	externalmergerun<T> *pstates{new(std::nothrow) externalmergerun<T>[runcount]};
+	T *pkeys{new(std::nothrow) T[runcount]};
+	unsigned *pheap{new(std::nothrow) unsigned[runcount]};
+	if(!pstates || !pkeys || !pheap)RSBD8_UNLIKELY succeeded = false;
+	unsigned heapsize{};
+	if(succeeded){
+		// start reading the first block of every run before waiting for any of them
+		for(unsigned i{}; runcount > i; ++i){
+			if(!pstates[i].reader.open(names.name(pruns[i]), pmemory + blockcount * (2u * static_cast<std::size_t>(i)), blockcount))RSBD8_UNLIKELY{
+				succeeded = false;
+				break;
+			}
+		}
+	}
+	if(succeeded){
+		for(unsigned i{}; runcount > i; ++i){
+			externalmergerun<T> &run{pstates[i]};
+			T *pdata{};
+			std::size_t count{run.reader.fetch(pmemory + blockcount * (2u * static_cast<std::size_t>(i) + 1u), pdata)};
+			if(count){// empty runs do not exist, but a run can fail to be read
+				run.pcur = pdata;
+				run.pend = pdata + count;
+				run.pblock = pdata;
+				pkeys[i] = externalmergekey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(*pdata);
+				pheap[heapsize++] = i;
+			}
+		}
+		for(unsigned i{heapsize / 2u}; i--;) externalmergesiftdown<isrevorder, T>(pheap, heapsize, pkeys, i);
+		T *poutputblocks[2]{pmemory + blockcount * (2u * static_cast<std::size_t>(runcount)), pmemory + blockcount * (2u * static_cast<std::size_t>(runcount) + 1u)};
+		T *poutput{poutputblocks[0]};
+		std::size_t filled{};
+		unsigned active{};
+		while(heapsize){
+			unsigned top{pheap[0]};
+			externalmergerun<T> &run{pstates[top]};
+			poutput[filled++] = *run.pcur++;
+			if(blockcount == filled){// the other block is free again once the writer has finished with it
+				writer.write(poutput, filled);
+				active ^= 1u;
+				poutput = poutputblocks[active];
+				filled = 0u;
+			}
+			if(run.pend == run.pcur){
+				T *pdata{};
+				std::size_t count{run.reader.fetch(run.pblock, pdata)};
+				if(!count){// this run is done
+					pheap[0] = pheap[--heapsize];
+					if(heapsize) externalmergesiftdown<isrevorder, T>(pheap, heapsize, pkeys, 0u);
+					continue;
+				}
+				run.pcur = pdata;
+				run.pend = pdata + count;
+				run.pblock = pdata;
+			}
+			pkeys[top] = externalmergekey<isdescsort, isabsvalue, issignmode, isfltpmode, T>(*run.pcur);
+			externalmergesiftdown<isrevorder, T>(pheap, heapsize, pkeys, 0u);
+		}
+		writer.write(poutput, filled);
+		for(unsigned i{}; runcount > i; ++i) if(!pstates[i].reader.close())RSBD8_UNLIKELY succeeded = false;
+	}
+	if(!writer.close())RSBD8_UNLIKELY succeeded = false;
+	delete[] pheap;
+	delete[] pkeys;
+	delete[] pstates;// this closes any files that are still open
+	if(succeeded) for(unsigned i{}; runcount > i; ++i) std::remove(names.name(pruns[i]));
+	return{succeeded};
+}
+
+// merge the runs into the output file, and remove the runs afterwards
+// if there are more runs than can be merged at once, consecutive groups of runs are merged into new runs first, which keeps the merging stable
+template<bool isdescsort, bool isrevorder, bool isabsvalue, bool issignmode, bool isfltpmode, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_NORMAL std::enable_if_t<
+	std::is_unsigned_v<T> &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> externalmergeall(unsigned runcount, externalrunnames &names, char const *outputfilename, T *pmemory, std::size_t memorycount)noexcept{
+	assert(1u < runcount);
+	std::size_t fittingblocks{memorycount / ((externalsortminblocksize + sizeof(T) - 1u) / sizeof(T))};
+	unsigned fanin{externalsortmaxfanin};
+	if(2u * static_cast<std::size_t>(fanin) + 2u > fittingblocks) fanin = (6u > fittingblocks)? 2u : static_cast<unsigned>((fittingblocks - 2u) / 2u);
+	unsigned *pruns{new(std::nothrow) unsigned[runcount]};
+	bool succeeded{nullptr != pruns};
+	unsigned nextrun{runcount};
+	if(succeeded){
+		for(unsigned i{}; runcount > i; ++i) pruns[i] = i;
+		unsigned listcount{runcount};
+		while(fanin < listcount){
+			unsigned merged{};
+			for(unsigned first{}; listcount > first; first += fanin){
+				unsigned groupcount{(listcount - first < fanin)? listcount - first : fanin};
+				if(1u == groupcount) pruns[merged++] = pruns[first];// carry a single run over to the next level
+				else{
+					unsigned target{nextrun++};
+					succeeded = externalmerge<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(groupcount, pruns + first, names, names.name(target), pmemory, memorycount);
+					if(!succeeded)RSBD8_UNLIKELY break;
+					pruns[merged++] = target;
+				}
+			}
+			if(!succeeded)RSBD8_UNLIKELY break;
+			listcount = merged;
+		}
+		if(succeeded) succeeded = externalmerge<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, T>(listcount, pruns, names, outputfilename, pmemory, memorycount);
+		delete[] pruns;
+	}
+	if(!succeeded)RSBD8_UNLIKELY for(unsigned i{}; nextrun > i; ++i) std::remove(names.name(i));// remove what is left of the runs
+	return{succeeded};
+}
+
+// this class maps an entire file into memory for reading and writing, the changes to the memory end up in the file
+// platforms without file mapping functions read the file into memory instead, and write it back when it is closed
+class mappedfile{
+	void *pview{};
+	std::size_t size{};
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+	HANDLE file{INVALID_HANDLE_VALUE};
+	HANDLE mapping{};
+#elif defined(_POSIX_C_SOURCE)
+	int file{-1};
+#else
+	std::FILE *file{};
+#endif
+
+public:
+	// disable copy and move mechanisms
+	mappedfile(mappedfile const &) = delete;
+	mappedfile &operator=(mappedfile const &) = delete;
+	mappedfile()noexcept = default;
+	RSBD8_FUNC_NORMAL ~mappedfile()noexcept{
+		close();
+	}
+
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE void *data()const noexcept{
+		return{pview};
+	}
+
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE std::size_t bytes()const noexcept{
+		return{size};
+	}
+
+	// map an existing file for reading and writing, false is returned if that fails
+	// an empty file is not mapped, but it is opened successfully
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL bool open(char const *filename)noexcept{
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		assert(INVALID_HANDLE_VALUE == file);
+		file = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, 0u, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if(INVALID_HANDLE_VALUE == file)RSBD8_UNLIKELY return{false};
+		LARGE_INTEGER filesize;
+		if(!GetFileSizeEx(file, &filesize) || 0 > filesize.QuadPart)RSBD8_UNLIKELY return{false};
+		if constexpr(sizeof(std::size_t) < sizeof(filesize.QuadPart)) if(SIZE_MAX < static_cast<std::uint_least64_t>(filesize.QuadPart))RSBD8_UNLIKELY return{false};
+		if(filesize.QuadPart){// mapping an empty file is not allowed
+			mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0u, 0u, nullptr);
+			if(!mapping)RSBD8_UNLIKELY return{false};
+			pview = MapViewOfFile(mapping, FILE_MAP_WRITE, 0u, 0u, 0u);
+			if(!pview)RSBD8_UNLIKELY return{false};
+			size = static_cast<std::size_t>(filesize.QuadPart);
+		}
+#elif defined(_POSIX_C_SOURCE)
+		assert(-1 == file);
+		file = ::open(filename, O_RDWR);
+		if(-1 == file)RSBD8_UNLIKELY return{false};
+		struct stat status;
+		if(fstat(file, &status) || 0 > status.st_size)RSBD8_UNLIKELY return{false};
+		if constexpr(sizeof(std::size_t) < sizeof(status.st_size)) if(SIZE_MAX < static_cast<std::uintmax_t>(status.st_size))RSBD8_UNLIKELY return{false};
+		if(status.st_size){// mapping an empty file is not allowed
+			void *pmapped{mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0)};
+			if(MAP_FAILED == pmapped)RSBD8_UNLIKELY return{false};
+			pview = pmapped;
+			size = static_cast<std::size_t>(status.st_size);
+		}
+#else
+		assert(!file);
+		file = std::fopen(filename, "r+b");
+		if(!file)RSBD8_UNLIKELY return{false};
+		if(std::fseek(file, 0, SEEK_END))RSBD8_UNLIKELY return{false};
+		long filesize{std::ftell(file)};
+		if(0 > filesize || std::fseek(file, 0, SEEK_SET))RSBD8_UNLIKELY return{false};
+		if(filesize){
+			pview = new(std::align_val_t{std::hardware_constructive_interference_size}, std::nothrow) std::byte[static_cast<std::size_t>(filesize)];
+			if(!pview)RSBD8_UNLIKELY return{false};
+			if(static_cast<std::size_t>(filesize) != std::fread(pview, 1u, static_cast<std::size_t>(filesize), file))RSBD8_UNLIKELY return{false};
+			size = static_cast<std::size_t>(filesize);// only a completely read file is written back
+		}
+#endif
+		return{true};
+	}
+
+	// map a new temporary file of the given size in bytes for reading and writing in the given directory, false is returned if that fails
+	// the file is removed again when it is closed, or when the process ends
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL bool create(char const *directory, std::size_t count)noexcept{
+		assert(count);
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		assert(INVALID_HANDLE_VALUE == file);
+		char filename[MAX_PATH];
+		if(!GetTempFileNameA(directory, "rsb", 0u, filename))RSBD8_UNLIKELY return{false};// this creates an empty file with a unique name
+		file = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, 0u, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+		if(INVALID_HANDLE_VALUE == file)RSBD8_UNLIKELY{
+			DeleteFileA(filename);
+			return{false};
+		}
+		mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(static_cast<std::uint_least64_t>(count) >> 32), static_cast<DWORD>(count), nullptr);
+		if(!mapping)RSBD8_UNLIKELY return{false};
+		pview = MapViewOfFile(mapping, FILE_MAP_WRITE, 0u, 0u, count);
+		if(!pview)RSBD8_UNLIKELY return{false};
+#elif defined(_POSIX_C_SOURCE)
+		assert(-1 == file);
+		static char constexpr pattern[]{"/rsbd8XXXXXX"};
+		std::size_t length{std::strlen(directory)};
+		char *filename{new(std::nothrow) char[length + sizeof(pattern)]};
+		if(!filename)RSBD8_UNLIKELY return{false};
+		std::memcpy(filename, directory, length);
+		std::memcpy(filename + length, pattern, sizeof(pattern));
+		file = mkstemp(filename);
+		if(-1 != file) unlink(filename);// the file is removed from the directory right away, the storage is released when it is closed
+		delete[] filename;
+		if(-1 == file)RSBD8_UNLIKELY return{false};
+		if(ftruncate(file, static_cast<off_t>(count)))RSBD8_UNLIKELY return{false};
+		void *pmapped{mmap(nullptr, count, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0)};
+		if(MAP_FAILED == pmapped)RSBD8_UNLIKELY return{false};
+		pview = pmapped;
+#else
+		static_cast<void>(directory);
+		assert(!file);
+		pview = new(std::align_val_t{std::hardware_constructive_interference_size}, std::nothrow) std::byte[count];
+		if(!pview)RSBD8_UNLIKELY return{false};
+#endif
+		size = count;
+		return{true};
+	}
+
+	// hint to the system that the entire mapping will be used soon, so the file is read ahead in large parts instead of page by page on demand
+	RSBD8_FUNC_NORMAL void prefetch()const noexcept{
+		if(!pview) return;
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+#if defined(_WIN32_WINNT) && 0x0602 <= _WIN32_WINNT// PrefetchVirtualMemory() requires Windows 8
+		WIN32_MEMORY_RANGE_ENTRY range{pview, size};
+		static_cast<void>(PrefetchVirtualMemory(GetCurrentProcess(), 1u, &range, 0u));
+#endif
+#elif defined(_POSIX_C_SOURCE) && defined(POSIX_MADV_WILLNEED)
+		static_cast<void>(posix_madvise(pview, size, POSIX_MADV_WILLNEED));
+#endif
+	}
+
+	// unmap and close the file, false is returned if that fails
+	RSBD8_FUNC_NORMAL bool close()noexcept{
+		bool succeeded{true};
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		if(pview && !UnmapViewOfFile(pview))RSBD8_UNLIKELY succeeded = false;
+		if(mapping){
+			CloseHandle(mapping);
+			mapping = nullptr;
+		}
+		if(INVALID_HANDLE_VALUE != file){
+			if(!CloseHandle(file))RSBD8_UNLIKELY succeeded = false;
+			file = INVALID_HANDLE_VALUE;
+		}
+#elif defined(_POSIX_C_SOURCE)
+		if(pview && munmap(pview, size))RSBD8_UNLIKELY succeeded = false;
+		if(-1 != file){
+			if(::close(file))RSBD8_UNLIKELY succeeded = false;
+			file = -1;
+		}
+#else
+		if(file){// write the contents back to the file
+			if(size && (std::fseek(file, 0, SEEK_SET) || size != std::fwrite(pview, 1u, size, file)))RSBD8_UNLIKELY succeeded = false;
+			if(std::fclose(file))RSBD8_UNLIKELY succeeded = false;
+			file = nullptr;
+		}
+		if(pview) delete(std::align_val_t{std::hardware_constructive_interference_size})[] reinterpret_cast<std::byte *>(pview);
+#endif
+		pview = nullptr;
+		size = 0u;
+		return{succeeded};
+	}
+};
+
+// Helper functions for determining absolute, signed and floating-point attributes at compile-time
+//
+// These fuctions are used by the wrapper functions to determine the correct template parameters to pass to the actual sorting functions.
+
+template<sortingmode mode, typename T>
+constexpr bool isabsvalue{
+	(sortingmode::nativeabs <= mode && std::is_signed_v<T> ||
+#if 0xFFFFFFFFFFFFFFFFu <= UINTPTR_MAX
+		std::is_same_v<T, test128<true, false, false>> ||
+		std::is_same_v<T, test128<true, false, true>> ||
+		std::is_same_v<T, test128<true, true, false>> ||
+		std::is_same_v<T, test128<true, true, true>> ||
+#else
+		std::is_same_v<T, test64<true, false, false>> ||
+		std::is_same_v<T, test64<true, false, true>> ||
+		std::is_same_v<T, test64<true, true, false>> ||
+		std::is_same_v<T, test64<true, true, true>> ||
+#endif
+		std::is_same_v<T, longdoubletest128<true, false, false>> ||
+		std::is_same_v<T, longdoubletest128<true, false, true>> ||
+		std::is_same_v<T, longdoubletest128<true, true, false>> ||
+		std::is_same_v<T, longdoubletest128<true, true, true>> ||
+		std::is_same_v<T, longdoubletest96<true, false, false>> ||
+		std::is_same_v<T, longdoubletest96<true, false, true>> ||
+		std::is_same_v<T, longdoubletest96<true, true, false>> ||
+		std::is_same_v<T, longdoubletest96<true, true, true>> ||
+		std::is_same_v<T, longdoubletest80<true, false, false>> ||
+		std::is_same_v<T, longdoubletest80<true, false, true>> ||
+		std::is_same_v<T, longdoubletest80<true, true, false>> ||
+		std::is_same_v<T, longdoubletest80<true, true, true>>) ||
+	(sortingmode::native > mode && static_cast<bool>(1u & static_cast<unsigned char>(mode)))
+};
+
+template<sortingmode mode, typename T>
+constexpr bool issignmode{
+	(sortingmode::native <= mode && sortingmode::nativeabs >= mode &&
+		std::is_signed_v<T> ||
+#if 0xFFFFFFFFFFFFFFFFu <= UINTPTR_MAX
+		std::is_same_v<T, test128<false, true, false>> ||
+		std::is_same_v<T, test128<false, true, true>> ||
+		std::is_same_v<T, test128<true, true, false>> ||
+		std::is_same_v<T, test128<true, true, true>> ||
+#else
+		std::is_same_v<T, test64<false, true, false>> ||
+		std::is_same_v<T, test64<false, true, true>> ||
+		std::is_same_v<T, test64<true, true, false>> ||
+		std::is_same_v<T, test64<true, true, true>> ||
+#endif
+		std::is_same_v<T, longdoubletest128<false, true, false>> ||
+		std::is_same_v<T, longdoubletest128<false, true, true>> ||
+		std::is_same_v<T, longdoubletest128<true, true, false>> ||
+		std::is_same_v<T, longdoubletest128<true, true, true>> ||
+		std::is_same_v<T, longdoubletest96<false, true, false>> ||
+		std::is_same_v<T, longdoubletest96<false, true, true>> ||
+		std::is_same_v<T, longdoubletest96<true, true, false>> ||
+		std::is_same_v<T, longdoubletest96<true, true, true>> ||
+		std::is_same_v<T, longdoubletest80<false, true, false>> ||
+		std::is_same_v<T, longdoubletest80<false, true, true>> ||
+		std::is_same_v<T, longdoubletest80<true, true, false>> ||
+		std::is_same_v<T, longdoubletest80<true, true, true>>) ||
+	(sortingmode::native > mode && static_cast<bool>(1u << 1 & static_cast<unsigned char>(mode)))
+};
+
+template<sortingmode mode, typename T>
+constexpr bool isfltpmode{
+	(sortingmode::native <= mode &&
+		std::is_floating_point_v<T> ||
+#if 0xFFFFFFFFFFFFFFFFu <= UINTPTR_MAX
+		std::is_same_v<T, test128<false, false, true>> ||
+		std::is_same_v<T, test128<false, true, true>> ||
+		std::is_same_v<T, test128<true, false, true>> ||
+		std::is_same_v<T, test128<true, true, true>> ||
+#else
+		std::is_same_v<T, test64<false, false, true>> ||
+		std::is_same_v<T, test64<false, true, true>> ||
+		std::is_same_v<T, test64<true, false, true>> ||
+		std::is_same_v<T, test64<true, true, true>> ||
+#endif
+		std::is_same_v<T, longdoubletest128<false, false, true>> ||
+		std::is_same_v<T, longdoubletest128<false, true, true>> ||
+		std::is_same_v<T, longdoubletest128<true, false, true>> ||
+		std::is_same_v<T, longdoubletest128<true, true, true>> ||
+		std::is_same_v<T, longdoubletest96<false, false, true>> ||
+		std::is_same_v<T, longdoubletest96<false, true, true>> ||
+		std::is_same_v<T, longdoubletest96<true, false, true>> ||
+		std::is_same_v<T, longdoubletest96<true, true, true>> ||
+		std::is_same_v<T, longdoubletest80<false, false, true>> ||
+		std::is_same_v<T, longdoubletest80<false, true, true>> ||
+		std::is_same_v<T, longdoubletest80<true, false, true>> ||
+		std::is_same_v<T, longdoubletest80<true, true, true>>) ||
+	(sortingmode::native > mode && static_cast<bool>(1u << 2 & static_cast<unsigned char>(mode)))
+};
+
+template<sortingdirection direction>
+constexpr bool isdescsort{
+	static_cast<bool>(1u & static_cast<unsigned char>(direction))
+};
+
+template<sortingdirection direction>
+constexpr bool isrevorderwithindirection{
+	static_cast<bool>(1u << 1 & static_cast<unsigned char>(direction))
+};
+
+template<sortingdirection direction, typename T, bool isabsvalue, bool issignmode, bool isfltpmode>
+constexpr bool isrevorderwithoutindirection{
+	static_cast<bool>(1u << 1 & static_cast<unsigned char>(direction)) && (
+		// reverse ordering is useless if there are no non-uniqe value configurations (padding, sign bits)
+		std::is_same_v<T, longdoubletest128<false, false, false>> ||
+		std::is_same_v<T, longdoubletest128<false, false, true>> ||
+		std::is_same_v<T, longdoubletest128<false, true, false>> ||
+		std::is_same_v<T, longdoubletest128<false, true, true>> ||
+		std::is_same_v<T, longdoubletest128<true, false, false>> ||
+		std::is_same_v<T, longdoubletest128<true, false, true>> ||
+		std::is_same_v<T, longdoubletest128<true, true, false>> ||
+		std::is_same_v<T, longdoubletest128<true, true, true>> ||
+		std::is_same_v<T, longdoubletest96<false, false, false>> ||
+		std::is_same_v<T, longdoubletest96<false, false, true>> ||
+		std::is_same_v<T, longdoubletest96<false, true, false>> ||
+		std::is_same_v<T, longdoubletest96<false, true, true>> ||
+		std::is_same_v<T, longdoubletest96<true, false, false>> ||
+		std::is_same_v<T, longdoubletest96<true, false, true>> ||
+		std::is_same_v<T, longdoubletest96<true, true, false>> ||
+		std::is_same_v<T, longdoubletest96<true, true, true>> ||
+		(std::is_same_v<T, long double> &&
+			64 == LDBL_MANT_DIG &&
+			16384 == LDBL_MAX_EXP &&
+			128u >= CHAR_BIT * sizeof(long double) &&
+			64u < CHAR_BIT * sizeof(long double)) ||
+		(isabsvalue && issignmode) ||// both regular absolute modes
+		(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
+};
+}// namespace helper
+
+// Generic large array allocation and deallocation functions
+
+// allocation failed if the pbuffer member of the output is a nullptr
+// the memory space held by pfuturesplaceholder is only a reservation, without any initialisation
+// the indices have to be zeroed beforehand during allocation
+template<typename T>
+struct combinedallocation{
+	T *RSBD8_RESTRICT pbuffer;
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	void *RSBD8_RESTRICT pfuturesplaceholder;
+#endif
+	void *RSBD8_RESTRICT pzeroedindices;
+};
+
+// the sizes in bytes of the three parts of the memory used by the sorting functions, without any padding
+struct allocationparts{
+	std::size_t buffersize;
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	std::size_t futuressize;
+#endif
+	std::size_t indicessize;
+};
+
+template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T, bool isbufferpointers, bool isbufferallocated = true>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE allocationparts getallocationparts(std::size_t count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	, unsigned allowedthreads
+#endif
+	)noexcept{
+	assert(count);
+
+	// the sorting functions never select a type for the indices that cannot hold the 2-way multithreading threshold, so neither can this
+	// the threshold is the largest for ascending, forward ordering
+	static std::size_t constexpr limit2way{helper::base2waythreshold<false, false, isabsvalue, issignmode, isfltpmode, helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>, isbufferpointers>()};
+	std::size_t selectcount{(limit2way > count)? limit2way : count};
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	// determine the maximum element size for the indices, this will usually take just a few condional moves
+	std::size_t multithreadindicessize{sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, std::size_t>)};
+	if constexpr(ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= selectcount){
+		multithreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long long>);
+	}
+	if constexpr(ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= selectcount){
+		multithreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned long>);
+	}
+	if constexpr(UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= selectcount){
+		multithreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned>);
+	}
+	if constexpr(USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= selectcount){
+		multithreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned short>);
+	}
+	if constexpr(UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= selectcount){
+		multithreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, true, T, unsigned char>);
+	}
+	std::size_t multithreadfuturessize{allowedthreads * sizeof(helper::taskfuture<void>) - sizeof(helper::taskfuture<void>[2])};// 2 less than the available threads, as the main and companion threads will not be put in here
+	std::size_t singlethreadindicessize{multithreadindicessize << static_cast<unsigned>(8u < CHAR_BIT * sizeof(T) ||// single-threaded mode simply uses a double set of indices, except for the fill-mode single-pass type
+		isbufferpointers ||// indirection
+		(isabsvalue && issignmode) ||// both regular absolute modes
+		(!isabsvalue && issignmode && isfltpmode))};// regular floating-point mode
+	multithreadindicessize *= allowedthreads;
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+	// the sample sort strategy sorts its buckets with single-threaded sorting functions on all threads, which use two items of index counts each
+	// the strategy can be selected at run-time after the allocation, so this applies to every allocation for 8 threads or more
+	if(7u < allowedthreads) multithreadindicessize <<= 1;
+#endif
+	if(1u >= allowedthreads) multithreadfuturessize = 0u, multithreadindicessize = singlethreadindicessize;
+	return{isbufferallocated? count * (isbufferpointers? sizeof(void *) : sizeof(T)) : 0u, multithreadfuturessize, multithreadindicessize};
+#else// single-threaded-only
+	// determine the maximum element size for the indices, this will usually take just a few condional moves
+	std::size_t singlethreadindicessize{sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, std::size_t>)};
+	if constexpr(ULLONG_MAX < SIZE_MAX && ULLONG_MAX != ULONG_MAX) if(ULLONG_MAX >= selectcount){
+		singlethreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, unsigned long long>);
+	}
+	if constexpr(ULONG_MAX < SIZE_MAX && ULONG_MAX != UINT_MAX) if(ULONG_MAX >= selectcount){
+		singlethreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, unsigned long>);
+	}
+	if constexpr(UINT_MAX < SIZE_MAX && UINT_MAX != USHRT_MAX) if(UINT_MAX >= selectcount){
+		singlethreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, unsigned>);
+	}
+	if constexpr(USHRT_MAX < SIZE_MAX && USHRT_MAX != UCHAR_MAX) if(USHRT_MAX >= selectcount){
+		singlethreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, unsigned short>);
+	}
+	if constexpr(UCHAR_MAX < SIZE_MAX) if(UCHAR_MAX >= selectcount){
+		singlethreadindicessize = sizeof(helper::offsetstype<isabsvalue, issignmode, isfltpmode, false, T, unsigned char>);
+	}
+	return{isbufferallocated? count * (isbufferpointers? sizeof(void *) : sizeof(T)) : 0u, singlethreadindicessize};
+#endif
+}
+
+template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T, bool isbufferpointers, bool isbufferallocated = true>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE
+#if !defined(_WIN32) && defined(_POSIX_C_SOURCE)// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+	std::pair<combinedallocation<std::conditional_t<isbufferpointers, T *RSBD8_RESTRICT, T>>, std::size_t>
+#else
+	combinedallocation<std::conditional_t<isbufferpointers, T *RSBD8_RESTRICT, T>>
+#endif
+	allocatearray(std::size_t count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	, unsigned allowedthreads
+#endif
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+	, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+	, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+	)noexcept{
+	assert(count);
+
+	// the items are padded to full cache lines together, to avoid false sharing with other data in the same cache line, as well as to ensure that the buffers are aligned to at least the size of a cache line, which is a common requirement for optimal performance on many platforms
+	// the actual padding is placed in between the first and second members, to keep either natural or up to cache line alignment for helper::taskfuture<void>
+	allocationparts parts{getallocationparts<isabsvalue, issignmode, isfltpmode, T, isbufferpointers, isbufferallocated>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+		)};
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	std::size_t multithreadindicessize{parts.indicessize};
+	std::size_t multithreadfuturessize{parts.futuressize};
+	std::size_t allocsize{parts.buffersize + multithreadfuturessize + multithreadindicessize};
+#else// single-threaded-only
+	std::size_t singlethreadindicessize{parts.indicessize};
+	std::size_t allocsize{parts.buffersize + singlethreadindicessize};
 #endif
+	if constexpr(1u < std::hardware_constructive_interference_size){// use cache line alignment for performance
+		allocsize += std::hardware_constructive_interference_size - 1u;// round up
+		allocsize &= -static_cast<std::ptrdiff_t>(std::hardware_constructive_interference_size);// finalise cache line alignment
+	}
 
 	// use a system-specific allocator if possible
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
@@ -60011,7 +63952,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE
 	std::byte *RSBD8_RESTRICT indices{bufferend - multithreadindicessize};
 	if constexpr(1u < std::hardware_constructive_interference_size) assert(!(std::hardware_constructive_interference_size - 1u & reinterpret_cast<std::uintptr_t>(indices)));
 	std::byte *RSBD8_RESTRICT futures{indices - multithreadfuturessize};
-	assert(!(alignof(std::future<void>) - 1u & reinterpret_cast<std::uintptr_t>(futures)));
+	assert(!(alignof(helper::taskfuture<void>) - 1u & reinterpret_cast<std::uintptr_t>(futures)));
 	return{reinterpret_cast<std::conditional_t<isbufferpointers, T *RSBD8_RESTRICT *RSBD8_RESTRICT, T *RSBD8_RESTRICT>>(reinterpret_cast<std::intptr_t>(buffer)), futures, indices};
 #else// single-threaded-only
 	std::byte *RSBD8_RESTRICT indices{bufferend - singlethreadindicessize};
@@ -60037,7 +63978,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE
 	std::byte *RSBD8_RESTRICT indices{bufferend - multithreadindicessize};
 	if constexpr(1u < std::hardware_constructive_interference_size) assert(!(std::hardware_constructive_interference_size - 1u & reinterpret_cast<std::uintptr_t>(indices)));
 	std::byte *RSBD8_RESTRICT futures{indices - multithreadfuturessize};
-	assert(!(alignof(std::future<void>) - 1u & reinterpret_cast<std::uintptr_t>(futures)));
+	assert(!(alignof(helper::taskfuture<void>) - 1u & reinterpret_cast<std::uintptr_t>(futures)));
 	return{{reinterpret_cast<std::conditional_t<isbufferpointers, T *RSBD8_RESTRICT *RSBD8_RESTRICT, T *RSBD8_RESTRICT>>(reinterpret_cast<std::intptr_t>(buffer)), futures, indices}, allocsize};
 #else// single-threaded
 	std::byte *RSBD8_RESTRICT indices{bufferend - singlethreadindicessize};
@@ -60053,7 +63994,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE
 	if(buffer) std::memset(indices, 0, multithreadindicessize);// the indices have to be zeroed beforehand
 	if constexpr(1u < std::hardware_constructive_interference_size) assert(!(std::hardware_constructive_interference_size - 1u & reinterpret_cast<std::uintptr_t>(indices)));
 	std::byte *RSBD8_RESTRICT futures{indices - multithreadfuturessize};
-	assert(!(alignof(std::future<void>) - 1u & reinterpret_cast<std::uintptr_t>(futures)));
+	assert(!(alignof(helper::taskfuture<void>) - 1u & reinterpret_cast<std::uintptr_t>(futures)));
 	return{reinterpret_cast<std::conditional_t<isbufferpointers, T *RSBD8_RESTRICT *RSBD8_RESTRICT, T *RSBD8_RESTRICT>>(reinterpret_cast<std::intptr_t>(buffer)), futures, indices};
 #else// single-threaded-only
 	std::byte *RSBD8_RESTRICT indices{bufferend - singlethreadindicessize};
@@ -60116,28 +64057,311 @@ struct buffermemorywrapper{
 	}
 };
 
-// Wrapper template functions for the main sorting functions in this library
+// this class holds the memory used by the sorting functions between calls, so that repeated sorting of arrays does not have to allocate and deallocate memory every time
+// the memory only grows, release() or the destructor will hand it back to the system
+// a workspace can only be used by one sorting function at a time, use one workspace per thread for concurrent sorting
+class sortworkspace{
+	std::byte *RSBD8_RESTRICT pmemory{};
+	std::size_t allocsize{};
+	std::size_t dirtysize{};// the indices have to be zeroed again for re-use, but only the part that was actually used previously
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+	std::size_t largepagesize;
+#elif defined(_POSIX_C_SOURCE)
+	int mmapflags;
+#endif
 
-// wrapper for the multi-part radixsortcopynoalloc() function without indirection
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	128u >= CHAR_BIT * sizeof(T) &&
-	8u < CHAR_BIT * sizeof(T),
-	void> radixsortcopynoalloc(std::size_t count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+	// round up to full cache lines
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE static std::size_t padtocacheline(std::size_t size)noexcept{
+		if constexpr(1u < std::hardware_constructive_interference_size){// use cache line alignment for performance
+			size += std::hardware_constructive_interference_size - 1u;// round up
+			size &= -static_cast<std::ptrdiff_t>(std::hardware_constructive_interference_size);// finalise cache line alignment
+		}
+		return{size};
+	}
+
+	// replace the current memory by a new and larger block, all of it will be zeroed or marked for zeroing
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE bool reserve(std::size_t size)noexcept{
+		release();
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		assert(!(largepagesize - 1u & largepagesize));// a maximum of one bit should be set in the value of largepagesize
+		DWORD alloctype{MEM_RESERVE | MEM_COMMIT};
+		if(largepagesize) size = (largepagesize - 1u & -static_cast<std::ptrdiff_t>(size)) + size, alloctype = MEM_LARGE_PAGES | MEM_RESERVE | MEM_COMMIT;// round up to the nearest multiple of largepagesize
+		// VirtualAlloc() only hands out zeroed memory
+		void *RSBD8_RESTRICT buffer{VirtualAlloc(nullptr, size, alloctype, PAGE_READWRITE)};
+		if(!buffer)RSBD8_UNLIKELY return{false};
+		dirtysize = 0u;
+#elif defined(_POSIX_C_SOURCE)
+		void *RSBD8_RESTRICT pempty{};
+#ifdef MAP_HUGETLB
+		if(MAP_HUGETLB & mmapflags){// use the 6 bits associated with the huge TLB functionality
+			std::size_t pagesize{static_cast<std::size_t>(1u) << (static_cast<unsigned>(mmapflags) >> MAP_HUGE_SHIFT & ((1u << 6) - 1u))};
+			size = (pagesize - 1 & -static_cast<std::ptrdiff_t>(size)) + size;// round up to the nearest multiple of pagesize
+#ifdef __ia64__// only IA64 requires this part for this type of allocation
+			pempty = reinterpret_cast<void *>(0x8000000000000000u);
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer)noexcept{
-	assert(input != output);
-	assert(input != buffer);
-	assert(output != buffer);
-	// do not pass a nullptr here
-	assert(input);
-	assert(output);
-	assert(buffer);
+		}
+#endif
+		// mmap() only hands out zeroed memory
+		void *buffer{mmap(pempty, size, PROT_READ | PROT_WRITE, mmapflags, -1, 0)};
+		if(MAP_FAILED == buffer)RSBD8_UNLIKELY return{false};
+		dirtysize = 0u;
+#else// neither _WIN32 nor _POSIX_C_SOURCE defined
+		std::byte *RSBD8_RESTRICT buffer{new(std::align_val_t{std::hardware_constructive_interference_size}, std::nothrow) std::byte[size]};
+		if(!buffer)RSBD8_UNLIKELY return{false};
+		dirtysize = size;// this memory is not zeroed
+#endif
+		if constexpr(1u < std::hardware_constructive_interference_size) assert(!(std::hardware_constructive_interference_size - 1u & reinterpret_cast<std::uintptr_t>(buffer)));
+		pmemory = reinterpret_cast<std::byte *RSBD8_RESTRICT>(buffer);
+		allocsize = size;
+		return{true};
+	}
+
+public:
+	// disable copy and move mechanisms
+	sortworkspace(sortworkspace const &) = delete;
+	sortworkspace &operator=(sortworkspace const &) = delete;
+	RSBD8_FUNC_INLINE explicit sortworkspace(
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		std::size_t largepagesizemem = 0u
+#elif defined(_POSIX_C_SOURCE)
+		int mmapflagsmem = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+		)noexcept
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		: largepagesize{largepagesizemem}
+#elif defined(_POSIX_C_SOURCE)
+		: mmapflags{mmapflagsmem}
+#endif
+		{}
+	RSBD8_FUNC_INLINE ~sortworkspace()noexcept{
+		release();
+	}
+
+	// hand the memory back to the system, the next use of the workspace will allocate again
+	RSBD8_FUNC_INLINE void release()noexcept{
+		if(pmemory){
+			deallocatearray(pmemory
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				);
+			pmemory = nullptr, allocsize = 0u, dirtysize = 0u;
+		}
+	}
+
+	// the size in bytes of the memory currently held
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE std::size_t size()const noexcept{
+		return{allocsize};
+	}
+
+	// the equivalent of allocatearray(), but on the memory held by the workspace
+	// allocation failed if the pbuffer member of the output is a nullptr
+	// the memory layout is the reverse of the one used by allocatearray(), as the zeroed indices are placed at the start here to keep the part that requires zeroing in the same place for every use
+	template<bool isabsvalue, bool issignmode, bool isfltpmode, typename T, bool isbufferpointers, bool isbufferallocated = true>
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE combinedallocation<std::conditional_t<isbufferpointers, T *RSBD8_RESTRICT, T>> prepare(std::size_t count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, unsigned allowedthreads
+#endif
+		)noexcept{
+		allocationparts parts{getallocationparts<isabsvalue, issignmode, isfltpmode, T, isbufferpointers, isbufferallocated>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		std::size_t indicessize{padtocacheline(parts.indicessize)};
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		std::size_t futuressize{padtocacheline(parts.futuressize)};
+#else// single-threaded-only
+		std::size_t futuressize{};
+#endif
+		std::size_t requiredsize{indicessize + futuressize + padtocacheline(parts.buffersize)};
+		if(allocsize < requiredsize){
+			if(!reserve(requiredsize))RSBD8_UNLIKELY return{};
+		}
+		// only the part of the indices that was written to during earlier use has to be zeroed again
+		if(dirtysize) std::memset(pmemory, 0, indicessize < dirtysize? indicessize : dirtysize);
+		if(dirtysize < requiredsize) dirtysize = requiredsize;
+		std::byte *RSBD8_RESTRICT futures{pmemory + indicessize};
+		assert(!(alignof(helper::taskfuture<void>) - 1u & reinterpret_cast<std::uintptr_t>(futures)));
+		std::byte *RSBD8_RESTRICT buffer{futures + futuressize};
+		return{reinterpret_cast<std::conditional_t<isbufferpointers, T *RSBD8_RESTRICT *RSBD8_RESTRICT, T *RSBD8_RESTRICT>>(reinterpret_cast<std::intptr_t>(buffer)),
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			futures,
+#endif
+			pmemory};
+	}
+};
+
+// Persistent thread pool functions
+
+// the persistent, elastic pool of worker threads that the multithreading functions can use instead of spawning new threads for every task
+using threadpool = helper::threadpool;
+
+// set the thread pool used by all subsequent multithreaded sorting, a nullptr restores the default of spawning a new thread for every task
+// the previously set thread pool is returned, and it must not be destroyed while any sorting function might still use it
+RSBD8_FUNC_INLINE threadpool *setthreadpool(threadpool *ppool)noexcept{
+	return{helper::activethreadpool.exchange(ppool, std::memory_order_acq_rel)};
+}
+
+// retrieve the currently set thread pool, or a nullptr if there is none
+RSBD8_NODISCARD RSBD8_FUNC_INLINE threadpool *getthreadpool()noexcept{
+	return{helper::activethreadpool.load(std::memory_order_acquire)};
+}
+
+// the library-owned thread pool, constructed on first use with one worker less than the number of hardware threads (the calling thread is the remaining one)
+// this only provides the pool, use rsbd8::setthreadpool(&rsbd8::defaultthreadpool()) to activate it
+RSBD8_NODISCARD inline threadpool &defaultthreadpool(){
+	static threadpool pool{1u < std::thread::hardware_concurrency()? std::thread::hardware_concurrency() - 1u : 0u};
+	return{pool};
+}
+
+// NUMA topology functions
+
+// the description of the NUMA nodes of the system, as used by the NUMA-aware versions of the sorting functions
+using numatopology = helper::numatopology;
+
+// the topology of the system, detected on first use
+RSBD8_NODISCARD inline numatopology const &systemnumatopology()noexcept{
+	static numatopology const topology;
+	return{topology};
+}
+
+// Multithreading threshold profile functions
+
+// set the base count for a multithreading threshold at run-time, which replaces the compile-time default for all subsequent sorting
+// the ways parameter selects the 2-way threshold, the 4-way (and 6-way) threshold or the 8-way (and 12- and 18-way) threshold by the values 2, 4 and 8
+// the base count is given for unfiltered items in ascending, forward order, the usual scaling for the sorting modes and directions is applied on top of it
+// a base count of 0 restores the compile-time default, and false is returned for a combination of parameters that has no threshold
+RSBD8_FUNC_INLINE bool setmultithreadingthreshold(unsigned ways, bool isindirect, unsigned typebits, std::size_t basecount)noexcept{
+	unsigned tier{(2u == ways)? 0u : (4u == ways)? 1u : (8u == ways)? 2u : 3u};
+	if(2u < tier || !typebits || 128u < typebits || typebits % 8u || (tier && 8u == typebits))RSBD8_UNLIKELY return{false};
+	helper::profiledthresholds[tier][isindirect][typebits / 8u - 1u].store(basecount, std::memory_order_relaxed);
+	return{true};
+}
+
+// retrieve the base count for a multithreading threshold that was set at run-time, or 0 if the compile-time default is in use
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::size_t getmultithreadingthreshold(unsigned ways, bool isindirect, unsigned typebits)noexcept{
+	unsigned tier{(2u == ways)? 0u : (4u == ways)? 1u : (8u == ways)? 2u : 3u};
+	if(2u < tier || !typebits || 128u < typebits || typebits % 8u)RSBD8_UNLIKELY return{};
+	return{helper::profiledthresholds[tier][isindirect][typebits / 8u - 1u].load(std::memory_order_relaxed)};
+}
+
+// restore the compile-time defaults for all multithreading thresholds
+RSBD8_FUNC_INLINE void resetmultithreadingthresholds()noexcept{
+	for(auto &tier : helper::profiledthresholds) for(auto &indirection : tier) for(std::atomic_size_t &elem : indirection) elem.store(0u, std::memory_order_relaxed);
+}
+
+// load a machine profile with the base counts for the multithreading thresholds, as written by savethresholdprofile() or the calibration tool
+// the profile is a text file with one "ways direct|indirect typebits basecount" line per threshold, empty lines and lines starting with '#' are ignored
+// all thresholds that are not in the profile use the compile-time defaults afterwards
+// nothing is changed and false is returned if the file cannot be read or if it contains an invalid line
+RSBD8_NODISCARD inline bool loadthresholdprofile(char const *filename)noexcept{
+	// do not pass a nullptr here
+	assert(filename);
+
+	std::FILE *file{std::fopen(filename, "r")};
+	if(!file)RSBD8_UNLIKELY return{false};
+	std::size_t loaded[3][2][16]{};
+	bool succeeded{true};
+	char line[256];
+	while(std::fgets(line, static_cast<int>(sizeof(line)), file)){
+		char const *iter{line};
+		while(' ' == *iter || '\t' == *iter) ++iter;
+		if('#' == *iter || '\n' == *iter || '\r' == *iter || !*iter) continue;
+		unsigned ways, typebits;
+		char indirection[16];
+		unsigned long long basecount;
+		if(4 != std::sscanf(iter, "%u %15s %u %llu", &ways, indirection, &typebits, &basecount)){
+			succeeded = false;
+			break;
+		}
+		unsigned tier{(2u == ways)? 0u : (4u == ways)? 1u : (8u == ways)? 2u : 3u};
+		bool isdirect{!std::strcmp(indirection, "direct")};
+		if(2u < tier || !typebits || 128u < typebits || typebits % 8u || (tier && 8u == typebits) ||
+			(!isdirect && std::strcmp(indirection, "indirect")) || SIZE_MAX < basecount){
+			succeeded = false;
+			break;
+		}
+		loaded[tier][!isdirect][typebits / 8u - 1u] = static_cast<std::size_t>(basecount);
+	}
+	if(std::ferror(file)) succeeded = false;
+	std::fclose(file);
+	if(succeeded){
+		for(unsigned tier{}; 3u > tier; ++tier) for(unsigned indirection{}; 2u > indirection; ++indirection) for(unsigned size{}; 16u > size; ++size){
+			helper::profiledthresholds[tier][indirection][size].store(loaded[tier][indirection][size], std::memory_order_relaxed);
+		}
+	}
+	return{succeeded};
+}
+
+// save the base counts for the multithreading thresholds that were set at run-time as a machine profile
+RSBD8_NODISCARD inline bool savethresholdprofile(char const *filename)noexcept{
+	// do not pass a nullptr here
+	assert(filename);
+
+	std::FILE *file{std::fopen(filename, "w")};
+	if(!file)RSBD8_UNLIKELY return{false};
+	bool succeeded{0 <= std::fputs("# rsbd8 multithreading threshold profile\n# ways direct|indirect typebits basecount\n", file)};
+	static unsigned constexpr waysoftier[]{2u, 4u, 8u};
+	for(unsigned tier{}; 3u > tier; ++tier) for(unsigned indirection{}; 2u > indirection; ++indirection) for(unsigned size{}; 16u > size; ++size){
+		std::size_t basecount{helper::profiledthresholds[tier][indirection][size].load(std::memory_order_relaxed)};
+		if(basecount && 0 > std::fprintf(file, "%u %s %u %llu\n", waysoftier[tier], indirection? "indirect" : "direct", (size + 1u) * 8u, static_cast<unsigned long long>(basecount))) succeeded = false;
+	}
+	if(std::fclose(file)) succeeded = false;
+	return{succeeded};
+}
+
+#ifdef RSBD8_THRESHOLD_PROFILE
+// load the machine profile named by the macro at program startup, the compile-time defaults remain in use if that fails
+inline bool const isthresholdprofileloaded{loadthresholdprofile(RSBD8_THRESHOLD_PROFILE)};
+#endif
+
+// Multithreading strategy functions
+
+// set the multithreading strategy used by all subsequent sorting with 8 or more threads without indirection, the previously set strategy is returned
+RSBD8_FUNC_INLINE multithreadingstrategy setmultithreadingstrategy(multithreadingstrategy strategy)noexcept{
+	return{helper::activemultithreadingstrategy.exchange(strategy, std::memory_order_relaxed)};
+}
+
+// retrieve the currently set multithreading strategy
+RSBD8_NODISCARD RSBD8_FUNC_INLINE multithreadingstrategy getmultithreadingstrategy()noexcept{
+	return{helper::activemultithreadingstrategy.load(std::memory_order_relaxed)};
+}
+
+// Presortedness detection functions
+
+// enable or disable the presortedness detection of all subsequent multi-part sorting without indirection, the previous setting is returned
+RSBD8_FUNC_INLINE bool setpresortednessdetection(bool isenabled)noexcept{
+	return{helper::activepresortednessdetection.exchange(isenabled, std::memory_order_relaxed)};
+}
+
+// retrieve the current setting of the presortedness detection
+RSBD8_NODISCARD RSBD8_FUNC_INLINE bool getpresortednessdetection()noexcept{
+	return{helper::activepresortednessdetection.load(std::memory_order_relaxed)};
+}
+
+// Wrapper template functions for the main sorting functions in this library
+
+// wrapper for the multi-part radixsortcopynoalloc() function without indirection
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	void> radixsortcopynoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, T *RSBD8_RESTRICT buffer)noexcept{
+	assert(input != output);
+	assert(input != buffer);
+	assert(output != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+	assert(buffer);
 
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
@@ -60145,6 +64369,12 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
 	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if constexpr(helper::ispresortednessscanned<U>) if(helper::activepresortednessdetection.load(std::memory_order_relaxed))
+		if(helper::presortedsort<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			allowedthreads,
+#endif
+			reinterpret_cast<U const *>(input), reinterpret_cast<U *>(output), reinterpret_cast<U *>(buffer))) return;
 	helper::radixsortcopynoallocmulti<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
@@ -60176,6 +64406,12 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
 	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if constexpr(helper::ispresortednessscanned<U>) if(helper::activepresortednessdetection.load(std::memory_order_relaxed))
+		if(helper::presortedsort<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			allowedthreads,
+#endif
+			reinterpret_cast<U const *>(input), reinterpret_cast<U *>(movetobuffer? buffer : input), reinterpret_cast<U *>(movetobuffer? input : buffer))) return;
 	helper::radixsortnoallocmulti<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
@@ -60261,157 +64497,1322 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if constexpr((isabsvalue && issignmode) ||// both regular absolute modes
+		(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
+		helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input), reinterpret_cast<U *RSBD8_RESTRICT>(buffer));
+	else helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
+}
+
+// wrapper for the single-part radixsortnoalloc() function without indirection
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	void> radixsortnoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input)noexcept{
+	// do not pass a nullptr here
+	assert(input);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if constexpr((isabsvalue && issignmode) ||// both regular absolute modes
+		(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
+		static_assert(false, "Unsupported combination of sorting modes.");
+	else helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
+}
+
+// wrapper for the single-part radixsortnoalloc() and radixsortcopynoalloc() functions without indirection
+// this variant does not set the default "false" for the "movetobuffer" parameter
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	void> radixsortnoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, bool movetobuffer)noexcept{
+	assert(input != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(buffer);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if constexpr((isabsvalue && issignmode) ||// both regular absolute modes
+		(!isabsvalue && issignmode && isfltpmode)){// regular floating-point mode
+		if(!movetobuffer) helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input), reinterpret_cast<U *RSBD8_RESTRICT>(buffer));
+		else helper::radixsortcopynoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input), reinterpret_cast<U *RSBD8_RESTRICT>(buffer));
+	}else if(!movetobuffer) helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
+	else helper::radixsortcopynoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
+}
+
+// wrapper for the single-part radixsortnoalloc() and radixsortcopynoalloc() functions without indirection
+// this variant does not set the default "false" for the "movetobuffer" parameter
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	void> radixsortnoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, bool movetobuffer)noexcept{
+	// do not pass a nullptr here
+	assert(input);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if constexpr((isabsvalue && issignmode) ||// both regular absolute modes
+		(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
+		static_assert(false, "Unsupported combination of sorting modes.");
+	else if(!movetobuffer) helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
+	else helper::radixsortcopynoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
+}
+
+// wrapper to implement the radixsort() function without indirection, which only allocates some memory prior to sorting arrays
+// this requires no specialisation for handling the single-part types
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T),
+	bool> radixsort(std::size_t count, T *RSBD8_RESTRICT input
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+		)noexcept{
+	// do not pass a nullptr here
+	assert(input);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		auto
+#if defined(_POSIX_C_SOURCE)
+			[allocated, allocsize]
+#else
+			allocated
+#endif
+			{allocatearray<isabsvalue, issignmode, isfltpmode, T, false,
+			8u < CHAR_BIT * sizeof(T) ||// skip buffer allocation for these single-part types
+			(isabsvalue && issignmode) ||// both regular absolute modes
+			(!isabsvalue && issignmode && isfltpmode)// regular floating-point mode
+			>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+			, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+			, mmapflags
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			if constexpr(8u >= CHAR_BIT * sizeof(T) &&// skip buffer allocation for these single-part types
+				!(isabsvalue && issignmode) &&// both regular absolute modes
+				!(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
+				radixsortnoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input);
+			else radixsortnoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, allocated.pbuffer);// last parameter not filled in on purpose
+			deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				);
+			return{true};
+		}
+		return{false};
+	}
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the radixsort() function without indirection, which re-uses the memory held by a workspace for sorting arrays
+// this requires no specialisation for handling the single-part types
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T),
+	bool> radixsort(std::size_t count, T *RSBD8_RESTRICT input, sortworkspace &workspace)noexcept{
+	// do not pass a nullptr here
+	assert(input);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, false,
+			8u < CHAR_BIT * sizeof(T) ||// skip buffer allocation for these single-part types
+			(isabsvalue && issignmode) ||// both regular absolute modes
+			(!isabsvalue && issignmode && isfltpmode)// regular floating-point mode
+			>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			if constexpr(8u >= CHAR_BIT * sizeof(T) &&// skip buffer allocation for these single-part types
+				!(isabsvalue && issignmode) &&// both regular absolute modes
+				!(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
+				radixsortnoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input);
+			else radixsortnoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, allocated.pbuffer);// last parameter not filled in on purpose
+			return{true};
+		}
+		return{false};
+	}
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the radixsort() function without indirection, which splits the sorting over the nodes of a NUMA system
+// every node sorts a part of the array with its own processors and node-local buffer memory, and the sorted parts are merged afterwards
+// the regular radixsort() function is used for single-part types, inputs that are too small to split over the nodes, and systems with less than 2 nodes
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T),
+	bool> radixsort(std::size_t count, T *RSBD8_RESTRICT input, numatopology const &topology, bool ismovingpages = false)noexcept{
+	// do not pass a nullptr here
+	assert(input);
+
+#if !defined(RSBD8_THREAD_MAXIMUM) || 4 <= (RSBD8_THREAD_MAXIMUM)
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if constexpr(8u < CHAR_BIT * sizeof(T)){// the merging functions do not handle single-part types
+		using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+		static bool constexpr isdescsort{helper::isdescsort<direction>};
+		static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+		unsigned usednodes{helper::numausednodes(topology.nodecount())};
+		// only split if every node gets a part that is at least large enough for multithreading by itself
+		if(1u < usednodes && count / usednodes >= helper::runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U, false>()){
+			// allocate everything beforehand, so a failure leaves the array untouched
+			// the memory is only written to by the threads of the nodes, so most operating systems will place it node-locally
+			combinedallocation<T> allocated[numatopology::nodemaximum + 1u];// the final one is used for the shared buffer
+#if defined(_POSIX_C_SOURCE)
+			std::size_t allocsizes[numatopology::nodemaximum + 1u];
+#endif
+			unsigned allocatedcount{};
+			for(; usednodes >= allocatedcount; ++allocatedcount){
+				bool isbuffer{usednodes == allocatedcount};
+#if defined(_POSIX_C_SOURCE)
+				std::tie(allocated[allocatedcount], allocsizes[allocatedcount]) =
+#else
+				allocated[allocatedcount] =
+#endif
+					isbuffer? allocatearray<isabsvalue, issignmode, isfltpmode, T, false>(count, 1u)// only the buffer part is used
+					: allocatearray<isabsvalue, issignmode, isfltpmode, T, false, false>(count, topology.cpucount(allocatedcount));
+				if(!allocated[allocatedcount].pbuffer)RSBD8_UNLIKELY break;
+			}
+			bool succeeded{usednodes < allocatedcount};
+			if(succeeded)RSBD8_LIKELY{
+				void *pfuturesplaceholders[numatopology::nodemaximum], *pzeroedindices[numatopology::nodemaximum];
+				for(unsigned i{}; usednodes > i; ++i) pfuturesplaceholders[i] = allocated[i].pfuturesplaceholder, pzeroedindices[i] = allocated[i].pzeroedindices;
+				helper::numasortnodes<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U, true>(topology, usednodes, count,
+					reinterpret_cast<U *>(input), reinterpret_cast<U *>(input), reinterpret_cast<U *>(allocated[usednodes].pbuffer), pfuturesplaceholders, pzeroedindices, ismovingpages);
+			}
+			while(allocatedcount--) deallocatearray(allocated[allocatedcount].pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsizes[allocatedcount]
+#endif
+				);
+			return{succeeded};
+		}
+	}
+#else
+	static_cast<void>(topology);
+	static_cast<void>(ismovingpages);
+#endif
+	return{radixsort<direction, mode, T>(count, input)};
+}
+
+// wrapper to implement the multi-part radixsortcopy() function without indirection, which only allocates some memory prior to sorting arrays
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+		)noexcept{
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		auto
+#if defined(_POSIX_C_SOURCE)
+			[allocated, allocsize]
+#else
+			allocated
+#endif
+			{allocatearray<isabsvalue, issignmode, isfltpmode, T, false>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+			, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+			, mmapflags
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output, allocated.pbuffer);
+			deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the multi-part radixsortcopy() function without indirection, which re-uses the memory held by a workspace for sorting arrays
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, sortworkspace &workspace)noexcept{
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, false>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output, allocated.pbuffer);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the multi-part radixsortcopy() function without indirection, which splits the sorting over the nodes of a NUMA system
+// every node sorts a part of the array with its own processors and node-local buffer memory, and the sorted parts are merged afterwards
+// the regular radixsortcopy() function is used for inputs that are too small to split over the nodes, and systems with less than 2 nodes
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, numatopology const &topology, bool ismovingpages = false)noexcept{
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+#if !defined(RSBD8_THREAD_MAXIMUM) || 4 <= (RSBD8_THREAD_MAXIMUM)
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	unsigned usednodes{helper::numausednodes(topology.nodecount())};
+	// only split if every node gets a part that is at least large enough for multithreading by itself
+	if(1u < usednodes && count / usednodes >= helper::runtime2waythreshold<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U, false>()){
+		// allocate everything beforehand, so a failure leaves the output untouched
+		// the memory is only written to by the threads of the nodes, so most operating systems will place it node-locally
+		combinedallocation<T> allocated[numatopology::nodemaximum + 1u];// the final one is used for the shared buffer
+#if defined(_POSIX_C_SOURCE)
+		std::size_t allocsizes[numatopology::nodemaximum + 1u];
+#endif
+		unsigned allocatedcount{};
+		for(; usednodes >= allocatedcount; ++allocatedcount){
+			bool isbuffer{usednodes == allocatedcount};
+#if defined(_POSIX_C_SOURCE)
+			std::tie(allocated[allocatedcount], allocsizes[allocatedcount]) =
+#else
+			allocated[allocatedcount] =
+#endif
+				isbuffer? allocatearray<isabsvalue, issignmode, isfltpmode, T, false>(count, 1u)// only the buffer part is used
+				: allocatearray<isabsvalue, issignmode, isfltpmode, T, false, false>(count, topology.cpucount(allocatedcount));
+			if(!allocated[allocatedcount].pbuffer)RSBD8_UNLIKELY break;
+		}
+		bool succeeded{usednodes < allocatedcount};
+		if(succeeded)RSBD8_LIKELY{
+			void *pfuturesplaceholders[numatopology::nodemaximum], *pzeroedindices[numatopology::nodemaximum];
+			for(unsigned i{}; usednodes > i; ++i) pfuturesplaceholders[i] = allocated[i].pfuturesplaceholder, pzeroedindices[i] = allocated[i].pzeroedindices;
+			helper::numasortnodes<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U, false>(topology, usednodes, count,
+				reinterpret_cast<U const *>(input), reinterpret_cast<U *>(output), reinterpret_cast<U *>(allocated[usednodes].pbuffer), pfuturesplaceholders, pzeroedindices, ismovingpages);
+		}
+		while(allocatedcount--) deallocatearray(allocated[allocatedcount].pbuffer
+#if defined(_POSIX_C_SOURCE)
+			, allocsizes[allocatedcount]
+#endif
+			);
+		return{succeeded};
+	}
+#else
+	static_cast<void>(topology);
+	static_cast<void>(ismovingpages);
+#endif
+	return{radixsortcopy<direction, mode, T>(count, input, output)};
+}
+
+// wrapper to implement the single-part radixsortcopy() function without indirection, which only allocates some memory prior to sorting arrays
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+	, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+	, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+	)noexcept{
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		// the single-part version never needs an extra buffer
+		auto
+#if defined(_POSIX_C_SOURCE)
+			[allocated, allocsize]
+#else
+			allocated
+#endif
+			{allocatearray<isabsvalue, issignmode, isfltpmode, T, false, false>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+			, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+			, mmapflags
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output);
+			deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the single-part radixsortcopy() function without indirection, which re-uses the memory held by a workspace for sorting arrays
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, sortworkspace &workspace)noexcept{
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		// the single-part version never needs an extra buffer
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, false, false>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the single-part radixsortcopy() function without indirection, for use with a NUMA topology
+// the merging functions do not handle single-part types, and these are sorted in a single pass anyway, so this simply uses the regular radixsortcopy() function
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output, numatopology const &topology, bool ismovingpages = false)noexcept{
+	static_cast<void>(topology);
+	static_cast<void>(ismovingpages);
+	return{radixsortcopy<direction, mode, T>(count, input, output)};
+}
+
+// wrapper for the multi-part radixsortcopynoalloc() function with simple second-level indirection
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	void> radixsortcopynoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output, T *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
+	assert(input != output);
+	assert(input != buffer);
+	assert(output != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+	assert(buffer);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	using V = std::conditional_t<std::is_const_v<T> && std::is_volatile_v<T>, const volatile memberobjectgenerator<U, 0>,
+		std::conditional_t<std::is_const_v<T>, const memberobjectgenerator<U, 0>,
+		std::conditional_t<std::is_volatile_v<T>, volatile memberobjectgenerator<U, 0>,
+		memberobjectgenerator<U, 0>>>>;
+	helper::radixsortcopynoallocmulti<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<V *const RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(output), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+}
+
+// wrapper for the multi-part radixsortnoalloc() function with simple second-level indirection
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	void> radixsortnoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer = false, vararguments&&... varparameters)noexcept{
+	assert(input != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(buffer);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	using V = std::conditional_t<std::is_const_v<T> && std::is_volatile_v<T>, const volatile memberobjectgenerator<U, 0>,
+		std::conditional_t<std::is_const_v<T>, const memberobjectgenerator<U, 0>,
+		std::conditional_t<std::is_volatile_v<T>, volatile memberobjectgenerator<U, 0>,
+		memberobjectgenerator<U, 0>>>>;
+	helper::radixsortnoallocmulti<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), movetobuffer, std::forward<vararguments>(varparameters)...);
+}
+
+// wrapper for the single-part radixsortcopynoalloc() function with simple second-level indirection
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	void> radixsortcopynoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output, vararguments&&... varparameters)noexcept{
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	using V = std::conditional_t<std::is_const_v<T> && std::is_volatile_v<T>, const volatile memberobjectgenerator<U, 0>,
+		std::conditional_t<std::is_const_v<T>, const memberobjectgenerator<U, 0>,
+		std::conditional_t<std::is_volatile_v<T>, volatile memberobjectgenerator<U, 0>,
+		memberobjectgenerator<U, 0>>>>;
+	helper::radixsortcopynoallocsingle<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<V *const RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(output), std::forward<vararguments>(varparameters)...);
+}
+
+// wrapper for the single-part radixsortcopynoalloc() function with simple second-level indirection with a dummy buffer argument
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	void> radixsortcopynoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output, T *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
+	assert(input != output);
+	assert(input != buffer);
+	assert(output != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+	assert(buffer);
+
+	static_cast<void>(buffer);// the single-part version never needs an extra buffer
+	radixsortcopynoalloc<direction, mode, indirection2, isindexed2, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
+}
+
+// wrapper for the single-part radixsortnoalloc() function with simple second-level indirection
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	void> radixsortnoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
+	assert(input != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(buffer);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	using V = std::conditional_t<std::is_const_v<T> && std::is_volatile_v<T>, const volatile memberobjectgenerator<U, 0>,
+		std::conditional_t<std::is_const_v<T>, const memberobjectgenerator<U, 0>,
+		std::conditional_t<std::is_volatile_v<T>, volatile memberobjectgenerator<U, 0>,
+		memberobjectgenerator<U, 0>>>>;
+	helper::radixsortnoallocsingle<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+}
+
+// wrapper for the single-part radixsortnoalloc() and radixsortcopynoalloc() functions with simple second-level indirection
+// this variant does not set the default "false" for the "movetobuffer" parameter
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	void> radixsortnoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer, vararguments&&... varparameters)noexcept{
+	assert(input != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(buffer);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	using V = std::conditional_t<std::is_const_v<T> && std::is_volatile_v<T>, const volatile memberobjectgenerator<U, 0>,
+		std::conditional_t<std::is_const_v<T>, const memberobjectgenerator<U, 0>,
+		std::conditional_t<std::is_volatile_v<T>, volatile memberobjectgenerator<U, 0>,
+		memberobjectgenerator<U, 0>>>>;
+	if(!movetobuffer) helper::radixsortnoallocsingle<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+	else helper::radixsortcopynoallocsingle<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+}
+
+// wrapper to implement the radixsort() function with simple second-level indirection, which only allocates some memory prior to sorting arrays
+// this requires no specialisation for handling the single-part types
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T),
+	bool> radixsort(std::size_t count, T *RSBD8_RESTRICT *RSBD8_RESTRICT input
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+		, vararguments&&... varparameters)noexcept{
+	// do not pass a nullptr here
+	assert(input);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		auto
+#if defined(_POSIX_C_SOURCE)
+			[allocated, allocsize]
+#else
+			allocated
+#endif
+			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+			, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+			, mmapflags
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortnoalloc<direction, mode, indirection2, isindexed2, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, allocated.pbuffer, false, std::forward<vararguments>(varparameters)...);
+			deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				);
+			return{true};
+		}
+		return{false};
+	}
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the radixsort() function with simple second-level indirection, which re-uses the memory held by a workspace for sorting arrays
+// this requires no specialisation for handling the single-part types
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T),
+	bool> radixsort(std::size_t count, T *RSBD8_RESTRICT *RSBD8_RESTRICT input, sortworkspace &workspace, vararguments&&... varparameters)noexcept{
+	// do not pass a nullptr here
+	assert(input);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, true>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortnoalloc<direction, mode, indirection2, isindexed2, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, allocated.pbuffer, false, std::forward<vararguments>(varparameters)...);
+			return{true};
+		}
+		return{false};
+	}
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the multi-part radixsortcopy() function with simple second-level indirection, which only allocates some memory prior to sorting arrays
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+		, vararguments&&... varparameters)noexcept{
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		auto
+#if defined(_POSIX_C_SOURCE)
+			[allocated, allocsize]
+#else
+			allocated
+#endif
+			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+			, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+			, mmapflags
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<direction, mode, indirection2, isindexed2, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output, allocated.pbuffer, std::forward<vararguments>(varparameters)...);
+			deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the multi-part radixsortcopy() function with simple second-level indirection, which re-uses the memory held by a workspace for sorting arrays
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T) &&
+	8u < CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output, sortworkspace &workspace, vararguments&&... varparameters)noexcept{
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, true>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<direction, mode, indirection2, isindexed2, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output, allocated.pbuffer, std::forward<vararguments>(varparameters)...);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the single-part radixsortcopy() function with simple second-level indirection, which only allocates some memory prior to sorting arrays
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+		, vararguments&&... varparameters)noexcept{
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+	assert(!(largepagesize - 1u & largepagesize));// a maximum of one bit should be set in the value of largepagesize
+#endif
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		// the single-part version never needs an extra buffer
+		auto
+#if defined(_POSIX_C_SOURCE)
+			[allocated, allocsize]
+#else
+			allocated
+#endif
+			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true, false>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+			, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+			, mmapflags
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<direction, mode, indirection2, isindexed2, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
+			deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the single-part radixsortcopy() function with simple second-level indirection, which re-uses the memory held by a workspace for sorting arrays
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	8u >= CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output, sortworkspace &workspace, vararguments&&... varparameters)noexcept{
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		// the single-part version never needs an extra buffer
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, true, false>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<direction, mode, indirection2, isindexed2, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper for the multi-part radixsortcopynoalloc() function with indirection
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>) &&
+	8u < CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	void> radixsortcopynoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
+	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
+	assert(input != output);
+	assert(input != buffer);
+	assert(output != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+	assert(buffer);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	helper::radixsortcopynoallocmulti<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, pfuturesplaceholder,
+#endif
+		pzeroedindices, input, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+}
+
+// wrapper for the multi-part radixsortnoalloc() function with indirection
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>) &&
+	8u < CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	void> radixsortnoalloc(std::size_t count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+#endif
+		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer = false, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
+	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
+	assert(input != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(buffer);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
-	if constexpr((isabsvalue && issignmode) ||// both regular absolute modes
-		(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
-		helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
-#endif
-		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input), reinterpret_cast<U *RSBD8_RESTRICT>(buffer));
-	else helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	helper::radixsortnoallocmulti<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
+		pzeroedindices, input, buffer, movetobuffer, std::forward<vararguments>(varparameters)...);
 }
 
-// wrapper for the single-part radixsortnoalloc() function without indirection
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	8u >= CHAR_BIT * sizeof(T),
-	void> radixsortnoalloc(std::size_t count,
+// wrapper for the single-part radixsortcopynoalloc() function with indirection
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<// disable the option for with the V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer argument here, and do not allow active compile-time template evaluation with it
+	!std::is_same_v<V *RSBD8_RESTRICT *RSBD8_RESTRICT, std::conditional_t<0u < sizeof...(vararguments),
+		std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>> &&
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<
+		typename std::enable_if<!std::is_same_v<V *RSBD8_RESTRICT *RSBD8_RESTRICT, std::conditional_t<0u < sizeof...(vararguments),
+			std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>>,
+			helper::memberpointerdeducebody<indirection1, isindexed2, false, V, vararguments...>>::type>>),
+	void> radixsortcopynoalloc(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input)noexcept{
+		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
+	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
+	assert(input != output);
 	// do not pass a nullptr here
 	assert(input);
+	assert(output);
 
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
-	if constexpr((isabsvalue && issignmode) ||// both regular absolute modes
-		(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
-		static_assert(false, "Unsupported combination of sorting modes.");
-	else helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	helper::radixsortcopynoallocsingle<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
+		pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
 }
 
-// wrapper for the single-part radixsortnoalloc() and radixsortcopynoalloc() functions without indirection
-// this variant does not set the default "false" for the "movetobuffer" parameter
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+// wrapper for the single-part radixsortcopynoalloc() function with indirection with a dummy buffer argument
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	8u >= CHAR_BIT * sizeof(T),
-	void> radixsortnoalloc(std::size_t count,
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	void> radixsortcopynoalloc(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, bool movetobuffer)noexcept{
+		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	assert(input != output);
 	assert(input != buffer);
+	assert(output != buffer);
 	// do not pass a nullptr here
 	assert(input);
+	assert(output);
 	assert(buffer);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
-	static bool constexpr issignmode{helper::issignmode<mode, T>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
-	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
-	if constexpr((isabsvalue && issignmode) ||// both regular absolute modes
-		(!isabsvalue && issignmode && isfltpmode)){// regular floating-point mode
-		if(!movetobuffer) helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
-#endif
-		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input), reinterpret_cast<U *RSBD8_RESTRICT>(buffer));
-		else helper::radixsortcopynoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+	static_cast<void>(buffer);// the single-part version never needs an extra buffer
+	helper::radixsortcopynoallocsingle<indirection1, direction, mode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input), reinterpret_cast<U *RSBD8_RESTRICT>(buffer));
-	}else if(!movetobuffer) helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+		pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
+}
+
+// wrapper for the single-part radixsortnoalloc() function with indirection
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<// disable the option for with the bool movetobuffer argument here, and do not allow active compile-time template evaluation with it
+	!std::is_same_v<bool, std::conditional_t<0u < sizeof...(vararguments),
+		std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>> &&
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<
+		typename std::enable_if<!std::is_same_v<bool, std::conditional_t<0u < sizeof...(vararguments),
+			std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>>,
+			helper::memberpointerdeducebody<indirection1, isindexed2, false, V, vararguments...>>::type>>),
+	void> radixsortnoalloc(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
-	else helper::radixsortcopynoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
+	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
+	assert(input != buffer);
+	// do not pass a nullptr here
+	assert(input);
+	assert(buffer);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	helper::radixsortnoallocsingle<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
+		pzeroedindices, input, buffer, std::forward<vararguments>(varparameters)...);
 }
 
-// wrapper for the single-part radixsortnoalloc() and radixsortcopynoalloc() functions without indirection
+// wrapper for the single-part radixsortnoalloc() and radixsortcopynoalloc() functions with indirection
 // this variant does not set the default "false" for the "movetobuffer" parameter
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	8u >= CHAR_BIT * sizeof(T),
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
 	void> radixsortnoalloc(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, bool movetobuffer)noexcept{
+		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
+	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
+	assert(input != buffer);
 	// do not pass a nullptr here
 	assert(input);
+	assert(buffer);
 
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
-	if constexpr((isabsvalue && issignmode) ||// both regular absolute modes
-		(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
-		static_assert(false, "Unsupported combination of sorting modes.");
-	else if(!movetobuffer) helper::radixsortnoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	if(!movetobuffer){
+		helper::radixsortnoallocsingle<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+			allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
-	else helper::radixsortcopynoallocsingle<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count,
+			pzeroedindices, input, buffer, std::forward<vararguments>(varparameters)...);
+	}else{
+		helper::radixsortcopynoallocsingle<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+			allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<U *RSBD8_RESTRICT>(input));
+			pzeroedindices, input, buffer, std::forward<vararguments>(varparameters)...);
+	}
 }
 
-// wrapper to implement the radixsort() function without indirection, which only allocates some memory prior to sorting arrays
+// wrapper to implement the radixsort() function with indirection, which only allocates some memory prior to sorting arrays
 // this requires no specialisation for handling the single-part types
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	128u >= CHAR_BIT * sizeof(T),
-	bool> radixsort(std::size_t count, T *RSBD8_RESTRICT input
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	bool> radixsort(std::size_t count, V *RSBD8_RESTRICT *RSBD8_RESTRICT input
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
 		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
-		)noexcept{
+		, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	// do not pass a nullptr here
 	assert(input);
 
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
@@ -60425,11 +65826,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 #else
 			allocated
 #endif
-			{allocatearray<isabsvalue, issignmode, isfltpmode, T, false,
-			8u < CHAR_BIT * sizeof(T) ||// skip buffer allocation for these single-part types
-			(isabsvalue && issignmode) ||// both regular absolute modes
-			(!isabsvalue && issignmode && isfltpmode)// regular floating-point mode
-			>(count
+			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true>(count
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 			, allowedthreads
 #endif
@@ -60440,24 +65837,52 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 #endif
 			)};
 		if(allocated.pbuffer)RSBD8_LIKELY{
-			if constexpr(8u >= CHAR_BIT * sizeof(T) &&// skip buffer allocation for these single-part types
-				!(isabsvalue && issignmode) &&// both regular absolute modes
-				!(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
-				radixsortnoalloc<direction, mode, T>(count,
+			buffermemorywrapper guard{allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				};// ensure the buffer is deallocated, even if an exception is thrown by the getter function here
+			radixsortnoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 				allowedthreads, allocated.pfuturesplaceholder,
 #endif
-				allocated.pzeroedindices, input);
-			else radixsortnoalloc<direction, mode, T>(count,
+				allocated.pzeroedindices, input, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), false, std::forward<vararguments>(varparameters)...);
+			return{true};
+		}
+		return{false};
+	}
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the radixsort() function with indirection, which re-uses the memory held by a workspace for sorting arrays
+// this requires no specialisation for handling the single-part types
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	bool> radixsort(std::size_t count, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, sortworkspace &workspace, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	// do not pass a nullptr here
+	assert(input);
+
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-				allowedthreads, allocated.pfuturesplaceholder,
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-				allocated.pzeroedindices, input, allocated.pbuffer);// last parameter not filled in on purpose
-			deallocatearray(allocated.pbuffer
-#if defined(_POSIX_C_SOURCE)
-				, allocsize
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, true>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
 #endif
-				);
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortnoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), false, std::forward<vararguments>(varparameters)...);
 			return{true};
 		}
 		return{false};
@@ -60465,26 +65890,25 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 	return{true};// the array is already considered sorted if the count is 0 or 1
 }
 
-// wrapper to implement the multi-part radixsortcopy() function without indirection, which only allocates some memory prior to sorting arrays
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+// wrapper to implement the multi-part radixsortcopy() function with indirection, which only allocates some memory prior to sorting arrays
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	128u >= CHAR_BIT * sizeof(T) &&
-	8u < CHAR_BIT * sizeof(T),
-	bool> radixsortcopy(std::size_t count, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>) &&
+	8u < CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
 		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
-		)noexcept{
+		, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	assert(input != output);
 	// do not pass a nullptr here
 	assert(input);
 	assert(output);
 
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
@@ -60498,7 +65922,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 #else
 			allocated
 #endif
-			{allocatearray<isabsvalue, issignmode, isfltpmode, T, false>(count
+			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true>(count
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 			, allowedthreads
 #endif
@@ -60509,16 +65933,54 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 #endif
 			)};
 		if(allocated.pbuffer)RSBD8_LIKELY{
-			radixsortcopynoalloc<direction, mode, T>(count,
+			buffermemorywrapper guard{allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				};// ensure the buffer is deallocated, even if an exception is thrown by the getter function here
+			radixsortcopynoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 				allowedthreads, allocated.pfuturesplaceholder,
 #endif
-				allocated.pzeroedindices, input, output, allocated.pbuffer);
-			deallocatearray(allocated.pbuffer
-#if defined(_POSIX_C_SOURCE)
-				, allocsize
+				allocated.pzeroedindices, input, output, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), std::forward<vararguments>(varparameters)...);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the multi-part radixsortcopy() function with indirection, which re-uses the memory held by a workspace for sorting arrays
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>) &&
+	8u < CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, sortworkspace &workspace, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-				);
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, true>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), std::forward<vararguments>(varparameters)...);
 			return{true};
 		}
 		return{false};
@@ -60526,25 +65988,27 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 	return{true};// the array is already considered sorted if the count is 0 or 1
 }
 
-// wrapper to implement the single-part radixsortcopy() function without indirection, which only allocates some memory prior to sorting arrays
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+// wrapper to implement the single-part radixsortcopy() function with indirection, which only allocates some memory prior to sorting arrays
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	8u >= CHAR_BIT * sizeof(T),
-	bool> radixsortcopy(std::size_t count, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-	, std::size_t largepagesize = 0u
+		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
-	, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+		, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+	assert(!(largepagesize - 1u & largepagesize));// a maximum of one bit should be set in the value of largepagesize
 #endif
-	)noexcept{
 	assert(input != output);
 	// do not pass a nullptr here
 	assert(input);
 	assert(output);
 
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
@@ -60559,7 +66023,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 #else
 			allocated
 #endif
-			{allocatearray<isabsvalue, issignmode, isfltpmode, T, false, false>(count
+			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true, false>(count
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 			, allowedthreads
 #endif
@@ -60570,16 +66034,54 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 #endif
 			)};
 		if(allocated.pbuffer)RSBD8_LIKELY{
-			radixsortcopynoalloc<direction, mode, T>(count,
+			buffermemorywrapper guard{allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				};// ensure the buffer is deallocated, even if an exception is thrown by the getter function here
+			radixsortcopynoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 				allowedthreads, allocated.pfuturesplaceholder,
 #endif
-				allocated.pzeroedindices, input, output);
-			deallocatearray(allocated.pbuffer
-#if defined(_POSIX_C_SOURCE)
-				, allocsize
+				allocated.pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the single-part radixsortcopy() function with indirection, which re-uses the memory held by a workspace for sorting arrays
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, sortworkspace &workspace, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-				);
+		// the single-part version never needs an extra buffer
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, true, false>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
 			return{true};
 		}
 		return{false};
@@ -60587,19 +66089,17 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 	return{true};// the array is already considered sorted if the count is 0 or 1
 }
 
-// wrapper for the multi-part radixsortcopynoalloc() function with simple second-level indirection
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+// wrapper for the multi-part radixsortcopynoalloc() function with type and offset pointer indirection
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	128u >= CHAR_BIT * sizeof(T) &&
-	8u < CHAR_BIT * sizeof(T),
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>) &&
+	8u < CHAR_BIT * sizeof(std::remove_pointer_t<T>),
 	void> radixsortcopynoalloc(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output, T *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
+		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
+	static_assert(!std::is_pointer_v<std::remove_pointer_t<T>>, "third level indirection is not supported");
 	assert(input != output);
 	assert(input != buffer);
 	assert(output != buffer);
@@ -60608,104 +66108,102 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 	assert(output);
 	assert(buffer);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
-	static bool constexpr issignmode{helper::issignmode<mode, T>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, std::remove_pointer_t<T>>};
+	static bool constexpr issignmode{helper::issignmode<mode, std::remove_pointer_t<T>>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, std::remove_pointer_t<T>>};
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
 	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
-	using V = std::conditional_t<std::is_const_v<T> && std::is_volatile_v<T>, const volatile memberobjectgenerator<U, 0>,
-		std::conditional_t<std::is_const_v<T>, const memberobjectgenerator<U, 0>,
-		std::conditional_t<std::is_volatile_v<T>, volatile memberobjectgenerator<U, 0>,
-		memberobjectgenerator<U, 0>>>>;
-	helper::radixsortcopynoallocmulti<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+	using W = helper::tounifunsigned<std::remove_pointer_t<T>, isabsvalue, issignmode, isfltpmode>;
+	using U = std::conditional_t<std::is_const_v<V> && std::is_volatile_v<V>, const volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		std::conditional_t<std::is_const_v<V>, const memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		std::conditional_t<std::is_volatile_v<V>, volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>>>>;
+	helper::radixsortcopynoallocmulti<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<V *const RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(output), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+		pzeroedindices, reinterpret_cast<U *const RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(output), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
 }
 
-// wrapper for the multi-part radixsortnoalloc() function with simple second-level indirection
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+// wrapper for the multi-part radixsortnoalloc() function with type and offset pointer indirection
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	128u >= CHAR_BIT * sizeof(T) &&
-	8u < CHAR_BIT * sizeof(T),
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>) &&
+	8u < CHAR_BIT * sizeof(std::remove_pointer_t<T>),
 	void> radixsortnoalloc(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer = false, vararguments&&... varparameters)noexcept{
+		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer = false, vararguments&&... varparameters)noexcept{
+	static_assert(!std::is_pointer_v<std::remove_pointer_t<T>>, "third level indirection is not supported");
 	assert(input != buffer);
 	// do not pass a nullptr here
 	assert(input);
 	assert(buffer);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
-	static bool constexpr issignmode{helper::issignmode<mode, T>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, std::remove_pointer_t<T>>};
+	static bool constexpr issignmode{helper::issignmode<mode, std::remove_pointer_t<T>>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, std::remove_pointer_t<T>>};
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
 	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
-	using V = std::conditional_t<std::is_const_v<T> && std::is_volatile_v<T>, const volatile memberobjectgenerator<U, 0>,
-		std::conditional_t<std::is_const_v<T>, const memberobjectgenerator<U, 0>,
-		std::conditional_t<std::is_volatile_v<T>, volatile memberobjectgenerator<U, 0>,
-		memberobjectgenerator<U, 0>>>>;
-	helper::radixsortnoallocmulti<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+	using W = helper::tounifunsigned<std::remove_pointer_t<T>, isabsvalue, issignmode, isfltpmode>;
+	using U = std::conditional_t<std::is_const_v<V> && std::is_volatile_v<V>, const volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		std::conditional_t<std::is_const_v<V>, const memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		std::conditional_t<std::is_volatile_v<V>, volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>>>>;
+	helper::radixsortnoallocmulti<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), movetobuffer, std::forward<vararguments>(varparameters)...);
+		pzeroedindices, reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), movetobuffer, std::forward<vararguments>(varparameters)...);
 }
 
-// wrapper for the single-part radixsortcopynoalloc() function with simple second-level indirection
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	8u >= CHAR_BIT * sizeof(T),
+// wrapper for the single-part radixsortcopynoalloc() function with type and offset pointer indirection
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<// disable the option for with the V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer argument here, and do not allow active compile-time template evaluation with it
+	!std::is_same_v<V *RSBD8_RESTRICT *RSBD8_RESTRICT, std::conditional_t<0u < sizeof...(vararguments),
+		std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>> &&
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<
+		typename std::enable_if<!std::is_same_v<V *RSBD8_RESTRICT *RSBD8_RESTRICT, std::conditional_t<0u < sizeof...(vararguments),
+			std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>>,
+			helper::memberpointerdeducebody<indirection1, isindexed2, false, V, vararguments...>>::type>>),
 	void> radixsortcopynoalloc(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output, vararguments&&... varparameters)noexcept{
+		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, vararguments&&... varparameters)noexcept{
+	static_assert(!std::is_pointer_v<std::remove_pointer_t<T>>, "third level indirection is not supported");
 	assert(input != output);
 	// do not pass a nullptr here
 	assert(input);
 	assert(output);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
-	static bool constexpr issignmode{helper::issignmode<mode, T>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, std::remove_pointer_t<T>>};
+	static bool constexpr issignmode{helper::issignmode<mode, std::remove_pointer_t<T>>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, std::remove_pointer_t<T>>};
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
 	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
-	using V = std::conditional_t<std::is_const_v<T> && std::is_volatile_v<T>, const volatile memberobjectgenerator<U, 0>,
-		std::conditional_t<std::is_const_v<T>, const memberobjectgenerator<U, 0>,
-		std::conditional_t<std::is_volatile_v<T>, volatile memberobjectgenerator<U, 0>,
-		memberobjectgenerator<U, 0>>>>;
-	helper::radixsortcopynoallocsingle<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+	using W = helper::tounifunsigned<std::remove_pointer_t<T>, isabsvalue, issignmode, isfltpmode>;
+	using U = std::conditional_t<std::is_const_v<V> && std::is_volatile_v<V>, const volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		std::conditional_t<std::is_const_v<V>, const memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		std::conditional_t<std::is_volatile_v<V>, volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>>>>;
+	helper::radixsortcopynoallocsingle<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<V *const RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(output), std::forward<vararguments>(varparameters)...);
+		pzeroedindices, reinterpret_cast<U *const RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(output), std::forward<vararguments>(varparameters)...);
 }
 
-// wrapper for the single-part radixsortcopynoalloc() function with simple second-level indirection with a dummy buffer argument
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+// wrapper for the single-part radixsortcopynoalloc() function with type and offset pointer indirection with a dummy buffer argument
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	8u >= CHAR_BIT * sizeof(T),
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>),
 	void> radixsortcopynoalloc(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output, T *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
+		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
 	assert(input != output);
 	assert(input != buffer);
 	assert(output != buffer);
@@ -60715,96 +66213,94 @@ RSBD8_FUNC_INLINE std::enable_if_t<
 	assert(buffer);
 
 	static_cast<void>(buffer);// the single-part version never needs an extra buffer
-	radixsortcopynoalloc<direction, mode, indirection2, isindexed2, T>(count,
+	helper::radixsortcopynoallocsingle<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
 		pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
 }
 
-// wrapper for the single-part radixsortnoalloc() function with simple second-level indirection
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	8u >= CHAR_BIT * sizeof(T),
+// wrapper for the single-part radixsortnoalloc() function with type and offset pointer indirection
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_FUNC_INLINE std::enable_if_t<// disable the option for with the bool movetobuffer argument here, and do not allow active compile-time template evaluation with it
+	!std::is_same_v<bool, std::conditional_t<0u < sizeof...(vararguments),
+		std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>> &&
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<
+		typename std::enable_if<!std::is_same_v<bool, std::conditional_t<0u < sizeof...(vararguments),
+			std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>>,
+			helper::memberpointerdeducebody<indirection1, isindexed2, false, V, vararguments...>>::type>>),
 	void> radixsortnoalloc(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
+		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
+	static_assert(!std::is_pointer_v<std::remove_pointer_t<T>>, "third level indirection is not supported");
 	assert(input != buffer);
 	// do not pass a nullptr here
 	assert(input);
 	assert(buffer);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
-	static bool constexpr issignmode{helper::issignmode<mode, T>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
-	using V = std::conditional_t<std::is_const_v<T> && std::is_volatile_v<T>, const volatile memberobjectgenerator<U, 0>,
-		std::conditional_t<std::is_const_v<T>, const memberobjectgenerator<U, 0>,
-		std::conditional_t<std::is_volatile_v<T>, volatile memberobjectgenerator<U, 0>,
-		memberobjectgenerator<U, 0>>>>;
-	helper::radixsortnoallocsingle<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, std::remove_pointer_t<T>>};
+	static bool constexpr issignmode{helper::issignmode<mode, std::remove_pointer_t<T>>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, std::remove_pointer_t<T>>};
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
+	using W = helper::tounifunsigned<std::remove_pointer_t<T>, isabsvalue, issignmode, isfltpmode>;
+	using U = std::conditional_t<std::is_const_v<V> && std::is_volatile_v<V>, const volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		std::conditional_t<std::is_const_v<V>, const memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		std::conditional_t<std::is_volatile_v<V>, volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>>>>;
+	helper::radixsortnoallocsingle<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+		pzeroedindices, reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
 }
 
-// wrapper for the single-part radixsortnoalloc() and radixsortcopynoalloc() functions with simple second-level indirection
+// wrapper for the single-part radixsortnoalloc() and radixsortcopynoalloc() functions with with type and offset pointer indirection
 // this variant does not set the default "false" for the "movetobuffer" parameter
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	8u >= CHAR_BIT * sizeof(T),
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>),
 	void> radixsortnoalloc(std::size_t count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer, vararguments&&... varparameters)noexcept{
+		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer, vararguments&&... varparameters)noexcept{
+	static_assert(!std::is_pointer_v<std::remove_pointer_t<T>>, "third level indirection is not supported");
 	assert(input != buffer);
 	// do not pass a nullptr here
 	assert(input);
 	assert(buffer);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
-	static bool constexpr issignmode{helper::issignmode<mode, T>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, std::remove_pointer_t<T>>};
+	static bool constexpr issignmode{helper::issignmode<mode, std::remove_pointer_t<T>>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, std::remove_pointer_t<T>>};
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
 	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
-	using V = std::conditional_t<std::is_const_v<T> && std::is_volatile_v<T>, const volatile memberobjectgenerator<U, 0>,
-		std::conditional_t<std::is_const_v<T>, const memberobjectgenerator<U, 0>,
-		std::conditional_t<std::is_volatile_v<T>, volatile memberobjectgenerator<U, 0>,
-		memberobjectgenerator<U, 0>>>>;
-	if(!movetobuffer) helper::radixsortnoallocsingle<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+	using W = helper::tounifunsigned<std::remove_pointer_t<T>, isabsvalue, issignmode, isfltpmode>;
+	using U = std::conditional_t<std::is_const_v<V> && std::is_volatile_v<V>, const volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		std::conditional_t<std::is_const_v<V>, const memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		std::conditional_t<std::is_volatile_v<V>, volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
+		memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>>>>;
+	if(!movetobuffer) helper::radixsortnoallocsingle<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
-	else helper::radixsortcopynoallocsingle<&V::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2>(count,
+		pzeroedindices, reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+	else helper::radixsortcopynoallocsingle<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+		pzeroedindices, reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
 }
 
-// wrapper to implement the radixsort() function with simple second-level indirection, which only allocates some memory prior to sorting arrays
+// wrapper to implement the radixsort() function with with type and offset pointer indirection, which only allocates some memory prior to sorting arrays with indirection
 // this requires no specialisation for handling the single-part types
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	128u >= CHAR_BIT * sizeof(T),
-	bool> radixsort(std::size_t count, T *RSBD8_RESTRICT *RSBD8_RESTRICT input
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>),
+	bool> radixsort(std::size_t count, V *RSBD8_RESTRICT *RSBD8_RESTRICT input
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
@@ -60838,11 +66334,11 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 #endif
 			)};
 		if(allocated.pbuffer)RSBD8_LIKELY{
-			radixsortnoalloc<direction, mode, indirection2, isindexed2, T>(count,
+			radixsortnoalloc<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 				allowedthreads, allocated.pfuturesplaceholder,
 #endif
-				allocated.pzeroedindices, input, allocated.pbuffer, false, std::forward<vararguments>(varparameters)...);
+				allocated.pzeroedindices, input, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), false, std::forward<vararguments>(varparameters)...);
 			deallocatearray(allocated.pbuffer
 #if defined(_POSIX_C_SOURCE)
 				, allocsize
@@ -60855,15 +66351,46 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 	return{true};// the array is already considered sorted if the count is 0 or 1
 }
 
-// wrapper to implement the multi-part radixsortcopy() function with simple second-level indirection, which only allocates some memory prior to sorting arrays
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+// wrapper to implement the radixsort() function with with type and offset pointer indirection, which re-uses the memory held by a workspace for sorting arrays
+// this requires no specialisation for handling the single-part types
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	128u >= CHAR_BIT * sizeof(T) &&
-	8u < CHAR_BIT * sizeof(T),
-	bool> radixsortcopy(std::size_t count, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>),
+	bool> radixsort(std::size_t count, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, sortworkspace &workspace, vararguments&&... varparameters)noexcept{
+	// do not pass a nullptr here
+	assert(input);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, true>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortnoalloc<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), false, std::forward<vararguments>(varparameters)...);
+			return{true};
+		}
+		return{false};
+	}
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the multi-part radixsortcopy() function with with type and offset pointer indirection, which only allocates some memory prior to sorting arrays with indirection
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>) &&
+	8u < CHAR_BIT * sizeof(std::remove_pointer_t<T>),
+	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
@@ -60899,11 +66426,11 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 #endif
 			)};
 		if(allocated.pbuffer)RSBD8_LIKELY{
-			radixsortcopynoalloc<direction, mode, indirection2, isindexed2, T>(count,
+			radixsortcopynoalloc<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 				allowedthreads, allocated.pfuturesplaceholder,
 #endif
-				allocated.pzeroedindices, input, output, allocated.pbuffer, std::forward<vararguments>(varparameters)...);
+				allocated.pzeroedindices, input, output, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), std::forward<vararguments>(varparameters)...);
 			deallocatearray(allocated.pbuffer
 #if defined(_POSIX_C_SOURCE)
 				, allocsize
@@ -60916,14 +66443,47 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 	return{true};// the array is already considered sorted if the count is 0 or 1
 }
 
-// wrapper to implement the single-part radixsortcopy() function with simple second-level indirection, which only allocates some memory prior to sorting arrays
-template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename T, typename... vararguments>
+// wrapper to implement the multi-part radixsortcopy() function with with type and offset pointer indirection, which re-uses the memory held by a workspace for sorting arrays
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	(std::is_arithmetic_v<T> ||
-	std::is_enum_v<T> ||
-	std::is_class_v<T> || std::is_union_v<T>) &&
-	8u >= CHAR_BIT * sizeof(T),
-	bool> radixsortcopy(std::size_t count, T *const RSBD8_RESTRICT *RSBD8_RESTRICT input, T *RSBD8_RESTRICT *RSBD8_RESTRICT output
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>) &&
+	8u < CHAR_BIT * sizeof(std::remove_pointer_t<T>),
+	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, sortworkspace &workspace, vararguments&&... varparameters)noexcept{
+	assert(input != output);
+	// do not pass a nullptr here
+	assert(input);
+	assert(output);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, true>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), std::forward<vararguments>(varparameters)...);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
+}
+
+// wrapper to implement the single-part radixsortcopy() function with with type and offset pointer indirection, which only allocates some memory prior to sorting arrays with indirection
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>),
+	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
@@ -60963,7 +66523,7 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 #endif
 			)};
 		if(allocated.pbuffer)RSBD8_LIKELY{
-			radixsortcopynoalloc<direction, mode, indirection2, isindexed2, T>(count,
+			radixsortcopynoalloc<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 				allowedthreads, allocated.pfuturesplaceholder,
 #endif
@@ -60980,761 +66540,1485 @@ RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
 	return{true};// the array is already considered sorted if the count is 0 or 1
 }
 
-// wrapper for the multi-part radixsortcopynoalloc() function with indirection
-template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	std::is_member_pointer_v<decltype(indirection1)> &&
-	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>) &&
-	8u < CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
-	void> radixsortcopynoalloc(std::size_t count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
-#endif
-		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
-	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
+// wrapper to implement the single-part radixsortcopy() function with with type and offset pointer indirection, which re-uses the memory held by a workspace for sorting arrays
+template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>),
+	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, sortworkspace &workspace, vararguments&&... varparameters)noexcept{
 	assert(input != output);
-	assert(input != buffer);
-	assert(output != buffer);
 	// do not pass a nullptr here
 	assert(input);
 	assert(output);
-	assert(buffer);
 
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	helper::radixsortcopynoallocmulti<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
+	if(1u < count)RSBD8_LIKELY{// do not touch the workspace if the array is already considered sorted
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-		pzeroedindices, input, output, std::forward<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+		// the single-part version never needs an extra buffer
+		auto allocated{workspace.prepare<isabsvalue, issignmode, isfltpmode, T, true, false>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
+#endif
+			)};
+		if(allocated.pbuffer)RSBD8_LIKELY{
+			radixsortcopynoalloc<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
+			return{true};
+		}
+		return{false};
+	}else if(1u == count) *output = *input;// copy the single element if the count is 1
+	return{true};// the array is already considered sorted if the count is 0 or 1
 }
 
-// wrapper for the multi-part radixsortnoalloc() function with indirection
-template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	std::is_member_pointer_v<decltype(indirection1)> &&
-	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>) &&
-	8u < CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
-	void> radixsortnoalloc(std::size_t count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+// Key and payload sorting functions
+
+// sort an array of keys together with a separate array of payloads of the same count, the payload of every key is moved along with it in every sorting pass
+// this avoids both the pointer arrays of the indirection functions and packing the keys and payloads into a structure beforehand
+// the order of equal keys follows the sorting direction like it does for the other sorting functions, and the payloads can be of any trivially copyable type
+// the output arrays can be the input arrays, which is what the in-place function below does
+// false is returned if the memory cannot be allocated, the arrays are left unchanged then
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T, typename P>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixsortcopy(std::size_t count, T const *keys, P const *payloads, T *outkeys, P *outpayloads
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer = false, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
-	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
-	assert(input != buffer);
+		)noexcept{
+	static_assert(std::is_trivially_copyable_v<P>, "the payloads are copied as raw memory");
 	// do not pass a nullptr here
-	assert(input);
-	assert(buffer);
+	assert(keys);
+	assert(payloads);
+	assert(outkeys);
+	assert(outpayloads);
 
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	helper::radixsortnoallocmulti<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	static std::size_t constexpr stride{helper::keyvaluecountslength<isabsvalue, issignmode, isfltpmode, U>};
+	if(2u > count){// nothing to sort
+		if(keys != outkeys){
+			std::memcpy(outkeys, keys, count * sizeof(T));
+			std::memcpy(outpayloads, payloads, count * sizeof(P));
+		}
+		return{true};
+	}
+	if(SIZE_MAX / (sizeof(T) + sizeof(P) + alignof(P)) < count)RSBD8_UNLIKELY return{false};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+	unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-		pzeroedindices, input, buffer, movetobuffer, std::forward<vararguments>(varparameters)...);
+	unsigned const parts{helper::keyvalueparts<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+		)};
+	// the buffer for the keys is followed by the one for the payloads and the index counts of all the parts, each aligned for its type
+	std::size_t const payloadsoffset{(count * sizeof(T) + alignof(P) - 1u) & ~(alignof(P) - 1u)};
+	std::size_t const countsoffset{(payloadsoffset + count * sizeof(P) + alignof(std::size_t) - 1u) & ~(alignof(std::size_t) - 1u)};
+	std::size_t const countssize{parts * stride * sizeof(std::size_t)};
+	auto
+#if defined(_POSIX_C_SOURCE)
+		[allocated, allocsize]
+#else
+		allocated
+#endif
+		{allocatearray<isabsvalue, issignmode, isfltpmode, T, false>((countsoffset + countssize + sizeof(T) - 1u) / sizeof(T)
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+		, mmapflags
+#endif
+		)};
+	if(allocated.pbuffer)RSBD8_LIKELY{
+		std::byte *pbuffer{reinterpret_cast<std::byte *>(allocated.pbuffer)};
+		std::size_t *pcounts{reinterpret_cast<std::size_t *>(pbuffer + countsoffset)};
+		std::memset(pcounts, 0, countssize);
+		helper::keyvaluesort<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U, P>(count, parts, pcounts,
+			reinterpret_cast<U const *>(keys), payloads, reinterpret_cast<U *>(outkeys), outpayloads,
+			reinterpret_cast<U *>(pbuffer), reinterpret_cast<P *>(pbuffer + payloadsoffset));
+		deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+			, allocsize
+#endif
+			);
+		return{true};
+	}
+	return{false};
 }
 
-// wrapper for the single-part radixsortcopynoalloc() function with indirection
-template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<// disable the option for with the V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer argument here, and do not allow active compile-time template evaluation with it
-	!std::is_same_v<V *RSBD8_RESTRICT *RSBD8_RESTRICT, std::conditional_t<0u < sizeof...(vararguments),
-		std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>> &&
-	std::is_member_pointer_v<decltype(indirection1)> &&
-	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<
-		typename std::enable_if<!std::is_same_v<V *RSBD8_RESTRICT *RSBD8_RESTRICT, std::conditional_t<0u < sizeof...(vararguments),
-			std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>>,
-			helper::memberpointerdeducebody<indirection1, isindexed2, false, V, vararguments...>>::type>>),
-	void> radixsortcopynoalloc(std::size_t count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+// sort an array of keys together with a separate array of payloads of the same count in place, like the function above
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T, typename P>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixsort(std::size_t count, T *RSBD8_RESTRICT keys, P *RSBD8_RESTRICT payloads
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
-	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
-	assert(input != output);
-	// do not pass a nullptr here
-	assert(input);
-	assert(output);
+		)noexcept{
+	return{radixsortcopy<direction, mode, T, P>(count, keys, payloads, keys, payloads
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+		, mmapflags
+#endif
+		)};
+}
+
+// write the permutation that sorts an array of keys to an array of indices, and the sorted keys to the output keys array, which can be the keys array
+// this sorts the keys together with the indices like the functions above, and the indices are generated by the first sorting pass
+// the sorted keys come from the last sorting pass, so the keys do not need to be gathered in the order of the permutation afterwards
+// use 32-bit indices for up to 4G items to halve the memory traffic of the indices, false is returned if the index type cannot hold the positions of all items
+// false is also returned if the memory cannot be allocated, the output arrays are left unchanged then
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T, typename I>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T) &&
+	std::is_unsigned_v<I> && !std::is_same_v<bool, I>,
+	bool> argsortcopy(std::size_t count, T const *keys, I *RSBD8_RESTRICT outindices, T *outkeys
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+		)noexcept{
+	// do not pass a nullptr here, except for outkeys if the sorted keys are not needed
+	assert(keys);
+	assert(outindices);
 
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	helper::radixsortcopynoallocsingle<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	static std::size_t constexpr stride{helper::keyvaluecountslength<isabsvalue, issignmode, isfltpmode, U>};
+	if(2u > count){// nothing to sort
+		if(count){
+			outindices[0] = 0u;
+			if(outkeys) outkeys[0] = keys[0];
+		}
+		return{true};
+	}
+	if constexpr(sizeof(I) < sizeof(std::size_t)) if(static_cast<std::size_t>(static_cast<I>(-1)) < count - 1u)RSBD8_UNLIKELY return{false};
+	if(SIZE_MAX / (2u * sizeof(T) + sizeof(I) + alignof(I)) < count)RSBD8_UNLIKELY return{false};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+	unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-		pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
+	unsigned const parts{helper::keyvalueparts<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+		)};
+	// the buffer for the keys (and the array for the sorted keys if these are not needed) is followed by the buffer for the indices and the index counts of all the parts, each aligned for its type
+	std::size_t const indicesoffset{((1u + !outkeys) * count * sizeof(T) + alignof(I) - 1u) & ~(alignof(I) - 1u)};
+	std::size_t const countsoffset{(indicesoffset + count * sizeof(I) + alignof(std::size_t) - 1u) & ~(alignof(std::size_t) - 1u)};
+	std::size_t const countssize{parts * stride * sizeof(std::size_t)};
+	auto
+#if defined(_POSIX_C_SOURCE)
+		[allocated, allocsize]
+#else
+		allocated
+#endif
+		{allocatearray<isabsvalue, issignmode, isfltpmode, T, false>((countsoffset + countssize + sizeof(T) - 1u) / sizeof(T)
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+		, mmapflags
+#endif
+		)};
+	if(allocated.pbuffer)RSBD8_LIKELY{
+		std::byte *pbuffer{reinterpret_cast<std::byte *>(allocated.pbuffer)};
+		std::size_t *pcounts{reinterpret_cast<std::size_t *>(pbuffer + countsoffset)};
+		std::memset(pcounts, 0, countssize);
+		U *pbufferkeys{reinterpret_cast<U *>(pbuffer)};
+		helper::keyvaluesort<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U, I, true>(count, parts, pcounts,
+			reinterpret_cast<U const *>(keys), nullptr, outkeys? reinterpret_cast<U *>(outkeys) : pbufferkeys + count, outindices,
+			pbufferkeys, reinterpret_cast<I *>(pbuffer + indicesoffset));
+		deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+			, allocsize
+#endif
+			);
+		return{true};
+	}
+	return{false};
 }
 
-// wrapper for the single-part radixsortcopynoalloc() function with indirection with a dummy buffer argument
-template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	std::is_member_pointer_v<decltype(indirection1)> &&
-	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
-	void> radixsortcopynoalloc(std::size_t count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+// write the permutation that sorts an array of keys to an array of indices, the keys themselves are left unchanged
+// this works like the function above without the sorted keys, gather other columns in the order of the permutation with applypermutation() or gatherpermutation() afterwards
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T, typename I>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T) &&
+	std::is_unsigned_v<I> && !std::is_same_v<bool, I>,
+	bool> argsort(std::size_t count, T const *RSBD8_RESTRICT keys, I *RSBD8_RESTRICT outindices
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+		)noexcept{
+	return{argsortcopy<direction, mode, T, I>(count, keys, outindices, nullptr
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+		, mmapflags
+#endif
+		)};
+}
+
+// Permutation functions
+
+// reorder a column into the output array in the order of a permutation, as written by argsort(), so that output[i] = input[indices[i]]
+// the output is split into parts for the allowed threads, and the random reads of the input are prefetched ahead
+template<typename T, typename I>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	std::is_trivially_copyable_v<T> &&
+	std::is_unsigned_v<I> && !std::is_same_v<bool, I>,
+	void> gatherpermutation(std::size_t count, I const *RSBD8_RESTRICT indices, T const *RSBD8_RESTRICT input, T *RSBD8_RESTRICT output)noexcept{
 	assert(input != output);
-	assert(input != buffer);
-	assert(output != buffer);
 	// do not pass a nullptr here
+	assert(indices);
 	assert(input);
 	assert(output);
-	assert(buffer);
 
-	static_cast<void>(buffer);// the single-part version never needs an extra buffer
-	helper::radixsortcopynoallocsingle<indirection1, direction, mode, indirection2, isindexed2, V>(count,
+	if(!count) return;
+	unsigned const parts{helper::permutationparts(count
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+		, std::thread::hardware_concurrency()
 #endif
-		pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
+		)};
+	helper::permutationcolumn<T, I>(count, parts, indices, input, output, nullptr);
 }
 
-// wrapper for the single-part radixsortnoalloc() function with indirection
-template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<// disable the option for with the bool movetobuffer argument here, and do not allow active compile-time template evaluation with it
-	!std::is_same_v<bool, std::conditional_t<0u < sizeof...(vararguments),
-		std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>> &&
-	std::is_member_pointer_v<decltype(indirection1)> &&
-	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<
-		typename std::enable_if<!std::is_same_v<bool, std::conditional_t<0u < sizeof...(vararguments),
-			std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>>,
-			helper::memberpointerdeducebody<indirection1, isindexed2, false, V, vararguments...>>::type>>),
-	void> radixsortnoalloc(std::size_t count,
+// reorder any number of columns of different types in place in the order of a permutation, as written by argsort()
+// every column is gathered into a buffer that is sized for the widest column, and copied back afterwards
+// false is returned if the memory cannot be allocated, the columns are left unchanged then
+template<typename I, typename... columntypes>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_trivially_copyable_v<columntypes> && ...) &&
+	std::is_unsigned_v<I> && !std::is_same_v<bool, I>,
+	bool> applypermutation(std::size_t count, I const *RSBD8_RESTRICT indices, columntypes *... columns)noexcept{
+	// do not pass a nullptr here
+	assert(indices);
+	assert((columns && ...));
+
+	if(2u > count || !sizeof...(columns)) return{true};
+	static std::size_t constexpr widest{std::max({static_cast<std::size_t>(1u), sizeof(columntypes)...})};
+	if(SIZE_MAX / widest < count)RSBD8_UNLIKELY return{false};
+	// cache line alignment avoids false sharing between the parts at the start of the buffer
+	std::byte *pbuffer{new(std::align_val_t{std::hardware_constructive_interference_size}, std::nothrow) std::byte[count * widest]};
+	if(!pbuffer)RSBD8_UNLIKELY return{false};
+	unsigned const parts{helper::permutationparts(count
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+		, std::thread::hardware_concurrency()
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
-	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
-	assert(input != buffer);
+		)};
+	(helper::permutationcolumn<columntypes, I>(count, parts, indices, columns, reinterpret_cast<columntypes *>(pbuffer), columns), ...);
+	::operator delete[](pbuffer, std::align_val_t{std::hardware_constructive_interference_size});
+	return{true};
+}
+
+// Partial sorting functions
+
+// sort only the first k items of the sorting order to the front of the array, the other items follow these in an unspecified order
+// the most significant digits are used to discard the items that cannot be among the first k items, and only the retained items are sorted by radixsort() afterwards
+// the first k items are the same as those of radixsort() with the same template parameters, including the order of equal items
+// false is returned if the memory cannot be allocated, the order of the items is unspecified then
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixsortpartial(std::size_t count, std::size_t k, T *RSBD8_RESTRICT input
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+		)noexcept{
 	// do not pass a nullptr here
 	assert(input);
-	assert(buffer);
 
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	helper::radixsortnoallocsingle<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+	if(!k) return{true};// nothing to sort
+	std::size_t retained{count};
+	if(count > k) retained = helper::partialselect<isdescsort, isabsvalue, issignmode, isfltpmode, U>(count, k, reinterpret_cast<U *>(input));
+	return{radixsort<direction, mode, T>(retained, input
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+		, mmapflags
 #endif
-		pzeroedindices, input, buffer, std::forward<vararguments>(varparameters)...);
+		)};
 }
 
-// wrapper for the single-part radixsortnoalloc() and radixsortcopynoalloc() functions with indirection
-// this variant does not set the default "false" for the "movetobuffer" parameter
-template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	std::is_member_pointer_v<decltype(indirection1)> &&
-	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
-	void> radixsortnoalloc(std::size_t count,
+// Selection functions
+
+// find the items at the given ranks in the sorting order (like std::nth_element() for every rank), without sorting or modifying the input array
+// the ranks are zero-based, in any order, and less than the count, every output is the item that sorting the array with the same template parameters would put at its rank
+// this goes over the items once per digit, starting at the most significant one, and only counts the next digit for the candidates of every rank, as such all quantiles of an array are found in the same passes
+// the candidates are moved to a buffer as soon as they are at most half of the items, so for distinct keys usually only the first two passes go over the entire array
+// false is returned if the memory cannot be allocated, the outputs are left unchanged then
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixselect(std::size_t count, T const *input, std::size_t rankcount, std::size_t const *ranks, T *outputs)noexcept{
+	// do not pass a nullptr here
+	assert(input);
+	assert(ranks);
+	assert(outputs);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if(!rankcount) return{true};// nothing to select
+	return{helper::selectranks<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count, reinterpret_cast<U const *>(input), rankcount, ranks, reinterpret_cast<U *>(outputs), nullptr
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
+		, std::thread::hardware_concurrency()// when this is 0, assume single-threaded-only
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
-	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
-	assert(input != buffer);
+		)};
+}
+
+// find the item at a single rank in the sorting order, see above
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixselect(std::size_t count, T const *input, std::size_t rank, T &output)noexcept{
+	return{radixselect<direction, mode, T>(count, input, 1u, &rank, &output)};
+}
+
+// Histogram functions
+
+// the layout of the counts of radixhistogram() for a type: a histogram of 2 to the power of histogramradix<T> counts for each of the histogramdigits<T> digits, starting at the least significant digit
+template<typename T>
+unsigned constexpr histogramradix{helper::typeradix<T>};
+template<typename T>
+unsigned constexpr histogramdigits{helper::offsetsloopcount<T>};
+template<typename T>
+std::size_t constexpr histogramlength{static_cast<std::size_t>(histogramdigits<T>) << histogramradix<T>};
+
+// count the digits of all sorting passes of the items in a single pass over the array, without moving them, for pre-sizing or partitioning by the key distribution
+// the digits are those of the filtered keys of the sorting mode, in the order of the sorting direction, so the histogram of every digit starts with the first items in the sorting order
+// the counts array holds histogramlength<T> items and is overwritten, the unused counts at the top end of the histogram of the most significant digit are set to zero
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	void> radixhistogram(std::size_t count, T const *input, std::size_t *counts)noexcept{
 	// do not pass a nullptr here
 	assert(input);
-	assert(buffer);
+	assert(counts);
 
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	if(!movetobuffer){
-		helper::radixsortnoallocsingle<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	std::memset(counts, 0, histogramlength<T> * sizeof(std::size_t));
+	helper::histogramcountall<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count, reinterpret_cast<U const *>(input), counts
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-			allowedthreads, pfuturesplaceholder,
+		, std::thread::hardware_concurrency()// when this is 0, assume single-threaded-only
 #endif
-			pzeroedindices, input, buffer, std::forward<vararguments>(varparameters)...);
-	}else{
-		helper::radixsortcopynoallocsingle<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(count,
+		);
+}
+
+// find the exact boundaries between parts with the same number of items in the sorting order, from the counts of radixhistogram() with the same template parameters, without moving the items
+// boundary i is the item at rank count * (i + 1) / partcount in the sorting order, which is the first item of part i + 1, so partcount - 1 boundaries are written
+// the histogram of the most significant digit replaces the first pass of radixselect(), and the next digits are only counted for the candidates of every boundary
+// false is returned if the memory cannot be allocated, the boundaries are left unchanged then
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixboundaries(std::size_t count, T const *input, std::size_t const *counts, std::size_t partcount, T *boundaries)noexcept{
+	// do not pass a nullptr here
+	assert(input);
+	assert(counts);
+	assert(boundaries);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if(2u > partcount || !count) return{true};// no boundaries
+	std::size_t *ranks{new(std::nothrow) std::size_t[partcount - 1u]};
+	if(!ranks)RSBD8_UNLIKELY return{false};
+	std::size_t const quotient{count / partcount}, remainder{count % partcount};
+	for(std::size_t i{}; partcount - 1u > i; ++i) ranks[i] = quotient * (i + 1u) + remainder * (i + 1u) / partcount;// this avoids the overflow of count * (i + 1)
+	bool succeeded{helper::selectranks<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count, reinterpret_cast<U const *>(input), partcount - 1u, ranks, reinterpret_cast<U *>(boundaries), counts + (static_cast<std::size_t>(histogramdigits<T> - 1u) << histogramradix<T>)
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-			allowedthreads, pfuturesplaceholder,
+		, std::thread::hardware_concurrency()// when this is 0, assume single-threaded-only
 #endif
-			pzeroedindices, input, buffer, std::forward<vararguments>(varparameters)...);
-	}
+		)};
+	delete[] ranks;
+	return{succeeded};
 }
 
-// wrapper to implement the radixsort() function with indirection, which only allocates some memory prior to sorting arrays
-// this requires no specialisation for handling the single-part types
-template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+// Sorting functions with the removal of equal items
+
+// sort an array and keep only one of every set of equal items, the number of remaining items is written to uniquecount, and these are at the start of the output array
+// equal items are those that sort as equal, so this includes -0. and +0. with the floating-point modes, or a negative value and its positive counterpart with the regular absolute modes
+// the uniquekeep option selects which of the equal items in the sorting order is kept, so with the array direction of the sorting direction that is the first or the last one in the source
+// the equal items are dropped in the last sorting pass, in which these end up next to each other in every bucket, so no separate pass over the sorted items is needed for this
+// the output array can be the input array, which is what the in-place function below does
+// false is returned if the memory cannot be allocated, the output array and uniquecount are left unchanged then
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, uniquekeep keep = uniquekeep::first, typename T>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	std::is_member_pointer_v<decltype(indirection1)> &&
-	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
-	bool> radixsort(std::size_t count, V *RSBD8_RESTRICT *RSBD8_RESTRICT input
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixsortcopyunique(std::size_t count, T const *input, T *output, std::size_t &uniquecount
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
 		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
-		, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+		)noexcept{
 	// do not pass a nullptr here
 	assert(input);
+	assert(output);
 
-	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if(!count){// nothing to sort
+		uniquecount = 0u;
+		return{true};
+	}
+	if(SIZE_MAX / (sizeof(T) + sizeof(std::size_t)) < count)RSBD8_UNLIKELY return{false};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+	unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-		auto
+	// the buffer is followed by the index counts of all digits
+	std::size_t const countsoffset{(count * sizeof(T) + alignof(std::size_t) - 1u) & ~(alignof(std::size_t) - 1u)};
+	auto
 #if defined(_POSIX_C_SOURCE)
-			[allocated, allocsize]
+		[allocated, allocsize]
 #else
-			allocated
+		allocated
 #endif
-			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true>(count
+		{allocatearray<isabsvalue, issignmode, isfltpmode, T, false>((countsoffset + histogramlength<T> * sizeof(std::size_t) + sizeof(T) - 1u) / sizeof(T)
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-			, allowedthreads
+		, allowedthreads
 #endif
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-			, largepagesize
+		, largepagesize
 #elif defined(_POSIX_C_SOURCE)
-			, mmapflags
+		, mmapflags
+#endif
+		)};
+	if(allocated.pbuffer)RSBD8_LIKELY{
+		std::size_t *pcounts{reinterpret_cast<std::size_t *>(reinterpret_cast<std::byte *>(allocated.pbuffer) + countsoffset)};
+		std::memset(pcounts, 0, histogramlength<T> * sizeof(std::size_t));
+		// the counting is split over the allowed threads, the keys are not inverted here, as the sorting passes handle the sorting direction
+		helper::histogramcountall<false, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count, reinterpret_cast<U const *>(input), pcounts
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
 #endif
-			)};
-		if(allocated.pbuffer)RSBD8_LIKELY{
-			buffermemorywrapper guard{allocated.pbuffer
+			);
+		uniquecount = helper::uniquesort<isdescsort, isrevorder, uniquekeep::last == keep, isabsvalue, issignmode, isfltpmode, U>(count, pcounts,
+			reinterpret_cast<U const *>(input), reinterpret_cast<U *>(output), reinterpret_cast<U *>(allocated.pbuffer));
+		deallocatearray(allocated.pbuffer
 #if defined(_POSIX_C_SOURCE)
-				, allocsize
-#endif
-				};// ensure the buffer is deallocated, even if an exception is thrown by the getter function here
-			radixsortnoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-				allowedthreads, allocated.pfuturesplaceholder,
+			, allocsize
 #endif
-				allocated.pzeroedindices, input, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), false, std::forward<vararguments>(varparameters)...);
-			return{true};
-		}
-		return{false};
+			);
+		return{true};
 	}
-	return{true};// the array is already considered sorted if the count is 0 or 1
+	return{false};
+}
+
+// sort an array in place and keep only one of every set of equal items, like the function above
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, uniquekeep keep = uniquekeep::first, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixsortunique(std::size_t count, T *input, std::size_t &uniquecount
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, std::size_t largepagesize = 0u
+#elif defined(_POSIX_C_SOURCE)
+		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+#endif
+		)noexcept{
+	return{radixsortcopyunique<direction, mode, keep, T>(count, input, input, uniquecount
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+		, mmapflags
+#endif
+		)};
 }
 
-// wrapper to implement the multi-part radixsortcopy() function with indirection, which only allocates some memory prior to sorting arrays
-template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+// Grouping functions
+
+// sort an array of keys and write every distinct key once to the output keys array, together with the number of items with that key to the output counts array, the number of groups is written to groupcount
+// both output arrays need room for the count in the worst case, and the groups are in the sorting order, with the first of the equal items in the sorting order as the key of a group
+// the keys are sorted into a buffer by radixsortcopy(), after which the allowed threads count the groups in their slices of the buffer and then write them, which takes one pass over the sorted keys
+// false is returned if the memory cannot be allocated, the output arrays and groupcount are left unchanged then
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	std::is_member_pointer_v<decltype(indirection1)> &&
-	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>) &&
-	8u < CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
-	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixsortgroup(std::size_t count, T const *keys, T *outkeys, std::size_t *outcounts, std::size_t &groupcount
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
 		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
-		, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-	assert(input != output);
+		)noexcept{
 	// do not pass a nullptr here
-	assert(input);
-	assert(output);
+	assert(keys);
+	assert(outkeys);
+	assert(outcounts);
 
-	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if(!count){// nothing to group
+		groupcount = 0u;
+		return{true};
+	}
+	if(SIZE_MAX / sizeof(T) - 1u < count)RSBD8_UNLIKELY return{false};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+	unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-		auto
+	unsigned const parts{helper::keyvalueparts<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+		)};
+	// the buffer for the sorted keys is followed by the output positions of the parts
+	std::size_t const startsoffset{(count * sizeof(T) + alignof(std::size_t) - 1u) & ~(alignof(std::size_t) - 1u)};
+	auto
 #if defined(_POSIX_C_SOURCE)
-			[allocated, allocsize]
+		[allocated, allocsize]
 #else
-			allocated
+		allocated
 #endif
-			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true>(count
+		{allocatearray<isabsvalue, issignmode, isfltpmode, T, false>((startsoffset + parts * sizeof(std::size_t) + sizeof(T) - 1u) / sizeof(T)
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-			, allowedthreads
+		, allowedthreads
 #endif
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-			, largepagesize
+		, largepagesize
 #elif defined(_POSIX_C_SOURCE)
-			, mmapflags
+		, mmapflags
 #endif
-			)};
-		if(allocated.pbuffer)RSBD8_LIKELY{
-			buffermemorywrapper guard{allocated.pbuffer
-#if defined(_POSIX_C_SOURCE)
-				, allocsize
+		)};
+	if(!allocated.pbuffer)RSBD8_UNLIKELY return{false};
+	bool succeeded{radixsortcopy<direction, mode, T>(count, keys, allocated.pbuffer
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+		, mmapflags
 #endif
-				};// ensure the buffer is deallocated, even if an exception is thrown by the getter function here
-			radixsortcopynoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-				allowedthreads, allocated.pfuturesplaceholder,
+		)};
+	if(succeeded)RSBD8_LIKELY{
+		std::size_t *pstarts{reinterpret_cast<std::size_t *>(reinterpret_cast<std::byte *>(allocated.pbuffer) + startsoffset)};
+		groupcount = helper::groupsorted<groupaggregate::sum, false, isabsvalue, issignmode, isfltpmode, U, std::size_t, std::size_t>(count, parts, pstarts,
+			reinterpret_cast<U const *>(allocated.pbuffer), nullptr, reinterpret_cast<U *>(outkeys), outcounts, nullptr);
+	}
+	deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+		, allocsize
 #endif
-				allocated.pzeroedindices, input, output, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), std::forward<vararguments>(varparameters)...);
-			return{true};
-		}
-		return{false};
-	}else if(1u == count) *output = *input;// copy the single element if the count is 1
-	return{true};// the array is already considered sorted if the count is 0 or 1
+		);
+	return{succeeded};
 }
 
-// wrapper to implement the single-part radixsortcopy() function with indirection, which only allocates some memory prior to sorting arrays
-template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+// sort an array of keys together with a separate array of payloads, and write every distinct key once to the output keys array, together with the number of items and the aggregate of their payloads, the number of groups is written to groupcount
+// the groupaggregate option selects the sum, minimum or maximum, computed in the type of the output aggregates array, and the output counts array can be a nullptr if the numbers of items are not needed
+// the keys and payloads are sorted into buffers by radixsortcopy() with the payloads, after which the allowed threads group their slices of the buffers like above
+// a group that continues into the next slices is completed by the thread of the slice in which it starts, so the payloads of a group are always aggregated in the sorting order
+// false is returned if the memory cannot be allocated, the output arrays and groupcount are left unchanged then
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, groupaggregate aggregate = groupaggregate::sum, typename T, typename P, typename A>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	std::is_member_pointer_v<decltype(indirection1)> &&
-	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
-	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixsortgroup(std::size_t count, T const *keys, P const *payloads, T *outkeys, std::size_t *outcounts, A *outaggregates, std::size_t &groupcount
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
 		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
-		, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
-#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-	assert(!(largepagesize - 1u & largepagesize));// a maximum of one bit should be set in the value of largepagesize
-#endif
-	assert(input != output);
+		)noexcept{
+	static_assert(std::is_trivially_copyable_v<P>, "the payloads are copied as raw memory");
 	// do not pass a nullptr here
-	assert(input);
-	assert(output);
+	assert(keys);
+	assert(payloads);
+	assert(outkeys);
+	assert(outaggregates);
 
-	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	if(!count){// nothing to group
+		groupcount = 0u;
+		return{true};
+	}
+	if(SIZE_MAX / (sizeof(T) + sizeof(P) + alignof(P)) - 1u < count)RSBD8_UNLIKELY return{false};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+	unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-		// the single-part version never needs an extra buffer
-		auto
+	unsigned const parts{helper::keyvalueparts<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+		)};
+	// the buffer for the sorted keys is followed by the one for the sorted payloads and the output positions of the parts, each aligned for its type
+	std::size_t const payloadsoffset{(count * sizeof(T) + alignof(P) - 1u) & ~(alignof(P) - 1u)};
+	std::size_t const startsoffset{(payloadsoffset + count * sizeof(P) + alignof(std::size_t) - 1u) & ~(alignof(std::size_t) - 1u)};
+	auto
 #if defined(_POSIX_C_SOURCE)
-			[allocated, allocsize]
+		[allocated, allocsize]
 #else
-			allocated
+		allocated
 #endif
-			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true, false>(count
+		{allocatearray<isabsvalue, issignmode, isfltpmode, T, false>((startsoffset + parts * sizeof(std::size_t) + sizeof(T) - 1u) / sizeof(T)
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-			, allowedthreads
+		, allowedthreads
 #endif
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-			, largepagesize
+		, largepagesize
 #elif defined(_POSIX_C_SOURCE)
-			, mmapflags
+		, mmapflags
 #endif
-			)};
-		if(allocated.pbuffer)RSBD8_LIKELY{
-			buffermemorywrapper guard{allocated.pbuffer
-#if defined(_POSIX_C_SOURCE)
-				, allocsize
+		)};
+	if(!allocated.pbuffer)RSBD8_UNLIKELY return{false};
+	std::byte *pbuffer{reinterpret_cast<std::byte *>(allocated.pbuffer)};
+	P *pbufferpayloads{reinterpret_cast<P *>(pbuffer + payloadsoffset)};
+	bool succeeded{radixsortcopy<direction, mode, T, P>(count, keys, payloads, allocated.pbuffer, pbufferpayloads
+#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
+		, largepagesize
+#elif defined(_POSIX_C_SOURCE)
+		, mmapflags
 #endif
-				};// ensure the buffer is deallocated, even if an exception is thrown by the getter function here
-			radixsortcopynoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-				allowedthreads, allocated.pfuturesplaceholder,
+		)};
+	if(succeeded)RSBD8_LIKELY{
+		std::size_t *pstarts{reinterpret_cast<std::size_t *>(pbuffer + startsoffset)};
+		groupcount = helper::groupsorted<aggregate, true, isabsvalue, issignmode, isfltpmode, U, P, A>(count, parts, pstarts,
+			reinterpret_cast<U const *>(allocated.pbuffer), pbufferpayloads, reinterpret_cast<U *>(outkeys), outcounts, outaggregates);
+	}
+	deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+		, allocsize
 #endif
-				allocated.pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
-			return{true};
-		}
-		return{false};
-	}else if(1u == count) *output = *input;// copy the single element if the count is 1
-	return{true};// the array is already considered sorted if the count is 0 or 1
+		);
+	return{succeeded};
 }
 
-// wrapper for the multi-part radixsortcopynoalloc() function with type and offset pointer indirection
-template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>) &&
-	8u < CHAR_BIT * sizeof(std::remove_pointer_t<T>),
-	void> radixsortcopynoalloc(std::size_t count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
-#endif
-		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
-	static_assert(!std::is_pointer_v<std::remove_pointer_t<T>>, "third level indirection is not supported");
-	assert(input != output);
-	assert(input != buffer);
-	assert(output != buffer);
+// String sorting functions
+
+// sort an array of strings of any length by their bytes as unsigned values, with a shorter string before the longer strings that start with it, like std::string_view::compare() orders these
+// byte strings of a pointer and a length are sorted as std::string_view items with the same pointer and length, the string data itself is never moved or modified
+// this is a most significant digit first radix sort of one byte per sorting pass, with the next 8 bytes of every string cached next to it to avoid reading the string data in every pass, and insertion sort for small buckets
+// the sort is stable, and the sorting direction reverses the order of equal strings like it does with indirection
+// false is returned if the memory cannot be allocated, the array is left unchanged then
+template<sortingdirection direction = sortingdirection::ascfwdorder>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE bool radixsortstrings(std::size_t count, std::string_view *input)noexcept{
 	// do not pass a nullptr here
 	assert(input);
-	assert(output);
-	assert(buffer);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, std::remove_pointer_t<T>>};
-	static bool constexpr issignmode{helper::issignmode<mode, std::remove_pointer_t<T>>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, std::remove_pointer_t<T>>};
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
 	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	using W = helper::tounifunsigned<std::remove_pointer_t<T>, isabsvalue, issignmode, isfltpmode>;
-	using U = std::conditional_t<std::is_const_v<V> && std::is_volatile_v<V>, const volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		std::conditional_t<std::is_const_v<V>, const memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		std::conditional_t<std::is_volatile_v<V>, volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>>>>;
-	helper::radixsortcopynoallocmulti<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
+	if(2u > count) return{true};// nothing to sort
+	if(SIZE_MAX / (sizeof(std::string_view) + 2u * sizeof(std::uint_least64_t)) < count)RSBD8_UNLIKELY return{false};
+	// the buffer for the strings is followed by the one for the prefixes and the buffer for the prefixes
+	std::byte *pallocated{new(std::align_val_t{std::hardware_constructive_interference_size}, std::nothrow) std::byte[count * (sizeof(std::string_view) + 2u * sizeof(std::uint_least64_t))]};
+	if(!pallocated)RSBD8_UNLIKELY return{false};
+	std::string_view *buffer{reinterpret_cast<std::string_view *>(pallocated)};
+	std::uint_least64_t *prefixes{reinterpret_cast<std::uint_least64_t *>(pallocated + count * sizeof(std::string_view))};
+	if constexpr(isrevorder) std::reverse(input, input + count);// the stable sort then reverses the order of equal strings
+	for(std::size_t i{}; count > i; ++i) prefixes[i] = helper::stringprefix(input[i], 0u);
+	helper::stringsortbucket<isdescsort>(count, 0u, input, prefixes, buffer, prefixes + count
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+		, std::thread::hardware_concurrency()// when this is 0, assume single-threaded-only
 #endif
-		pzeroedindices, reinterpret_cast<U *const RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(output), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+		);
+	::operator delete[](pallocated, std::align_val_t{std::hardware_constructive_interference_size});
+	return{true};
 }
 
-// wrapper for the multi-part radixsortnoalloc() function with type and offset pointer indirection
-template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>) &&
-	8u < CHAR_BIT * sizeof(std::remove_pointer_t<T>),
-	void> radixsortnoalloc(std::size_t count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
-#endif
-		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer = false, vararguments&&... varparameters)noexcept{
-	static_assert(!std::is_pointer_v<std::remove_pointer_t<T>>, "third level indirection is not supported");
-	assert(input != buffer);
+// Wide key sorting functions
+
+// sort an array of keys wider than 128 bits, such as 256-bit hashes or composite keys, in least significant digit order with one byte per sorting pass
+// the rsbd8::widekeyorder template parameter selects whether the bytes of the keys are ordered like std::memcmp() orders these (default), or as little-endian multi-word unsigned integers of 64-bit words
+// a sorting pass is skipped if all keys have the same byte in it, and the allowed threads each count and scatter their own slice of the array in every sorting pass
+// the entire key is the item here, so the order of equal items cannot be observed, and only the ascending or descending part of the sorting direction is used
+// false is returned if the memory cannot be allocated, the array is left unchanged then
+template<sortingdirection direction = sortingdirection::ascfwdorder, widekeyorder order = widekeyorder::bytes, typename T>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_class_v<T> || std::is_union_v<T>) &&
+	std::is_trivially_copyable_v<T> &&
+	128u < CHAR_BIT * sizeof(T),
+	bool> radixsortwide(std::size_t count, T *input)noexcept{
+	static_assert(widekeyorder::bytes == order || !(sizeof(T) % sizeof(std::uint_least64_t)), "the words order requires keys of whole 64-bit words");
 	// do not pass a nullptr here
 	assert(input);
-	assert(buffer);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, std::remove_pointer_t<T>>};
-	static bool constexpr issignmode{helper::issignmode<mode, std::remove_pointer_t<T>>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, std::remove_pointer_t<T>>};
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	using W = helper::tounifunsigned<std::remove_pointer_t<T>, isabsvalue, issignmode, isfltpmode>;
-	using U = std::conditional_t<std::is_const_v<V> && std::is_volatile_v<V>, const volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		std::conditional_t<std::is_const_v<V>, const memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		std::conditional_t<std::is_volatile_v<V>, volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>>>>;
-	helper::radixsortnoallocmulti<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
+	if(2u > count) return{true};// nothing to sort
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
-#endif
-		pzeroedindices, reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), movetobuffer, std::forward<vararguments>(varparameters)...);
+	unsigned const parts{helper::wideparts(count, std::thread::hardware_concurrency())};// when this is 0, assume single-threaded-only
+#else
+	unsigned const parts{1u};
+#endif
+	std::size_t const countssize{parts * helper::widecountslength<T> * sizeof(std::size_t)};
+	if((SIZE_MAX - countssize) / sizeof(T) < count)RSBD8_UNLIKELY return{false};
+	// the counts are followed by the buffer
+	std::byte *pallocated{new(std::align_val_t{std::hardware_constructive_interference_size}, std::nothrow) std::byte[countssize + count * sizeof(T)]};
+	if(!pallocated)RSBD8_UNLIKELY return{false};
+	std::memset(pallocated, 0, countssize);
+	helper::widesort<isdescsort, false, order, T>(count, parts, reinterpret_cast<std::size_t *>(pallocated), input, reinterpret_cast<T *>(pallocated + countssize), [](T const &item)noexcept->T const &{
+		return{item};
+	});
+	::operator delete[](pallocated, std::align_val_t{std::hardware_constructive_interference_size});
+	return{true};
 }
 
-// wrapper for the single-part radixsortcopynoalloc() function with type and offset pointer indirection
-template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<// disable the option for with the V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer argument here, and do not allow active compile-time template evaluation with it
-	!std::is_same_v<V *RSBD8_RESTRICT *RSBD8_RESTRICT, std::conditional_t<0u < sizeof...(vararguments),
-		std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>> &&
-	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<
-		typename std::enable_if<!std::is_same_v<V *RSBD8_RESTRICT *RSBD8_RESTRICT, std::conditional_t<0u < sizeof...(vararguments),
-			std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>>,
-			helper::memberpointerdeducebody<indirection1, isindexed2, false, V, vararguments...>>::type>>),
-	void> radixsortcopynoalloc(std::size_t count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
-#endif
-		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, vararguments&&... varparameters)noexcept{
-	static_assert(!std::is_pointer_v<std::remove_pointer_t<T>>, "third level indirection is not supported");
-	assert(input != output);
+// sort an array of pointers to items with keys wider than 128 bits, using the same indirection template parameters and optional parameters as the radixsort() function with indirection
+// the key has to be a class or union type, so wrap an array of bytes in a std::array or a struct, and only getter functions that cannot throw are supported
+// the sort is stable, and the sorting direction reverses the order of equal keys like it does with indirection
+// false is returned if the memory cannot be allocated, the array is left unchanged then
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, widekeyorder order = widekeyorder::bytes, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...> &&
+	128u < CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	bool> radixsortwide(std::size_t count, V **input, vararguments&&... varparameters)noexcept{
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
+	static_assert((std::is_class_v<T> || std::is_union_v<T>) && std::is_trivially_copyable_v<T>, "the key has to be a trivially copyable class or union type");
+	static_assert(widekeyorder::bytes == order || !(sizeof(T) % sizeof(std::uint_least64_t)), "the words order requires keys of whole 64-bit words");
 	// do not pass a nullptr here
 	assert(input);
-	assert(output);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, std::remove_pointer_t<T>>};
-	static bool constexpr issignmode{helper::issignmode<mode, std::remove_pointer_t<T>>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, std::remove_pointer_t<T>>};
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
 	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	using W = helper::tounifunsigned<std::remove_pointer_t<T>, isabsvalue, issignmode, isfltpmode>;
-	using U = std::conditional_t<std::is_const_v<V> && std::is_volatile_v<V>, const volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		std::conditional_t<std::is_const_v<V>, const memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		std::conditional_t<std::is_volatile_v<V>, volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>>>>;
-	helper::radixsortcopynoallocsingle<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
+	if(2u > count) return{true};// nothing to sort
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
-#endif
-		pzeroedindices, reinterpret_cast<U *const RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(output), std::forward<vararguments>(varparameters)...);
+	unsigned const parts{helper::wideparts(count, std::thread::hardware_concurrency())};// when this is 0, assume single-threaded-only
+#else
+	unsigned const parts{1u};
+#endif
+	std::size_t const countssize{parts * helper::widecountslength<T> * sizeof(std::size_t)};
+	if((SIZE_MAX - countssize) / sizeof(V *) < count)RSBD8_UNLIKELY return{false};
+	// the counts are followed by the buffer
+	std::byte *pallocated{new(std::align_val_t{std::hardware_constructive_interference_size}, std::nothrow) std::byte[countssize + count * sizeof(V *)]};
+	if(!pallocated)RSBD8_UNLIKELY return{false};
+	std::memset(pallocated, 0, countssize);
+	helper::widesort<isdescsort, isrevorder, order, T>(count, parts, reinterpret_cast<std::size_t *>(pallocated), input, reinterpret_cast<V **>(pallocated + countssize), [&](V *const &item)noexcept->T{
+		return{helper::indirectinput2<indirection1, indirection2, isindexed2, false, T>(helper::indirectinput1<indirection1, isindexed2, false, T, V>(item, std::forward<vararguments>(varparameters)...), std::forward<vararguments>(varparameters)...)};
+	});
+	::operator delete[](pallocated, std::align_val_t{std::hardware_constructive_interference_size});
+	return{true};
 }
 
-// wrapper for the single-part radixsortcopynoalloc() function with type and offset pointer indirection with a dummy buffer argument
-template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<
-	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>),
-	void> radixsortcopynoalloc(std::size_t count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
-#endif
-		void *RSBD8_RESTRICT pzeroedindices, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
-	assert(input != output);
-	assert(input != buffer);
-	assert(output != buffer);
+// Multi-key sorting functions
+
+// a key for rsbd8::radixsortmultikey(), a member object pointer or a getter function without parameters of the items, with its own sorting direction and sorting mode
+template<auto indirection, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native>
+struct sortkey{
+	static_assert(std::is_member_pointer_v<decltype(indirection)>, "a key is either a member object pointer or a getter function");
+
+	// the type of the key of an item of type V
+	template<typename V>
+	using type = std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<decltype(indirection), V *>>>;
+
+	// only arithmetic and enumeration types of up to 64 bits, with a getter function that cannot throw
+	template<typename V>
+	static bool constexpr isvalid{(std::is_arithmetic_v<type<V>> || std::is_enum_v<type<V>>) &&
+		64u >= CHAR_BIT * sizeof(type<V>) &&
+		std::is_nothrow_invocable_v<decltype(indirection), V *>};// always true for member object pointers
+
+	// write the filtered key of an item to its place in the combined key
+	template<typename V>
+	RSBD8_FUNC_INLINE static void write(V *p, unsigned char *RSBD8_RESTRICT out)noexcept{
+		using T = type<V>;
+		if constexpr(std::is_member_object_pointer_v<decltype(indirection)>){
+			helper::multikeywrite<helper::isdescsort<direction>, helper::isabsvalue<mode, T>, helper::issignmode<mode, T>, helper::isfltpmode<mode, T>, T>(p->*indirection, out);
+		}else{
+			helper::multikeywrite<helper::isdescsort<direction>, helper::isabsvalue<mode, T>, helper::issignmode<mode, T>, helper::isfltpmode<mode, T>, T>((p->*indirection)(), out);
+		}
+	}
+};
+
+// sort an array of pointers to items by several keys at once, like "ORDER BY a, b DESC, c" does, with a rsbd8::sortkey template parameter for every key, the first key is the most significant one
+// the filtered keys of every item are written once to a single combined key, which is then sorted like rsbd8::radixsortwide() does, so a sorting pass is skipped if all items have the same byte in it, in any of the keys
+// the sort is stable, only the ascending or descending part of the sorting direction of every key is used, and items of which all keys are equal keep their order
+// false is returned if the memory cannot be allocated, the array is left unchanged then
+template<typename... keys, typename V>
+RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
+	0u < sizeof...(keys) &&
+	(keys::template isvalid<V> && ...),
+	bool> radixsortmultikey(std::size_t count, V **input)noexcept{
 	// do not pass a nullptr here
 	assert(input);
-	assert(output);
-	assert(buffer);
 
-	static_cast<void>(buffer);// the single-part version never needs an extra buffer
-	helper::radixsortcopynoallocsingle<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
+	static std::size_t constexpr size{(sizeof(typename keys::template type<V>) + ...)};
+	using K = helper::multikeybytes<size>;
+	using W = helper::multikeyitem<size, V>;
+	if(2u > count) return{true};// nothing to sort
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
-#endif
-		pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
+	unsigned const parts{helper::wideparts(count, std::thread::hardware_concurrency())};// when this is 0, assume single-threaded-only
+#else
+	unsigned const parts{1u};
+#endif
+	std::size_t const countssize{parts * helper::widecountslength<K> * sizeof(std::size_t)};
+	if((SIZE_MAX - countssize) / (2u * sizeof(W)) < count)RSBD8_UNLIKELY return{false};
+	// the counts are followed by the items and the buffer
+	std::byte *pallocated{new(std::align_val_t{std::hardware_constructive_interference_size}, std::nothrow) std::byte[countssize + 2u * count * sizeof(W)]};
+	if(!pallocated)RSBD8_UNLIKELY return{false};
+	std::memset(pallocated, 0, countssize);
+	W *items{reinterpret_cast<W *>(pallocated + countssize)};
+	// combine the keys of every item once, with the same slices as the sorting passes
+	std::size_t const quotient{count / parts}, remainder{count % parts};
+	helper::keyvalueforparts(0u, parts, [&](unsigned part)noexcept{
+		std::size_t const first{quotient * part + std::min(static_cast<std::size_t>(part), remainder)};
+		std::size_t const last{first + quotient + (part < remainder)};
+		for(std::size_t i{first}; last > i; ++i){
+			V *p{input[i]};
+			items[i].pointer = p;
+			unsigned char *pkey{items[i].key.bytes};
+			((keys::template write<V>(p, pkey), pkey += sizeof(typename keys::template type<V>)), ...);
+		}
+	});
+	helper::widesort<false, false, widekeyorder::bytes, K>(count, parts, reinterpret_cast<std::size_t *>(pallocated), items, items + count, [](W const &item)noexcept->K const &{
+		return{item.key};
+	});
+	for(std::size_t i{}; count > i; ++i) input[i] = items[i].pointer;
+	::operator delete[](pallocated, std::align_val_t{std::hardware_constructive_interference_size});
+	return{true};
 }
 
-// wrapper for the single-part radixsortnoalloc() function with type and offset pointer indirection
-template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_FUNC_INLINE std::enable_if_t<// disable the option for with the bool movetobuffer argument here, and do not allow active compile-time template evaluation with it
-	!std::is_same_v<bool, std::conditional_t<0u < sizeof...(vararguments),
-		std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>> &&
-	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<
-		typename std::enable_if<!std::is_same_v<bool, std::conditional_t<0u < sizeof...(vararguments),
-			std::invoke_result_t<decltype(helper::splitparameter<false, vararguments...>), vararguments...>, void>>,
-			helper::memberpointerdeducebody<indirection1, isindexed2, false, V, vararguments...>>::type>>),
-	void> radixsortnoalloc(std::size_t count,
+// Incremental merging functions
+
+// sort a batch of new items that directly follows an array of items that is already sorted with the same template parameters, and merge both into the buffer without indirection
+// the merged items are copied back to the input array afterwards, unless movetobuffer is set, in which case the input and buffer arrays can simply swap roles for the next batch
+// equal items are ordered as if all items were sorted at once, so sorted items go before equal items of the batch, unless the sorting direction reverses the order of equal items
+// the buffer has room for all items, and the memory for the indices and futures is sized for the batch count like it is for radixsortnoalloc()
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
+RSBD8_FUNC_INLINE std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T),
+	void> radixsortmergenoalloc(std::size_t sortedcount, std::size_t batchcount,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, vararguments&&... varparameters)noexcept{
-	static_assert(!std::is_pointer_v<std::remove_pointer_t<T>>, "third level indirection is not supported");
+		void *RSBD8_RESTRICT pzeroedindices, T *RSBD8_RESTRICT input, T *RSBD8_RESTRICT buffer, bool movetobuffer = false)noexcept{
 	assert(input != buffer);
 	// do not pass a nullptr here
 	assert(input);
 	assert(buffer);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, std::remove_pointer_t<T>>};
-	static bool constexpr issignmode{helper::issignmode<mode, std::remove_pointer_t<T>>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, std::remove_pointer_t<T>>};
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
-	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	using W = helper::tounifunsigned<std::remove_pointer_t<T>, isabsvalue, issignmode, isfltpmode>;
-	using U = std::conditional_t<std::is_const_v<V> && std::is_volatile_v<V>, const volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		std::conditional_t<std::is_const_v<V>, const memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		std::conditional_t<std::is_volatile_v<V>, volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>>>>;
-	helper::radixsortnoallocsingle<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	std::size_t const count{sortedcount + batchcount};
+	if(1u < batchcount){
+		if constexpr(8u >= CHAR_BIT * sizeof(T) &&// skip the buffer for these single-part types
+			!(isabsvalue && issignmode) &&// both regular absolute modes
+			!(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
+			radixsortnoalloc<direction, mode, T>(batchcount,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+			allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+			pzeroedindices, input + sortedcount);
+		else radixsortnoalloc<direction, mode, T>(batchcount,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			allowedthreads, pfuturesplaceholder,
+#endif
+			pzeroedindices, input + sortedcount, buffer);
+	}
+	if(!sortedcount || !batchcount){// nothing to merge
+		if(movetobuffer) std::memcpy(buffer, input, count * sizeof(T));
+		return;
+	}
+	helper::mergebatch<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(sortedcount, count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+		allowedthreads,
+#endif
+		reinterpret_cast<U const *RSBD8_RESTRICT>(input), reinterpret_cast<U *RSBD8_RESTRICT>(buffer));
+	if(!movetobuffer) std::memcpy(input, buffer, count * sizeof(T));
 }
 
-// wrapper for the single-part radixsortnoalloc() and radixsortcopynoalloc() functions with with type and offset pointer indirection
-// this variant does not set the default "false" for the "movetobuffer" parameter
-template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+// sort a batch of new items that directly follows an array of items that is already sorted with the same template parameters, and merge both with indirection
+// this works like the function above, but the movetobuffer argument has no default here, as it is followed by the optional parameters of the getter function
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_FUNC_INLINE std::enable_if_t<
-	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>),
-	void> radixsortnoalloc(std::size_t count,
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	void> radixsortmergenoalloc(std::size_t sortedcount, std::size_t batchcount,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		unsigned allowedthreads, void *RSBD8_RESTRICT pfuturesplaceholder,
 #endif
-		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer, vararguments&&... varparameters)noexcept{
-	static_assert(!std::is_pointer_v<std::remove_pointer_t<T>>, "third level indirection is not supported");
+		void *RSBD8_RESTRICT pzeroedindices, V *RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT buffer, bool movetobuffer, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
+	static_assert(!std::is_pointer_v<T>, "third level indirection is not supported");
 	assert(input != buffer);
 	// do not pass a nullptr here
 	assert(input);
 	assert(buffer);
 
-	static bool constexpr isabsvalue{helper::isabsvalue<mode, std::remove_pointer_t<T>>};
-	static bool constexpr issignmode{helper::issignmode<mode, std::remove_pointer_t<T>>};
-	static bool constexpr isfltpmode{helper::isfltpmode<mode, std::remove_pointer_t<T>>};
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
 	static bool constexpr isdescsort{helper::isdescsort<direction>};
 	static bool constexpr isrevorder{helper::isrevorderwithindirection<direction>};
-	using W = helper::tounifunsigned<std::remove_pointer_t<T>, isabsvalue, issignmode, isfltpmode>;
-	using U = std::conditional_t<std::is_const_v<V> && std::is_volatile_v<V>, const volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		std::conditional_t<std::is_const_v<V>, const memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		std::conditional_t<std::is_volatile_v<V>, volatile memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>,
-		memberobjectgenerator<std::conditional_t<std::is_pointer_v<T>, W const *RSBD8_RESTRICT, W>, indirection1>>>>;
-	if(!movetobuffer) helper::radixsortnoallocsingle<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
+	std::size_t const count{sortedcount + batchcount};
+	if(1u < batchcount) radixsortnoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(batchcount,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 		allowedthreads, pfuturesplaceholder,
 #endif
-		pzeroedindices, reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
-	else helper::radixsortcopynoallocsingle<&U::object, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, U>(count,
-#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		allowedthreads, pfuturesplaceholder,
+		pzeroedindices, input + sortedcount, buffer, false, std::forward<vararguments>(varparameters)...);
+	if(!sortedcount || !batchcount){// nothing to merge
+		if(movetobuffer) std::memcpy(buffer, input, count * sizeof(V *));
+		return;
+	}
+	helper::mergebatch<indirection1, isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, indirection2, isindexed2, V>(sortedcount, count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 8 <= (RSBD8_THREAD_MAXIMUM)
+		allowedthreads,
 #endif
-		pzeroedindices, reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(input), reinterpret_cast <U *RSBD8_RESTRICT *RSBD8_RESTRICT>(buffer), std::forward<vararguments>(varparameters)...);
+		input, buffer, std::forward<vararguments>(varparameters)...);
+	if(!movetobuffer) std::memcpy(input, buffer, count * sizeof(V *));
 }
 
-// wrapper to implement the radixsort() function with with type and offset pointer indirection, which only allocates some memory prior to sorting arrays with indirection
-// this requires no specialisation for handling the single-part types
-template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+// wrapper to implement the radixsortmerge() function without indirection, which only allocates some memory prior to sorting the batch and merging
+template<sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, typename T>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>),
-	bool> radixsort(std::size_t count, V *RSBD8_RESTRICT *RSBD8_RESTRICT input
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	128u >= CHAR_BIT * sizeof(T),
+	bool> radixsortmerge(std::size_t sortedcount, std::size_t batchcount, T *RSBD8_RESTRICT input
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
 		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
-		, vararguments&&... varparameters)noexcept{
+		)noexcept{
 	// do not pass a nullptr here
 	assert(input);
 
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+	if(!batchcount) return{true};// nothing to add
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+	unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-		auto
+	auto
 #if defined(_POSIX_C_SOURCE)
-			[allocated, allocsize]
+		[allocated, allocsize]
 #else
-			allocated
+		allocated
 #endif
-			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true>(count
+		{allocatearray<isabsvalue, issignmode, isfltpmode, T, false>(sortedcount + batchcount
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-			, allowedthreads
+		, allowedthreads
 #endif
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-			, largepagesize
+		, largepagesize
 #elif defined(_POSIX_C_SOURCE)
-			, mmapflags
+		, mmapflags
 #endif
-			)};
-		if(allocated.pbuffer)RSBD8_LIKELY{
-			radixsortnoalloc<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
+		)};
+	if(allocated.pbuffer)RSBD8_LIKELY{
+		radixsortmergenoalloc<direction, mode, T>(sortedcount, batchcount,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-				allowedthreads, allocated.pfuturesplaceholder,
+			allowedthreads, allocated.pfuturesplaceholder,
 #endif
-				allocated.pzeroedindices, input, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), false, std::forward<vararguments>(varparameters)...);
-			deallocatearray(allocated.pbuffer
+			allocated.pzeroedindices, input, allocated.pbuffer);
+		deallocatearray(allocated.pbuffer
 #if defined(_POSIX_C_SOURCE)
-				, allocsize
+			, allocsize
 #endif
-				);
-			return{true};
-		}
-		return{false};
+			);
+		return{true};
 	}
-	return{true};// the array is already considered sorted if the count is 0 or 1
+	return{false};
 }
 
-// wrapper to implement the multi-part radixsortcopy() function with with type and offset pointer indirection, which only allocates some memory prior to sorting arrays with indirection
-template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
+// wrapper to implement the radixsortmerge() function with indirection, which only allocates some memory prior to sorting the batch and merging
+template<auto indirection1, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
 RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>) &&
-	8u < CHAR_BIT * sizeof(std::remove_pointer_t<T>),
-	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output
+	std::is_member_pointer_v<decltype(indirection1)> &&
+	128u >= CHAR_BIT * sizeof(std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>),
+	bool> radixsortmerge(std::size_t sortedcount, std::size_t batchcount, V *RSBD8_RESTRICT *RSBD8_RESTRICT input
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
 		, std::size_t largepagesize = 0u
 #elif defined(_POSIX_C_SOURCE)
 		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
 #endif
-		, vararguments&&... varparameters)noexcept{
-	assert(input != output);
+		, vararguments&&... varparameters)noexcept(std::is_nothrow_invocable_v<decltype(helper::splitget<indirection1, isindexed2, false, V, vararguments...>), V *RSBD8_RESTRICT, vararguments...>){
 	// do not pass a nullptr here
 	assert(input);
-	assert(output);
 
+	using T = std::remove_pointer_t<std::decay_t<helper::memberpointerdeduce<indirection1, isindexed2, false, V, vararguments...>>>;
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+	if(!batchcount) return{true};// nothing to add
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+	unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-		auto
+	auto
 #if defined(_POSIX_C_SOURCE)
-			[allocated, allocsize]
+		[allocated, allocsize]
 #else
-			allocated
+		allocated
 #endif
-			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true>(count
+		{allocatearray<isabsvalue, issignmode, isfltpmode, T, true>(sortedcount + batchcount
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-			, allowedthreads
+		, allowedthreads
 #endif
 #ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-			, largepagesize
+		, largepagesize
 #elif defined(_POSIX_C_SOURCE)
-			, mmapflags
+		, mmapflags
 #endif
-			)};
-		if(allocated.pbuffer)RSBD8_LIKELY{
-			radixsortcopynoalloc<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
+		)};
+	if(allocated.pbuffer)RSBD8_LIKELY{
+		buffermemorywrapper guard{allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+			, allocsize
+#endif
+			};// ensure the buffer is deallocated, even if an exception is thrown by the getter function here
+		radixsortmergenoalloc<indirection1, direction, mode, indirection2, isindexed2, V>(sortedcount, batchcount,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-				allowedthreads, allocated.pfuturesplaceholder,
+			allowedthreads, allocated.pfuturesplaceholder,
 #endif
-				allocated.pzeroedindices, input, output, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), std::forward<vararguments>(varparameters)...);
+			allocated.pzeroedindices, input, reinterpret_cast<V *RSBD8_RESTRICT *RSBD8_RESTRICT>(reinterpret_cast<std::intptr_t>(allocated.pbuffer)), false, std::forward<vararguments>(varparameters)...);
+		return{true};
+	}
+	return{false};
+}
+
+// Streaming sort builder functions
+
+// this class collects items for sorting in chunks as they arrive, and it counts the digits of every chunk right away
+// when finalise() is called the counting pass over the data is already done, so only the offsets and the sorting passes remain
+// the memory grows as needed while appending, but reserving the expected total count beforehand avoids copying the items when it grows
+// a builder can only be used by one thread at a time, and the sorting passes run in the thread that calls finalise()
+template<typename T, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native>
+class sortbuilder{
+	static_assert((std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_class_v<T> || std::is_union_v<T>) && 64u >= CHAR_BIT * sizeof(T), "unsupported type for the streaming sort builder");
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	static bool constexpr iscounted{helper::issortbuildercounted<U>};
+	static std::size_t constexpr countslength{helper::offsetslength<isabsvalue, issignmode, isfltpmode, U>};
+
+	combinedallocation<T> allocated{};// the items, followed by a buffer of the same size
+#if defined(_POSIX_C_SOURCE)
+	std::size_t allocsize{};
+#endif
+	std::size_t *RSBD8_RESTRICT pcounts{};// the index counts of all digits, only used for the types that are counted while appending
+	std::size_t itemcount{};
+	std::size_t itemcapacity{};
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	unsigned allowedthreads{};// the number of threads that the memory is allocated for
+#endif
+	bool isfinalised{};
+
+public:
+	// disable copy and move mechanisms
+	sortbuilder(sortbuilder const &) = delete;
+	sortbuilder &operator=(sortbuilder const &) = delete;
+	RSBD8_FUNC_INLINE sortbuilder()noexcept = default;
+	RSBD8_FUNC_INLINE ~sortbuilder()noexcept{
+		release();
+	}
+
+	// hand the memory back to the system, this also discards all items
+	RSBD8_FUNC_INLINE void release()noexcept{
+		if(allocated.pbuffer){
 			deallocatearray(allocated.pbuffer
 #if defined(_POSIX_C_SOURCE)
 				, allocsize
 #endif
 				);
-			return{true};
+			allocated = {};
 		}
-		return{false};
-	}else if(1u == count) *output = *input;// copy the single element if the count is 1
-	return{true};// the array is already considered sorted if the count is 0 or 1
-}
+		delete[] pcounts;
+		pcounts = nullptr, itemcount = 0u, itemcapacity = 0u, isfinalised = false;
+	}
 
-// wrapper to implement the single-part radixsortcopy() function with with type and offset pointer indirection, which only allocates some memory prior to sorting arrays with indirection
-template<typename T, std::ptrdiff_t indirection1 = 0, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native, std::ptrdiff_t indirection2 = 0, bool isindexed2 = false, typename V, typename... vararguments>
-RSBD8_NODISCARD RSBD8_FUNC_INLINE std::enable_if_t<
-	8u >= CHAR_BIT * sizeof(std::remove_pointer_t<T>),
-	bool> radixsortcopy(std::size_t count, V *const RSBD8_RESTRICT *RSBD8_RESTRICT input, V *RSBD8_RESTRICT *RSBD8_RESTRICT output
-#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-		, std::size_t largepagesize = 0u
-#elif defined(_POSIX_C_SOURCE)
-		, int mmapflags = MAP_ANONYMOUS | MAP_PRIVATE
+	// discard all items, but keep the memory for re-use
+	RSBD8_FUNC_INLINE void clear()noexcept{
+		if(pcounts) std::memset(pcounts, 0, countslength * sizeof(std::size_t));
+		itemcount = 0u, isfinalised = false;
+	}
+
+	// the number of items appended so far
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE std::size_t size()const noexcept{
+		return{itemcount};
+	}
+
+	// the number of items that fit in the memory currently held
+	RSBD8_NODISCARD RSBD8_FUNC_INLINE std::size_t capacity()const noexcept{
+		return{itemcapacity};
+	}
+
+	// make room for at least the given total number of items, the items appended so far are kept
+	// false is returned if the memory cannot be allocated, the builder is left unchanged then
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL bool reserve(std::size_t count)noexcept{
+		assert(!isfinalised);// call clear() first
+		if(itemcapacity >= count) return{true};
+		if(SIZE_MAX / (2u * sizeof(T)) < count)RSBD8_UNLIKELY return{false};
+		if constexpr(iscounted) if(!pcounts){
+			pcounts = new(std::nothrow) std::size_t[countslength]{};
+			if(!pcounts)RSBD8_UNLIKELY return{false};
+		}
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		unsigned const threads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-		, vararguments&&... varparameters)noexcept{
-#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-	assert(!(largepagesize - 1u & largepagesize));// a maximum of one bit should be set in the value of largepagesize
+		auto
+#if defined(_POSIX_C_SOURCE)
+			[grown, grownsize]
+#else
+			grown
 #endif
-	assert(input != output);
+			{allocatearray<isabsvalue, issignmode, isfltpmode, T, false>(2u * count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, threads
+#endif
+			)};
+		if(!grown.pbuffer)RSBD8_UNLIKELY return{false};
+		if(allocated.pbuffer){
+			std::memcpy(grown.pbuffer, allocated.pbuffer, itemcount * sizeof(T));
+			deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+				, allocsize
+#endif
+				);
+		}
+		allocated = grown;
+#if defined(_POSIX_C_SOURCE)
+		allocsize = grownsize;
+#endif
+		itemcapacity = count;
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads = threads;
+#endif
+		return{true};
+	}
+
+	// copy a chunk of items into the builder and count its digits, the memory grows if needed
+	// false is returned if the memory cannot be allocated, nothing is appended then
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL bool append(T const *RSBD8_RESTRICT input, std::size_t count)noexcept{
+		assert(!isfinalised);// call clear() first
+		if(!count) return{true};
+		if(itemcapacity - itemcount < count){
+			std::size_t const required{itemcount + count};
+			if(required < count)RSBD8_UNLIKELY return{false};
+			// try to grow by half of the current capacity first, to limit the number of times the items are copied
+			std::size_t const grown{itemcapacity + (itemcapacity >> 1)};
+			if(!(required < grown && reserve(grown)) && !reserve(required))RSBD8_UNLIKELY return{false};
+		}
+		T *RSBD8_RESTRICT pdestination{allocated.pbuffer + itemcount};
+		std::memcpy(pdestination, input, count * sizeof(T));
+		if constexpr(iscounted) helper::sortbuildercount<isabsvalue, issignmode, isfltpmode, U>(count, reinterpret_cast<U const *>(pdestination), pcounts);// the chunk is still in the data cache here
+		itemcount += count;
+		return{true};
+	}
+
+	// sort the appended items, and return a pointer to the sorted array, which stays valid until the builder is cleared, grown or released
+	// the builder has to be cleared before appending again
+	RSBD8_NODISCARD RSBD8_FUNC_NORMAL T *finalise()noexcept{
+		assert(!isfinalised);// call clear() first
+		isfinalised = true;
+		if(2u > itemcount) return{allocated.pbuffer};// nothing to sort
+		T *pbuffer{allocated.pbuffer + itemcapacity};
+		if constexpr(iscounted){
+			return{reinterpret_cast<T *>(helper::sortbuilderfinalise<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(itemcount, pcounts, reinterpret_cast<U *>(allocated.pbuffer), reinterpret_cast<U *>(pbuffer)))};
+		}else{// the indices have to be zeroed again for every use
+			std::memset(allocated.pzeroedindices, 0, getallocationparts<isabsvalue, issignmode, isfltpmode, T, false>(2u * itemcapacity
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				, allowedthreads
+#endif
+				).indicessize);
+			if constexpr(8u >= CHAR_BIT * sizeof(T) &&// skip the buffer for these single-part types
+				!(isabsvalue && issignmode) &&// both regular absolute modes
+				!(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
+				radixsortnoalloc<direction, mode, T>(itemcount,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, allocated.pbuffer);
+			else radixsortnoalloc<direction, mode, T>(itemcount,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+				allowedthreads, allocated.pfuturesplaceholder,
+#endif
+				allocated.pzeroedindices, allocated.pbuffer, pbuffer);
+			return{allocated.pbuffer};
+		}
+	}
+};
+
+// External sorting functions
+
+// sort a binary file of fixed-size items that can be much larger than the main memory, and write the result to the output file (which can be the input file)
+// the input is read in chunks that fit the memory budget, every chunk is sorted with radixsortnoalloc() and written to a temporary run file, and the runs are merged into the output file afterwards
+// the run files are created in the temporary directory if it is given, and next to the output file otherwise, and these are removed again afterwards
+// the memory budget in bytes holds the items, the index counts of the sorting function come on top of it
+// false is returned if the memory budget is too small or cannot be allocated, if a file cannot be read or written, or if the size of the input file is not a multiple of the item size
+template<typename T, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native>
+RSBD8_NODISCARD inline std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixsortfile(char const *inputfilename, char const *outputfilename, std::size_t memorybudget, char const *temporarydirectory = nullptr)noexcept{
 	// do not pass a nullptr here
-	assert(input);
-	assert(output);
+	assert(inputfilename);
+	assert(outputfilename);
 
 	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
 	static bool constexpr issignmode{helper::issignmode<mode, T>};
 	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
-	if(1u < count)RSBD8_LIKELY{// do not attempt to allocate memory if the array is already considered sorted
+	using U = helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	static bool constexpr isdescsort{helper::isdescsort<direction>};
+	static bool constexpr isrevorder{helper::isrevorderwithoutindirection<direction, U, isabsvalue, issignmode, isfltpmode>};
+	// the memory holds a chunk that is being read, one that is being sorted, one that is being written, and the buffer for sorting
+	std::size_t chunkcount{memorybudget / (4u * sizeof(T))};
+	if(2u > chunkcount)RSBD8_UNLIKELY return{false};
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-		unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+	unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
 #endif
-		// the single-part version never needs an extra buffer
-		auto
+	std::size_t indicessize{getallocationparts<isabsvalue, issignmode, isfltpmode, T, false>(4u * chunkcount
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+		).indicessize};
+	auto
 #if defined(_POSIX_C_SOURCE)
-			[allocated, allocsize]
+		[allocated, allocsize]
 #else
-			allocated
+		allocated
 #endif
-			{allocatearray<isabsvalue, issignmode, isfltpmode, T, true, false>(count
+		{allocatearray<isabsvalue, issignmode, isfltpmode, T, false>(4u * chunkcount
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		, allowedthreads
+#endif
+		)};
+	if(!allocated.pbuffer)RSBD8_UNLIKELY return{false};
+	helper::externalrunnames names;
+	bool succeeded{names.init(outputfilename, temporarydirectory)};
+	unsigned runcount{};
+	if(succeeded){
+		T *pfree{allocated.pbuffer + 2u * chunkcount};// this chunk is either unused or being written
+		T *pbuffer{allocated.pbuffer + 3u * chunkcount};
+		helper::externalreader<T> reader;
+		helper::externalwriter<T> writer;
+		succeeded = reader.open(inputfilename, allocated.pbuffer, chunkcount);
+		T *pdata{};
+		std::size_t count{};
+		if(succeeded) count = reader.fetch(allocated.pbuffer + chunkcount, pdata);
+		while(succeeded){
+			if(count){// the indices have to be zeroed again for every chunk
+				std::memset(allocated.pzeroedindices, 0, indicessize);
+				if constexpr(8u >= CHAR_BIT * sizeof(T) &&// skip the buffer for these single-part types
+					!(isabsvalue && issignmode) &&// both regular absolute modes
+					!(!isabsvalue && issignmode && isfltpmode))// regular floating-point mode
+					radixsortnoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+					allowedthreads, allocated.pfuturesplaceholder,
+#endif
+					allocated.pzeroedindices, pdata);
+				else radixsortnoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+					allowedthreads, allocated.pfuturesplaceholder,
+#endif
+					allocated.pzeroedindices, pdata, pbuffer);
+			}
+			// the previous run file has to be completed before its chunk can be re-used for reading
+			if(!writer.close())RSBD8_UNLIKELY{
+				succeeded = false;
+				break;
+			}
+			T *pnext{};
+			std::size_t nextcount{reader.fetch(pfree, pnext)};
+			if(!runcount && !nextcount){// the entire input fits in a single chunk, so write it to the output file directly
+				// the input file is closed first, as it can be the output file
+				succeeded = reader.close() && writer.open(outputfilename);
+				if(succeeded){
+					writer.write(pdata, count);
+					succeeded = writer.close();
+				}
+				break;
+			}
+			if(!writer.open(names.name(runcount++)))RSBD8_UNLIKELY{
+				succeeded = false;
+				break;
+			}
+			writer.write(pdata, count);
+			pfree = pdata;
+			pdata = pnext;
+			count = nextcount;
+			if(!count){
+				succeeded = writer.close();
+				break;
+			}
+		}
+		if(!reader.close())RSBD8_UNLIKELY succeeded = false;// this also catches a read error that was taken for the end of the file
+	}
+	if(runcount){
+		if(succeeded){// the input file is closed, so the entire memory can be used for merging
+			succeeded = helper::externalmergeall<isdescsort, isrevorder, isabsvalue, issignmode, isfltpmode, U>(runcount, names, outputfilename, reinterpret_cast<U *>(allocated.pbuffer), 4u * chunkcount);
+		}else for(unsigned i{}; runcount > i; ++i) std::remove(names.name(i));
+	}
+	deallocatearray(allocated.pbuffer
+#if defined(_POSIX_C_SOURCE)
+		, allocsize
+#endif
+		);
+	return{succeeded};
+}
+
+// sort a binary file of fixed-size items that fits in the main memory in place, by mapping it into memory and sorting the mapping directly
+// the buffer for sorting is regular memory by default, or a mapped temporary file in the temporary directory if one is given, for when the main memory is too small to hold both
+// false is returned if the file cannot be mapped, if the memory cannot be allocated, or if the size of the file is not a multiple of the item size
+template<typename T, sortingdirection direction = sortingdirection::ascfwdorder, sortingmode mode = sortingmode::native>
+RSBD8_NODISCARD inline std::enable_if_t<
+	(std::is_arithmetic_v<T> ||
+	std::is_enum_v<T> ||
+	std::is_class_v<T> || std::is_union_v<T>) &&
+	64u >= CHAR_BIT * sizeof(T),
+	bool> radixsortmappedfile(char const *filename, char const *temporarydirectory = nullptr)noexcept{
+	// do not pass a nullptr here
+	assert(filename);
+
+	static bool constexpr isabsvalue{helper::isabsvalue<mode, T>};
+	static bool constexpr issignmode{helper::issignmode<mode, T>};
+	static bool constexpr isfltpmode{helper::isfltpmode<mode, T>};
+	static bool constexpr isbufferused{8u < CHAR_BIT * sizeof(T) ||// only these single-part types skip the buffer
+		(isabsvalue && issignmode) ||// both regular absolute modes
+		(!isabsvalue && issignmode && isfltpmode)};// regular floating-point mode
+	helper::mappedfile data;
+	if(!data.open(filename))RSBD8_UNLIKELY return{false};
+	if(data.bytes() % sizeof(T))RSBD8_UNLIKELY return{false};
+	std::size_t count{data.bytes() / sizeof(T)};
+	if(2u > count) return{data.close()};// nothing to sort
+	// the mapped temporary file for the buffer, only used if a temporary directory is given
+	helper::mappedfile scratch;
+	bool isscratchmapped{isbufferused && temporarydirectory};
+	if(isscratchmapped && !scratch.create(temporarydirectory, data.bytes()))RSBD8_UNLIKELY return{false};
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+	unsigned allowedthreads{std::thread::hardware_concurrency()};// when this is 0, assume single-threaded-only
+#endif
+	auto
+#if defined(_POSIX_C_SOURCE)
+		[allocated, allocsize]
+#else
+		allocated
+#endif
+		{isscratchmapped?
+		allocatearray<isabsvalue, issignmode, isfltpmode, T, false, false>(count// only the futures and indices part is used
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
 			, allowedthreads
 #endif
-#ifdef _WIN32// _WIN32 will remain defined for Windows versions past the legacy 32-bit original
-			, largepagesize
-#elif defined(_POSIX_C_SOURCE)
-			, mmapflags
+			) :
+		allocatearray<isabsvalue, issignmode, isfltpmode, T, false>(count
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+			, allowedthreads
 #endif
 			)};
-		if(allocated.pbuffer)RSBD8_LIKELY{
-			radixsortcopynoalloc<T, indirection1, direction, mode, indirection2, isindexed2, V>(count,
+	if(!allocated.pbuffer)RSBD8_UNLIKELY return{false};
+	// the sorting passes go over the entire array in both directions, so let the system read the file ahead instead of faulting in one page at a time
+	data.prefetch();
+	T *pdata{reinterpret_cast<T *>(data.data())};
+	if constexpr(!isbufferused) radixsortnoalloc<direction, mode, T>(count,
 #if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
-				allowedthreads, allocated.pfuturesplaceholder,
+		allowedthreads, allocated.pfuturesplaceholder,
 #endif
-				allocated.pzeroedindices, input, output, std::forward<vararguments>(varparameters)...);
-			deallocatearray(allocated.pbuffer
+		allocated.pzeroedindices, pdata);
+	else radixsortnoalloc<direction, mode, T>(count,
+#if !defined(RSBD8_THREAD_MAXIMUM) || 1 < (RSBD8_THREAD_MAXIMUM)
+		allowedthreads, allocated.pfuturesplaceholder,
+#endif
+		allocated.pzeroedindices, pdata, isscratchmapped? reinterpret_cast<T *>(scratch.data()) : allocated.pbuffer);
+	deallocatearray(allocated.pbuffer
 #if defined(_POSIX_C_SOURCE)
-				, allocsize
+		, allocsize
 #endif
-				);
-			return{true};
-		}
-		return{false};
-	}else if(1u == count) *output = *input;// copy the single element if the count is 1
-	return{true};// the array is already considered sorted if the count is 0 or 1
+		);
+	scratch.close();
+	return{data.close()};
 }
 
 // Library finalisation
@@ -0,0 +1,101 @@
+// MIT License
+// Copyright (c) 2025-2026 Jan-Willem Krans (janwillem32 <at> hotmail <dot> com)
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Portable latency benchmark for repeated sorting of moderately sized arrays.
+// The Windows-only performance test suites measure throughput on very large arrays, while this one measures the fixed costs per call.
+// These are measured for spawning threads, for using the library-owned thread pool, and for using the thread pool together with a re-usable workspace.
+// Results are printed as the median time per call in nanoseconds, for a range of sizes around the 2- and 4-way multithreading thresholds.
+
+#include "../Radixsortbidi8.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+
+namespace{
+
+// simple and fast pseudo-random generator, the quality of the bits is of no importance here
+std::uint64_t benchmarkseed{0x9E3779B97F4A7C15u};
+std::uint64_t nextrandom()noexcept{
+	benchmarkseed = benchmarkseed * 6364136223846793005u + 1442695040888963407u;
+	return{benchmarkseed ^ benchmarkseed >> 29};
+}
+
+template<typename T>
+void fillrandom(std::vector<T> &data)noexcept{
+	for(T &elem : data){
+		std::uint64_t bits{nextrandom()};
+		if constexpr(std::is_floating_point_v<T>){// keep the values finite
+			elem = static_cast<T>(static_cast<std::int64_t>(bits)) * static_cast<T>(1. / 4294967296.);
+		}else std::memcpy(&elem, &bits, sizeof(T));
+	}
+}
+
+// the median of the per-call times of a number of repetitions of the given sorting function
+template<typename F>
+long long mediannanoseconds(unsigned repetitions, F &&function){
+	std::vector<long long> times(repetitions);
+	function();// warm-up run
+	for(long long &elem : times){
+		auto start{std::chrono::steady_clock::now()};
+		function();
+		auto stop{std::chrono::steady_clock::now()};
+		elem = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+	}
+	std::nth_element(times.begin(), times.begin() + repetitions / 2u, times.end());
+	return{times[repetitions / 2u]};
+}
+
+template<typename T>
+void benchmarktype(char const *name, unsigned repetitions){
+	static bool constexpr isabsvalue{rsbd8::helper::isabsvalue<rsbd8::sortingmode::native, T>};
+	static bool constexpr issignmode{rsbd8::helper::issignmode<rsbd8::sortingmode::native, T>};
+	static bool constexpr isfltpmode{rsbd8::helper::isfltpmode<rsbd8::sortingmode::native, T>};
+	using U = rsbd8::helper::tounifunsigned<T, isabsvalue, issignmode, isfltpmode>;
+	std::size_t limit2way{rsbd8::helper::base2waythreshold<false, false, isabsvalue, issignmode, isfltpmode, U, false>()};
+	std::size_t limit4way{rsbd8::helper::base4waythreshold<false, false, isabsvalue, issignmode, isfltpmode, U, false>()};
+	std::size_t const sizes[]{limit2way / 2u, limit2way, limit2way * 2u, limit4way / 2u, limit4way, limit4way * 2u};
+	for(std::size_t count : sizes){
+		std::vector<T> input(count), output(count);
+		fillrandom(input);
+		auto sortcall{[&]{
+			bool succeeded{rsbd8::radixsortcopy(count, input.data(), output.data())};
+			if(!succeeded) std::fputs("allocation failure\n", stderr);
+		}};
+		rsbd8::setthreadpool(nullptr);
+		long long spawning{mediannanoseconds(repetitions, sortcall)};
+		rsbd8::setthreadpool(&rsbd8::defaultthreadpool());
+		long long pooled{mediannanoseconds(repetitions, sortcall)};
+		rsbd8::sortworkspace workspace;
+		long long reused{mediannanoseconds(repetitions, [&]{
+			bool succeeded{rsbd8::radixsortcopy(count, input.data(), output.data(), workspace)};
+			if(!succeeded) std::fputs("allocation failure\n", stderr);
+		})};
+		rsbd8::setthreadpool(nullptr);
+		std::printf("%-8s count %9zu (%s): spawning threads %10lld ns, thread pool %10lld ns, factor %6.3f, plus workspace %10lld ns, factor %6.3f\n", name, count,
+			limit2way / 2u == count? "half 2-way threshold" : limit2way == count? "2-way threshold" : limit2way * 2u == count? "double 2-way threshold" :
+			limit4way / 2u == count? "half 4-way threshold" : limit4way == count? "4-way threshold" : "double 4-way threshold",
+			spawning, pooled, pooled? static_cast<double>(spawning) / static_cast<double>(pooled) : 0.,
+			reused, reused? static_cast<double>(spawning) / static_cast<double>(reused) : 0.);
+	}
+}
+
+}// namespace
+
+int main(int argc, char **argv){
+	unsigned repetitions{1000u};
+	if(1 < argc){
+		long parsed{std::strtol(argv[1], nullptr, 10)};
+		if(0 < parsed) repetitions = static_cast<unsigned>(parsed);
+	}
+	std::printf("hardware threads: %u, repetitions per measurement: %u\n", std::thread::hardware_concurrency(), repetitions);
+	benchmarktype<std::uint32_t>("uint32", repetitions);
+	benchmarktype<std::uint64_t>("uint64", repetitions);
+	benchmarktype<float>("float", repetitions);
+	benchmarktype<double>("double", repetitions);
+	return{0};
+}
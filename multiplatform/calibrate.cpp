@@ -0,0 +1,149 @@
+// MIT License
+// Copyright (c) 2025-2026 Jan-Willem Krans (janwillem32 <at> hotmail <dot> com)
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Calibration tool for the multithreading thresholds of this machine.
+// For every type size and indirection it times sorting with and without the next tier of multithreading over a range of input sizes, and writes the crossover points as a machine profile.
+// Usage: calibrate [profile file name, default rsbd8profile.txt] [largest input size in MiB, default 64]
+// Load the result with rsbd8::loadthresholdprofile(), or at startup by defining RSBD8_THRESHOLD_PROFILE as the file name before including the library.
+// Only the unsigned types in ascending, forward order are measured, the other sorting modes and directions are derived from these by the library.
+
+#include "../Radixsortbidi8.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+
+namespace{
+
+// simple and fast pseudo-random generator, the quality of the bits is of no importance here
+std::uint64_t calibrationseed{0x9E3779B97F4A7C15u};
+std::uint64_t nextrandom()noexcept{
+	calibrationseed = calibrationseed * 6364136223846793005u + 1442695040888963407u;
+	return{calibrationseed ^ calibrationseed >> 29};
+}
+
+// the median time of a number of repetitions of the given sorting function, with the repetitions scaled to the run time
+template<typename F>
+double mediannanoseconds(F &&function){
+	auto start{std::chrono::steady_clock::now()};
+	function();// warm-up run, also used for the estimate
+	double estimate{static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count())};
+	std::size_t repetitions{static_cast<std::size_t>(std::clamp(2e7 / std::max(estimate, 1.), 5., 201.)) | 1u};// about 20 ms per measurement
+	std::vector<double> times(repetitions);
+	for(double &elem : times){
+		start = std::chrono::steady_clock::now();
+		function();
+		elem = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+	}
+	std::nth_element(times.begin(), times.begin() + repetitions / 2u, times.end());
+	return{times[repetitions / 2u]};
+}
+
+// force the selected threshold and the ones below it to be as low as possible, or disable the selected one
+void forcethresholds(unsigned ways, unsigned typebits, bool isindirect, bool enable){
+	rsbd8::resetmultithreadingthresholds();
+	for(unsigned lower{2u}; ways > lower; lower *= 2u) rsbd8::setmultithreadingthreshold(lower, isindirect, typebits, 1u);
+	rsbd8::setmultithreadingthreshold(ways, isindirect, typebits, enable? 1u : SIZE_MAX);
+}
+
+struct calibrationresult{
+	unsigned ways;
+	bool isindirect;
+	unsigned typebits;
+	std::size_t basecount;
+};
+
+template<typename T, bool isindirect>
+void calibratetype(std::vector<calibrationresult> &results, unsigned hardwarethreads, std::size_t maximumbytes){
+	static unsigned constexpr typebits{CHAR_BIT * sizeof(T)};
+	static bool constexpr ismultipart{8u < typebits};
+	std::size_t maximumcount{maximumbytes / (isindirect? sizeof(T) + sizeof(T *) : sizeof(T))};
+	std::vector<T> values(maximumcount), output(isindirect? 0u : maximumcount);
+	for(T &elem : values) elem = static_cast<T>(nextrandom());
+	std::vector<T *> pointers(isindirect? maximumcount : 0u), pointersoutput(isindirect? maximumcount : 0u);
+	for(std::size_t i{}; pointers.size() > i; ++i) pointers[i] = &values[i];
+	rsbd8::sortworkspace workspace;
+
+	auto sortcall{[&](std::size_t count, unsigned allowedthreads){
+		auto allocated{workspace.prepare<false, false, false, T, isindirect, ismultipart>(count, allowedthreads)};
+		if(!allocated.pbuffer){
+			std::fputs("allocation failure\n", stderr);
+			std::exit(EXIT_FAILURE);
+		}
+		if constexpr(isindirect){
+			if constexpr(ismultipart) rsbd8::radixsortcopynoalloc<rsbd8::sortingdirection::ascfwdorder, rsbd8::sortingmode::native, 0, false, T>(count, allowedthreads, allocated.pfuturesplaceholder, allocated.pzeroedindices, pointers.data(), pointersoutput.data(), allocated.pbuffer);
+			else rsbd8::radixsortcopynoalloc<rsbd8::sortingdirection::ascfwdorder, rsbd8::sortingmode::native, 0, false, T>(count, allowedthreads, allocated.pfuturesplaceholder, allocated.pzeroedindices, pointers.data(), pointersoutput.data());
+		}else{
+			if constexpr(ismultipart) rsbd8::radixsortcopynoalloc(count, allowedthreads, allocated.pfuturesplaceholder, allocated.pzeroedindices, values.data(), output.data(), allocated.pbuffer);
+			else rsbd8::radixsortcopynoalloc(count, allowedthreads, allocated.pfuturesplaceholder, allocated.pzeroedindices, values.data(), output.data());
+		}
+	}};
+
+	for(unsigned ways : {2u, 4u, 8u}){
+		if(!ismultipart && 2u != ways) break;// 8-bit types only have the 2-way threshold
+		// the thread count that the tier is compared with, and the thread count that it uses when enabled
+		unsigned fewerthreads{(2u == ways)? 1u : (4u == ways)? 2u : 6u};
+		unsigned morethreads{std::min(hardwarethreads, (2u == ways)? 2u : (4u == ways)? 6u : 18u)};
+		if(((2u == ways)? 2u : (4u == ways)? 4u : 12u) > morethreads){
+			std::printf("%3u-bit %-8s %u-way: skipped, not enough hardware threads\n", typebits, isindirect? "indirect" : "direct", ways);
+			continue;
+		}
+		// consecutive wins for the tier, a single win can just be measurement noise
+		unsigned wins{};
+		std::size_t firstwin{};
+		for(double size{256.}; maximumcount >= size; size *= 1.189207115002721){// 4 steps per doubling
+			std::size_t count{static_cast<std::size_t>(size)};
+			forcethresholds(ways, typebits, isindirect, false);
+			double without{mediannanoseconds([&]{sortcall(count, fewerthreads);})};
+			forcethresholds(ways, typebits, isindirect, true);
+			double with{mediannanoseconds([&]{sortcall(count, morethreads);})};
+			if(with < without){
+				if(!wins++) firstwin = count;
+				if(3u <= wins) break;
+			}else wins = 0u;
+		}
+		rsbd8::resetmultithreadingthresholds();
+		if(3u <= wins){
+			std::printf("%3u-bit %-8s %u-way: crossover at %zu items\n", typebits, isindirect? "indirect" : "direct", ways, firstwin);
+			results.push_back({ways, isindirect, typebits, firstwin});
+		}else std::printf("%3u-bit %-8s %u-way: no crossover found, the compile-time default stays in use\n", typebits, isindirect? "indirect" : "direct", ways);
+		std::fflush(stdout);// this tool can run for a long time, so show the progress
+	}
+}
+
+}// namespace
+
+int main(int argc, char **argv){
+	char const *filename{(1 < argc)? argv[1] : "rsbd8profile.txt"};
+	std::size_t maximumbytes{static_cast<std::size_t>(64) << 20};
+	if(2 < argc){
+		long parsed{std::strtol(argv[2], nullptr, 10)};
+		if(0 < parsed) maximumbytes = static_cast<std::size_t>(parsed) << 20;
+	}
+	unsigned hardwarethreads{std::thread::hardware_concurrency()};
+	std::printf("hardware threads: %u, largest input size: %zu MiB\n", hardwarethreads, maximumbytes >> 20);
+	rsbd8::setthreadpool(&rsbd8::defaultthreadpool());
+
+	std::vector<calibrationresult> results;
+	calibratetype<std::uint8_t, false>(results, hardwarethreads, maximumbytes);
+	calibratetype<std::uint16_t, false>(results, hardwarethreads, maximumbytes);
+	calibratetype<std::uint32_t, false>(results, hardwarethreads, maximumbytes);
+	calibratetype<std::uint64_t, false>(results, hardwarethreads, maximumbytes);
+	calibratetype<std::uint8_t, true>(results, hardwarethreads, maximumbytes);
+	calibratetype<std::uint16_t, true>(results, hardwarethreads, maximumbytes);
+	calibratetype<std::uint32_t, true>(results, hardwarethreads, maximumbytes);
+	calibratetype<std::uint64_t, true>(results, hardwarethreads, maximumbytes);
+	rsbd8::setthreadpool(nullptr);
+
+	for(calibrationresult const &elem : results) rsbd8::setmultithreadingthreshold(elem.ways, elem.isindirect, elem.typebits, elem.basecount);
+	if(!rsbd8::savethresholdprofile(filename)){
+		std::fprintf(stderr, "failed to write %s\n", filename);
+		return{EXIT_FAILURE};
+	}
+	std::printf("profile with %zu thresholds written to %s\n", results.size(), filename);
+	return{0};
+}
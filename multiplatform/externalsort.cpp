@@ -0,0 +1,111 @@
+// MIT License
+// Copyright (c) 2025-2026 Jan-Willem Krans (janwillem32 <at> hotmail <dot> com)
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Portable benchmark for sorting a file that is larger than the memory budget.
+// It writes a file of random uint64 items, sorts it with rsbd8::radixsortfile(), checks the order of the output file, and prints the time of the sort.
+// Usage: externalsort [file name, default rsbd8external.bin] [input size in MiB, default 4096] [memory budget in MiB, default 1024] [temporary directory, default next to the output file]
+// The output is written to the file name followed by ".sorted", and both files are removed afterwards. Use a file on the disk that is to be measured, as the files of the temporary directory of the system may be in memory.
+
+#include "../Radixsortbidi8.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace{
+
+// simple and fast pseudo-random generator, the quality of the bits is of no importance here
+std::uint64_t externalseed{0x9E3779B97F4A7C15u};
+std::uint64_t nextrandom()noexcept{
+	externalseed = externalseed * 6364136223846793005u + 1442695040888963407u;
+	return{externalseed ^ externalseed >> 29};
+}
+
+}// namespace
+
+int main(int argc, char **argv){
+	char const *inputfilename{(1 < argc)? argv[1] : "rsbd8external.bin"};
+	std::size_t inputbytes{static_cast<std::size_t>(4096) << 20};
+	if(2 < argc){
+		long parsed{std::strtol(argv[2], nullptr, 10)};
+		if(0 < parsed) inputbytes = static_cast<std::size_t>(parsed) << 20;
+	}
+	std::size_t memorybudget{static_cast<std::size_t>(1024) << 20};
+	if(3 < argc){
+		long parsed{std::strtol(argv[3], nullptr, 10)};
+		if(0 < parsed) memorybudget = static_cast<std::size_t>(parsed) << 20;
+	}
+	char const *temporarydirectory{(4 < argc)? argv[4] : nullptr};
+	std::vector<char> outputfilename(std::strlen(inputfilename) + sizeof(".sorted"));
+	std::strcpy(outputfilename.data(), inputfilename);
+	std::strcat(outputfilename.data(), ".sorted");
+	std::printf("hardware threads: %u, input size: %zu MiB, memory budget: %zu MiB\n", std::thread::hardware_concurrency(), inputbytes >> 20, memorybudget >> 20);
+	rsbd8::setthreadpool(&rsbd8::defaultthreadpool());
+
+	// write the input file in blocks of 64 MiB
+	std::vector<std::uint64_t> block(static_cast<std::size_t>(8) << 20);
+	{
+		std::FILE *file{std::fopen(inputfilename, "wb")};
+		if(!file){
+			std::fputs("cannot create the input file\n", stderr);
+			return{EXIT_FAILURE};
+		}
+		auto start{std::chrono::steady_clock::now()};
+		for(std::size_t remaining{inputbytes / sizeof(std::uint64_t)}; remaining;){
+			std::size_t count{(block.size() < remaining)? block.size() : remaining};
+			for(std::size_t i{}; count > i; ++i) block[i] = nextrandom();
+			if(count != std::fwrite(block.data(), sizeof(std::uint64_t), count, file)){
+				std::fputs("cannot write the input file\n", stderr);
+				std::fclose(file);
+				std::remove(inputfilename);
+				return{EXIT_FAILURE};
+			}
+			remaining -= count;
+		}
+		if(std::fclose(file)){
+			std::fputs("cannot write the input file\n", stderr);
+			std::remove(inputfilename);
+			return{EXIT_FAILURE};
+		}
+		double elapsed{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+		std::printf("writing the input file: %9.3f s, %8.1f MiB/s\n", elapsed, static_cast<double>(inputbytes >> 20) / elapsed);
+		std::fflush(stdout);// this tool can run for a long time, so show the progress
+	}
+
+	auto start{std::chrono::steady_clock::now()};
+	bool succeeded{rsbd8::radixsortfile<std::uint64_t>(inputfilename, outputfilename.data(), memorybudget, temporarydirectory)};
+	double elapsed{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+	std::remove(inputfilename);
+	if(!succeeded){
+		std::fputs("sorting failure\n", stderr);
+		return{EXIT_FAILURE};
+	}
+	std::printf("external sort:          %9.3f s, %8.1f MiB/s\n", elapsed, static_cast<double>(inputbytes >> 20) / elapsed);
+
+	// check the order and the size of the output file
+	std::FILE *file{std::fopen(outputfilename.data(), "rb")};
+	std::uint64_t previous{};
+	std::size_t total{};
+	bool isordered{nullptr != file};
+	while(isordered){
+		std::size_t count{std::fread(block.data(), sizeof(std::uint64_t), block.size(), file)};
+		if(!count) break;
+		for(std::size_t i{}; count > i; ++i){
+			if(previous > block[i]) isordered = false;
+			previous = block[i];
+		}
+		total += count;
+	}
+	if(file) std::fclose(file);
+	std::remove(outputfilename.data());
+	rsbd8::setthreadpool(nullptr);
+	if(!isordered || inputbytes / sizeof(std::uint64_t) != total){
+		std::fputs("sorting failure\n", stderr);
+		return{EXIT_FAILURE};
+	}
+	return{0};
+}
@@ -306,5 +306,1125 @@ int main(){
 		// TODO: add more unit tests
 	}
 
+	{// unit tests with the persistent thread pool
+		rsbd8::threadpool pool;
+		assert(0 == pool.size());
+		rsbd8::threadpool *previouspool{rsbd8::setthreadpool(&pool)};
+		assert(&pool == rsbd8::getthreadpool());
+
+		// two tasks that wait on each other can only complete when both run simultaneously, so the pool has to grow to two workers
+		std::atomic_uint rendezvous{};
+		auto meet{[](std::atomic_uint &counter)noexcept{
+			counter.fetch_add(1u);
+			while(2u > counter.load()) std::this_thread::yield();
+		}};
+		{
+			auto taska{rsbd8::helper::launchasync(meet, std::ref(rendezvous))};
+			auto taskb{rsbd8::helper::launchasync(meet, std::ref(rendezvous))};
+		}// both destructors block until their task has completed
+		assert(2u == rendezvous.load());
+		assert(2u == pool.size());
+
+		auto taskc{rsbd8::helper::launchasync([](unsigned a, unsigned b)noexcept{return a * b;}, 6u, 7u)};
+		assert(42u == taskc.get());
+		auto taskd{rsbd8::helper::launchasync([]()->unsigned{throw 42u;})};
+		unsigned caught{};
+		try{
+			static_cast<void>(taskd.get());
+		}catch(unsigned e){
+			caught = e;
+		}
+		assert(42u == caught);
+
+		// sort an array large enough to use multithreading on machines with more than one hardware thread
+		static std::size_t constexpr largecount{1u << 18};
+		std::uint64_t *large{new std::uint64_t[largecount]};
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		for(std::size_t i{}; largecount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			large[i] = seed;
+		}
+		bool succeededp0{rsbd8::radixsort(largecount, large)};
+		assert(succeededp0);
+		for(std::size_t i{1}; largecount > i; ++i) assert(large[i - 1] <= large[i]);
+		delete[] large;
+
+		rsbd8::setthreadpool(previouspool);
+		assert(previouspool == rsbd8::getthreadpool());
+	}
+
+	{// unit tests with a re-usable sorting workspace
+		rsbd8::sortworkspace workspace;
+		assert(0 == workspace.size());
+
+		// repeated sorting of differently sized arrays of several types with the same workspace, the held memory only grows
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		std::size_t previoussize{};
+		for(std::size_t count : {std::size_t{1000u}, std::size_t{100000u}, std::size_t{10u}, std::size_t{1000u}}){
+			std::uint32_t *input{new std::uint32_t[count]};
+			std::uint32_t *output{new std::uint32_t[count]};
+			std::uint8_t *bytes{new std::uint8_t[count]};
+			for(std::size_t i{}; count > i; ++i){
+				seed = seed * 6364136223846793005u + 1442695040888963407u;
+				input[i] = static_cast<std::uint32_t>(seed >> 32);
+				bytes[i] = static_cast<std::uint8_t>(seed >> 56);
+			}
+			bool succeededw0{rsbd8::radixsortcopy(count, input, output, workspace)};
+			assert(succeededw0);
+			for(std::size_t i{1}; count > i; ++i) assert(output[i - 1] <= output[i]);
+			bool succeededw1{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder>(count, input, workspace)};
+			assert(succeededw1);
+			for(std::size_t i{}; count > i; ++i) assert(output[count - 1 - i] == input[i]);
+			bool succeededw2{rsbd8::radixsort(count, bytes, workspace)};// single-part type, no buffer required
+			assert(succeededw2);
+			for(std::size_t i{1}; count > i; ++i) assert(bytes[i - 1] <= bytes[i]);
+			assert(previoussize <= workspace.size());
+			previoussize = workspace.size();
+			delete[] bytes;
+			delete[] output;
+			delete[] input;
+		}
+
+		// sorting with indirection
+		double values[]{2.5, -1., 0., 7.25, -3.5};
+		double *pointers[std::size(values)]{&values[0], &values[1], &values[2], &values[3], &values[4]};
+		bool succeededw3{rsbd8::radixsort(std::size(pointers), pointers, workspace)};
+		assert(succeededw3);
+		assert(-3.5 == *pointers[0]);
+		assert(-1. == *pointers[1]);
+		assert(0. == *pointers[2]);
+		assert(2.5 == *pointers[3]);
+		assert(7.25 == *pointers[4]);
+
+		workspace.release();
+		assert(0 == workspace.size());
+		bool succeededw4{rsbd8::radixsort(std::size(values), values, workspace)};
+		assert(succeededw4);
+		assert(-3.5 == values[0] && 7.25 == values[4]);
+		assert(workspace.size());
+	}
+
+	{// unit tests with the run-time multithreading thresholds and machine profiles
+		auto runtime2way{rsbd8::helper::runtime2waythreshold<false, false, false, false, false, std::uint32_t, false>};
+		auto runtime4way{rsbd8::helper::runtime4waythreshold<false, false, false, false, false, std::uint32_t, false>};
+		std::size_t default2way{rsbd8::helper::base2waythreshold<false, false, false, false, false, std::uint32_t, false>()};
+		std::size_t default4way{rsbd8::helper::base4waythreshold<false, false, false, false, false, std::uint32_t, false>()};
+		assert(default2way == runtime2way());
+		assert(default4way == runtime4way());
+		assert(!rsbd8::getmultithreadingthreshold(2u, false, 32u));
+
+		// invalid combinations are rejected
+		assert(!rsbd8::setmultithreadingthreshold(3u, false, 32u, 1000u));
+		assert(!rsbd8::setmultithreadingthreshold(4u, false, 8u, 1000u));
+		assert(!rsbd8::setmultithreadingthreshold(2u, false, 12u, 1000u));
+
+		// the absolute minimum and the factor of 3 between the 2- and 4-way thresholds still apply
+		bool succeededs0{rsbd8::setmultithreadingthreshold(2u, false, 32u, 1u)};
+		assert(succeededs0);
+		assert(1u == rsbd8::getmultithreadingthreshold(2u, false, 32u));
+		assert((rsbd8::helper::thresholdminimum<std::uint32_t, false>()) == runtime2way());
+		assert(default4way == runtime4way());
+		bool succeededs1{rsbd8::setmultithreadingthreshold(2u, false, 32u, 100000u)};
+		assert(succeededs1);
+		assert(100000u == runtime2way());
+		assert(300000u <= runtime4way());
+		// the factors for the sorting modes and directions are applied on top of the base count
+		assert(100000u > (rsbd8::helper::runtime2waythreshold<true, false, false, false, false, std::uint32_t, false>()));
+
+		// save and load a profile
+		bool succeededs2{rsbd8::setmultithreadingthreshold(8u, true, 64u, 123456789u)};
+		assert(succeededs2);
+		bool succeededs3{rsbd8::savethresholdprofile("rsbd8testprofile.txt")};
+		assert(succeededs3);
+		rsbd8::resetmultithreadingthresholds();
+		assert(default2way == runtime2way());
+		bool succeededs4{rsbd8::loadthresholdprofile("rsbd8testprofile.txt")};
+		assert(succeededs4);
+		assert(100000u == rsbd8::getmultithreadingthreshold(2u, false, 32u));
+		assert(123456789u == rsbd8::getmultithreadingthreshold(8u, true, 64u));
+		assert(!rsbd8::getmultithreadingthreshold(4u, false, 32u));
+
+		// an invalid profile changes nothing
+		if(std::FILE *file{std::fopen("rsbd8testprofile.txt", "w")}){
+			std::fputs("# comment\n2 direct 16 5000\n4 sideways 32 5000\n", file);
+			std::fclose(file);
+		}
+		bool succeededs5{rsbd8::loadthresholdprofile("rsbd8testprofile.txt")};
+		assert(!succeededs5);
+		assert(!rsbd8::getmultithreadingthreshold(2u, false, 16u));
+		assert(100000u == rsbd8::getmultithreadingthreshold(2u, false, 32u));
+		std::remove("rsbd8testprofile.txt");
+		bool succeededs6{rsbd8::loadthresholdprofile("rsbd8testprofile.txt")};
+		assert(!succeededs6);
+
+		// sorting with the lowest possible thresholds
+		rsbd8::setmultithreadingthreshold(2u, false, 32u, 1u);
+		rsbd8::setmultithreadingthreshold(4u, false, 32u, 1u);
+		rsbd8::setmultithreadingthreshold(8u, false, 32u, 1u);
+		std::uint32_t lowcount[1000];
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		for(std::uint32_t &elem : lowcount){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			elem = static_cast<std::uint32_t>(seed >> 32);
+		}
+		bool succeededs7{rsbd8::radixsort(std::size(lowcount), lowcount)};
+		assert(succeededs7);
+		for(std::size_t i{1}; std::size(lowcount) > i; ++i) assert(lowcount[i - 1] <= lowcount[i]);
+		rsbd8::resetmultithreadingthresholds();
+		assert(default2way == runtime2way());
+	}
+
+	{// unit tests with merge-path merging in 8-, 12- and 18-way multithreading
+		// lower the thresholds, so the inputs here are large enough to be split into halves and thirds
+		for(bool isindirect : {false, true}){
+			rsbd8::setmultithreadingthreshold(2u, isindirect, 64u, 1u);
+			rsbd8::setmultithreadingthreshold(4u, isindirect, 64u, 1u);
+			rsbd8::setmultithreadingthreshold(8u, isindirect, 64u, 1u);
+		}
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		static std::size_t constexpr mergecount{30001u};// odd, so the halves and thirds are unequal
+		std::int64_t *input{new std::int64_t[mergecount]}, *output{new std::int64_t[mergecount]}, *reference{new std::int64_t[mergecount]};
+		std::int64_t const **pointers{new std::int64_t const *[mergecount]}, **pointersoutput{new std::int64_t const *[mergecount]};
+		for(std::size_t i{}; mergecount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			input[i] = static_cast<std::int64_t>(seed) >> (seed & 63u | 48u);// include many duplicates
+			reference[i] = input[i];
+			pointers[i] = input + i;
+		}
+		bool succeededp0{rsbd8::radixsort<rsbd8::sortingdirection::dscrevorder>(mergecount, reference)};
+		assert(succeededp0);
+		rsbd8::sortworkspace workspace;
+		for(unsigned threads : {8u, 12u, 18u}){
+			auto allocated{workspace.prepare<false, true, false, std::int64_t, false>(mergecount, threads)};
+			assert(allocated.pbuffer);
+			rsbd8::radixsortcopynoalloc<rsbd8::sortingdirection::dscrevorder>(mergecount, threads, allocated.pfuturesplaceholder, allocated.pzeroedindices, input, output, allocated.pbuffer);
+			for(std::size_t i{}; mergecount > i; ++i) assert(reference[i] == output[i]);
+			// stability with indirection, the order of equal items is reversed
+			auto allocatedpointers{workspace.prepare<false, true, false, std::int64_t const, true>(mergecount, threads)};
+			assert(allocatedpointers.pbuffer);
+			rsbd8::radixsortcopynoalloc<rsbd8::sortingdirection::dscrevorder>(mergecount, threads, allocatedpointers.pfuturesplaceholder, allocatedpointers.pzeroedindices, pointers, pointersoutput, allocatedpointers.pbuffer);
+			assert(reference[0] == *pointersoutput[0]);
+			for(std::size_t i{1}; mergecount > i; ++i) assert(reference[i] == *pointersoutput[i] && (reference[i - 1] != reference[i] || pointersoutput[i - 1] > pointersoutput[i]));
+		}
+		delete[] pointersoutput;
+		delete[] pointers;
+		delete[] reference;
+		delete[] output;
+		delete[] input;
+		rsbd8::resetmultithreadingthresholds();
+	}
+
+	{// unit tests with more than 18-way multithreading
+		// lower the thresholds, so the inputs here are large enough to be split into many parts
+		rsbd8::setmultithreadingthreshold(2u, false, 64u, 1u);
+		rsbd8::setmultithreadingthreshold(4u, false, 64u, 1u);
+		rsbd8::setmultithreadingthreshold(8u, false, 64u, 1u);
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		static std::size_t constexpr manycount{50000u};
+		std::int64_t *input{new std::int64_t[manycount]}, *output{new std::int64_t[manycount]}, *reference{new std::int64_t[manycount]}, *inplace{new std::int64_t[manycount]};
+		for(std::size_t i{}; manycount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			input[i] = static_cast<std::int64_t>(seed) >> (seed & 63u);// include many duplicates
+			reference[i] = input[i];
+		}
+		bool succeededm0{rsbd8::radixsort<rsbd8::sortingdirection::dscrevorder>(manycount, reference)};
+		assert(succeededm0);
+		rsbd8::sortworkspace workspace;
+		for(unsigned threads : {24u, 30u, 32u, 36u, 48u, 64u, 128u}){
+			auto allocated{workspace.prepare<false, true, false, std::int64_t, false>(manycount, threads)};
+			assert(allocated.pbuffer);
+			rsbd8::radixsortcopynoalloc<rsbd8::sortingdirection::dscrevorder>(manycount, threads, allocated.pfuturesplaceholder, allocated.pzeroedindices, input, output, allocated.pbuffer);
+			for(std::size_t i{}; manycount > i; ++i) assert(reference[i] == output[i]);
+			for(bool movetobuffer : {false, true}){
+				std::memcpy(inplace, input, manycount * sizeof(std::int64_t));
+				allocated = workspace.prepare<false, true, false, std::int64_t, false>(manycount, threads);
+				assert(allocated.pbuffer);
+				rsbd8::radixsortnoalloc<rsbd8::sortingdirection::dscrevorder>(manycount, threads, allocated.pfuturesplaceholder, allocated.pzeroedindices, inplace, allocated.pbuffer, movetobuffer);
+				std::int64_t const *result{movetobuffer? allocated.pbuffer : inplace};
+				for(std::size_t i{}; manycount > i; ++i) assert(reference[i] == result[i]);
+			}
+		}
+		delete[] inplace;
+		delete[] reference;
+		delete[] output;
+		delete[] input;
+		rsbd8::resetmultithreadingthresholds();
+	}
+
+	{// unit tests with the global histogram, MSD-then-LSD and sample sort multithreading strategies
+		// lower the thresholds, so the inputs here are large enough for 8 threads and more
+		for(unsigned typebits : {16u, 64u}) for(bool isindirect : {false, true}){
+			rsbd8::setmultithreadingthreshold(2u, isindirect, typebits, 1u);
+			rsbd8::setmultithreadingthreshold(4u, isindirect, typebits, 1u);
+			rsbd8::setmultithreadingthreshold(8u, isindirect, typebits, 1u);
+		}
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		static std::size_t constexpr globalcount{100001u};// odd, so the slices of the threads are unequal, and large enough for the MSD-then-LSD strategy to partition some of its parts again
+		std::int64_t *input{new std::int64_t[globalcount]}, *output{new std::int64_t[globalcount]}, *reference{new std::int64_t[globalcount]}, *inplace{new std::int64_t[globalcount]};
+		std::int64_t const **pointers{new std::int64_t const *[globalcount]}, **pointersoutput{new std::int64_t const *[globalcount]};
+		double *inputf{new double[globalcount]}, *outputf{new double[globalcount]}, *referencef{new double[globalcount]};
+		std::uint16_t *inputs{new std::uint16_t[globalcount]}, *outputs{new std::uint16_t[globalcount]}, *references{new std::uint16_t[globalcount]};
+		for(std::size_t i{}; globalcount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			input[i] = static_cast<std::int64_t>(seed) >> (seed & 63u);// include many duplicates
+			reference[i] = input[i];
+			pointers[i] = input + i;
+			inputf[i] = static_cast<double>(static_cast<std::int64_t>(seed) >> 58);// include many values that are equal in absolute value
+			referencef[i] = inputf[i];
+			inputs[i] = static_cast<std::uint16_t>(seed >> 48 & 0x0F0Fu);// some sorting passes are skipped
+			references[i] = inputs[i];
+		}
+		// the references are sorted with the default strategy
+		bool succeededg0{rsbd8::radixsort<rsbd8::sortingdirection::dscrevorder>(globalcount, reference)};
+		assert(succeededg0);
+		bool succeededg1{rsbd8::radixsort<rsbd8::sortingdirection::dscrevorder, rsbd8::sortingmode::nativeabs>(globalcount, referencef)};
+		assert(succeededg1);
+		bool succeededg2{rsbd8::radixsort(globalcount, references)};
+		assert(succeededg2);
+		rsbd8::multithreadingstrategy previousstrategy{rsbd8::setmultithreadingstrategy(rsbd8::multithreadingstrategy::globalhistogram)};
+		assert(rsbd8::multithreadingstrategy::bidirectional == previousstrategy);
+		assert(rsbd8::multithreadingstrategy::globalhistogram == rsbd8::getmultithreadingstrategy());
+		rsbd8::sortworkspace workspace;
+		for(rsbd8::multithreadingstrategy strategy : {rsbd8::multithreadingstrategy::globalhistogram, rsbd8::multithreadingstrategy::msdthenlsd, rsbd8::multithreadingstrategy::samplesort}) for(unsigned threads : {8u, 13u, 16u, 32u}){
+			rsbd8::setmultithreadingstrategy(strategy);
+			auto allocated{workspace.prepare<false, true, false, std::int64_t, false>(globalcount, threads)};
+			assert(allocated.pbuffer);
+			rsbd8::radixsortcopynoalloc<rsbd8::sortingdirection::dscrevorder>(globalcount, threads, allocated.pfuturesplaceholder, allocated.pzeroedindices, input, output, allocated.pbuffer);
+			for(std::size_t i{}; globalcount > i; ++i) assert(reference[i] == output[i]);
+			for(bool movetobuffer : {false, true}){
+				std::memcpy(inplace, input, globalcount * sizeof(std::int64_t));
+				allocated = workspace.prepare<false, true, false, std::int64_t, false>(globalcount, threads);
+				assert(allocated.pbuffer);
+				rsbd8::radixsortnoalloc<rsbd8::sortingdirection::dscrevorder>(globalcount, threads, allocated.pfuturesplaceholder, allocated.pzeroedindices, inplace, allocated.pbuffer, movetobuffer);
+				std::int64_t const *result{movetobuffer? allocated.pbuffer : inplace};
+				for(std::size_t i{}; globalcount > i; ++i) assert(reference[i] == result[i]);
+			}
+			// the order of items that are equal in absolute value is reversed, and the sign bit tells these apart
+			auto allocatedf{workspace.prepare<true, true, true, double, false>(globalcount, threads)};
+			assert(allocatedf.pbuffer);
+			rsbd8::radixsortcopynoalloc<rsbd8::sortingdirection::dscrevorder, rsbd8::sortingmode::nativeabs>(globalcount, threads, allocatedf.pfuturesplaceholder, allocatedf.pzeroedindices, inputf, outputf, allocatedf.pbuffer);
+			for(std::size_t i{}; globalcount > i; ++i) assert(0 == std::memcmp(referencef + i, outputf + i, sizeof(double)));
+			auto allocateds{workspace.prepare<false, false, false, std::uint16_t, false>(globalcount, threads)};
+			assert(allocateds.pbuffer);
+			rsbd8::radixsortcopynoalloc(globalcount, threads, allocateds.pfuturesplaceholder, allocateds.pzeroedindices, inputs, outputs, allocateds.pbuffer);
+			for(std::size_t i{}; globalcount > i; ++i) assert(references[i] == outputs[i]);
+			// stability with indirection, the order of equal items is reversed (only the sample sort strategy handles indirection)
+			for(bool movetobuffer : {false, true}){
+				std::memcpy(pointersoutput, pointers, globalcount * sizeof(std::int64_t const *));
+				auto allocatedpointers{workspace.prepare<false, true, false, std::int64_t const, true>(globalcount, threads)};
+				assert(allocatedpointers.pbuffer);
+				rsbd8::radixsortnoalloc<rsbd8::sortingdirection::dscrevorder>(globalcount, threads, allocatedpointers.pfuturesplaceholder, allocatedpointers.pzeroedindices, pointersoutput, allocatedpointers.pbuffer, movetobuffer);
+				auto result{movetobuffer? allocatedpointers.pbuffer : pointersoutput};
+				assert(reference[0] == *result[0]);
+				for(std::size_t i{1}; globalcount > i; ++i) assert(reference[i] == *result[i] && (reference[i - 1] != reference[i] || result[i - 1] > result[i]));
+			}
+		}
+		rsbd8::setmultithreadingstrategy(previousstrategy);
+		delete[] references;
+		delete[] outputs;
+		delete[] inputs;
+		delete[] referencef;
+		delete[] outputf;
+		delete[] inputf;
+		delete[] pointersoutput;
+		delete[] pointers;
+		delete[] inplace;
+		delete[] reference;
+		delete[] output;
+		delete[] input;
+		rsbd8::resetmultithreadingthresholds();
+	}
+
+	{// unit tests with NUMA-aware sorting on virtual nodes
+		rsbd8::numatopology const &systemtopology{rsbd8::systemnumatopology()};
+		for(unsigned i{}; systemtopology.nodecount() > i; ++i) assert(systemtopology.cpucount(i));
+		// lower the 2-way threshold, so the inputs here are large enough to be split over the nodes
+		rsbd8::setmultithreadingthreshold(2u, false, 64u, 1u);
+		rsbd8::setmultithreadingthreshold(2u, false, 32u, 1u);
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		static std::size_t constexpr numacount{10000u};
+		std::uint64_t *keys{new std::uint64_t[numacount]}, *reference{new std::uint64_t[numacount]};
+		float *values{new float[numacount]}, *output{new float[numacount]}, *referenceoutput{new float[numacount]};
+		for(unsigned nodes : {1u, 2u, 3u, 4u, 5u, 6u, 7u}){// include node counts that are not of the form 2^a * 3^b
+			rsbd8::numatopology topology{nodes};
+			assert(nodes == topology.nodecount());
+			for(std::size_t i{}; numacount > i; ++i){
+				seed = seed * 6364136223846793005u + 1442695040888963407u;
+				keys[i] = seed >> (seed & 63u);// include many duplicates
+				values[i] = static_cast<float>(static_cast<std::int32_t>(seed >> 40) % 1000) * .5f;
+				reference[i] = keys[i];
+			}
+			bool succeededn0{rsbd8::radixsort(numacount, reference)};
+			assert(succeededn0);
+			bool succeededn1{rsbd8::radixsort(numacount, keys, topology)};
+			assert(succeededn1);
+			for(std::size_t i{}; numacount > i; ++i) assert(reference[i] == keys[i]);
+			bool succeededn2{rsbd8::radixsortcopy<rsbd8::sortingdirection::dscrevorder>(numacount, values, referenceoutput)};
+			assert(succeededn2);
+			bool succeededn3{rsbd8::radixsortcopy<rsbd8::sortingdirection::dscrevorder>(numacount, values, output, topology)};
+			assert(succeededn3);
+			assert(!std::memcmp(referenceoutput, output, numacount * sizeof(float)));// compare the bits to include the signs of zero
+		}
+		delete[] referenceoutput;
+		delete[] output;
+		delete[] values;
+		delete[] reference;
+		delete[] keys;
+		rsbd8::resetmultithreadingthresholds();
+	}
+
+	{// unit tests with sorting keys with a separate payload array
+		static std::size_t constexpr keyvaluecount{100000u};
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		std::uint64_t *keys{new std::uint64_t[keyvaluecount]}, *originalkeys{new std::uint64_t[keyvaluecount]}, *reference{new std::uint64_t[keyvaluecount]};
+		std::uint32_t *ids{new std::uint32_t[keyvaluecount]}, *outids{new std::uint32_t[keyvaluecount]};
+		float *values{new float[keyvaluecount]}, *outvalues{new float[keyvaluecount]}, *referencevalues{new float[keyvaluecount]};
+		for(std::size_t i{}; keyvaluecount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			keys[i] = seed >> (seed & 63u);// include many duplicates
+			values[i] = static_cast<float>(static_cast<std::int32_t>(seed >> 40) % 1000) * .5f;// include positive and negative values with the same absolute value
+			ids[i] = static_cast<std::uint32_t>(i);
+		}
+		std::memcpy(originalkeys, keys, keyvaluecount * sizeof(std::uint64_t));
+		std::memcpy(reference, keys, keyvaluecount * sizeof(std::uint64_t));
+		bool succeededk0{rsbd8::radixsort(keyvaluecount, reference)};
+		assert(succeededk0);
+		// in place, every payload stays with its key, and equal keys keep their order
+		bool succeededk1{rsbd8::radixsort(keyvaluecount, keys, ids)};
+		assert(succeededk1);
+		assert(!std::memcmp(reference, keys, keyvaluecount * sizeof(std::uint64_t)));
+		for(std::size_t i{}; keyvaluecount > i; ++i){
+			assert(originalkeys[ids[i]] == keys[i]);
+			if(i) assert(keys[i - 1u] != keys[i] || ids[i - 1u] < ids[i]);
+		}
+
+		// stability in both directions of ordering keys with the same absolute value
+		for(std::size_t i{}; keyvaluecount > i; ++i) ids[i] = static_cast<std::uint32_t>(i);
+		std::memcpy(referencevalues, values, keyvaluecount * sizeof(float));
+		bool succeededk2{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(keyvaluecount, referencevalues)};
+		assert(succeededk2);
+		bool succeededk3{rsbd8::radixsortcopy<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(keyvaluecount, values, ids, outvalues, outids)};
+		assert(succeededk3);
+		assert(!std::memcmp(referencevalues, outvalues, keyvaluecount * sizeof(float)));// compare the bits to include the signs
+		for(std::size_t i{}; keyvaluecount > i; ++i){
+			assert(!std::memcmp(values + outids[i], outvalues + i, sizeof(float)));
+			if(i) assert((outvalues[i - 1u] != outvalues[i] && outvalues[i - 1u] != -outvalues[i]) || outids[i - 1u] < outids[i]);
+		}
+		std::memcpy(referencevalues, values, keyvaluecount * sizeof(float));
+		bool succeededk4{rsbd8::radixsort<rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>(keyvaluecount, referencevalues)};
+		assert(succeededk4);
+		bool succeededk5{rsbd8::radixsortcopy<rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>(keyvaluecount, values, ids, outvalues, outids)};
+		assert(succeededk5);
+		assert(!std::memcmp(referencevalues, outvalues, keyvaluecount * sizeof(float)));
+		for(std::size_t i{}; keyvaluecount > i; ++i){
+			assert(!std::memcmp(values + outids[i], outvalues + i, sizeof(float)));
+			if(i) assert((outvalues[i - 1u] != outvalues[i] && outvalues[i - 1u] != -outvalues[i]) || outids[i - 1u] > outids[i]);
+		}
+
+		// the sorting permutation with 32-bit and 64-bit indices, the keys are left unchanged
+		bool succeededk6{rsbd8::argsort(keyvaluecount, originalkeys, outids)};
+		assert(succeededk6);
+		for(std::size_t i{}; keyvaluecount > i; ++i){
+			assert(reference[i] == originalkeys[outids[i]]);
+			if(i) assert(reference[i - 1u] != reference[i] || outids[i - 1u] < outids[i]);
+		}
+		std::uint64_t *outindices{new std::uint64_t[keyvaluecount]};
+		bool succeededk7{rsbd8::argsort<rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>(keyvaluecount, values, outindices)};
+		assert(succeededk7);
+		for(std::size_t i{}; keyvaluecount > i; ++i){
+			assert(!std::memcmp(values + outindices[i], referencevalues + i, sizeof(float)));
+			if(i) assert((referencevalues[i - 1u] != referencevalues[i] && referencevalues[i - 1u] != -referencevalues[i]) || outindices[i - 1u] > outindices[i]);
+		}
+
+		// reorder columns of different types in the order of the permutation, with the sorted keys from the last sorting pass
+		std::uint64_t *sortedkeys{new std::uint64_t[keyvaluecount]};
+		bool succeededk8{rsbd8::argsortcopy(keyvaluecount, originalkeys, outindices, sortedkeys)};
+		assert(succeededk8);
+		assert(!std::memcmp(reference, sortedkeys, keyvaluecount * sizeof(std::uint64_t)));
+		for(std::size_t i{}; keyvaluecount > i; ++i) ids[i] = static_cast<std::uint32_t>(i);
+		std::memcpy(outvalues, values, keyvaluecount * sizeof(float));
+		std::memcpy(keys, originalkeys, keyvaluecount * sizeof(std::uint64_t));
+		bool succeededk9{rsbd8::applypermutation(keyvaluecount, outindices, ids, outvalues, keys)};
+		assert(succeededk9);
+		for(std::size_t i{}; keyvaluecount > i; ++i){
+			assert(outindices[i] == ids[i]);
+			assert(!std::memcmp(values + outindices[i], outvalues + i, sizeof(float)));
+		}
+		assert(!std::memcmp(reference, keys, keyvaluecount * sizeof(std::uint64_t)));
+		rsbd8::gatherpermutation(keyvaluecount, outindices, originalkeys, sortedkeys);
+		assert(!std::memcmp(reference, sortedkeys, keyvaluecount * sizeof(std::uint64_t)));
+		delete[] sortedkeys;
+		delete[] outindices;
+		delete[] referencevalues;
+		delete[] outvalues;
+		delete[] values;
+		delete[] outids;
+		delete[] ids;
+		delete[] reference;
+		delete[] originalkeys;
+		delete[] keys;
+	}
+
+	{// unit tests with partial sorting
+		static std::size_t constexpr partialcount{100000u};
+		std::uint64_t seed{0x2545F4914F6CDD1Du};
+		std::uint64_t *keys{new std::uint64_t[partialcount]}, *reference{new std::uint64_t[partialcount]};
+		float *values{new float[partialcount]}, *referencevalues{new float[partialcount]};
+		for(std::size_t i{}; partialcount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			keys[i] = seed >> (seed & 63u);// include many duplicates
+			values[i] = static_cast<float>(static_cast<std::int32_t>(seed >> 40) % 1000) * .5f;// include positive and negative values with the same absolute value
+		}
+		std::memcpy(reference, keys, partialcount * sizeof(std::uint64_t));
+		bool succeededp0{rsbd8::radixsort(partialcount, reference)};
+		assert(succeededp0);
+		// the first k items are those of the sorted array, and no item is lost
+		bool succeededp1{rsbd8::radixsortpartial(partialcount, 100u, keys)};
+		assert(succeededp1);
+		assert(!std::memcmp(reference, keys, 100u * sizeof(std::uint64_t)));
+		bool succeededp2{rsbd8::radixsort(partialcount, keys)};
+		assert(succeededp2);
+		assert(!std::memcmp(reference, keys, partialcount * sizeof(std::uint64_t)));
+
+		// the order of keys with the same absolute value is the same as for sorting the entire array
+		std::memcpy(referencevalues, values, partialcount * sizeof(float));
+		bool succeededp3{rsbd8::radixsort<rsbd8::sortingdirection::dscrevorder, rsbd8::sortingmode::nativeabs>(partialcount, referencevalues)};
+		assert(succeededp3);
+		bool succeededp4{rsbd8::radixsortpartial<rsbd8::sortingdirection::dscrevorder, rsbd8::sortingmode::nativeabs>(partialcount, 1000u, values)};
+		assert(succeededp4);
+		assert(!std::memcmp(referencevalues, values, 1000u * sizeof(float)));// compare the bits to include the signs
+		delete[] referencevalues;
+		delete[] values;
+		delete[] reference;
+		delete[] keys;
+	}
+
+	{// unit tests with selecting items by their rank
+		static std::size_t constexpr selectioncount{100000u};
+		std::uint64_t seed{0xD1B54A32D192ED03u};
+		std::uint64_t *keys{new std::uint64_t[selectioncount]}, *reference{new std::uint64_t[selectioncount]};
+		float *values{new float[selectioncount]}, *referencevalues{new float[selectioncount]};
+		for(std::size_t i{}; selectioncount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			keys[i] = seed >> (seed & 63u);// include many duplicates
+			values[i] = static_cast<float>(static_cast<std::int32_t>(seed >> 40) % 1000) * .5f;// include positive and negative values with the same absolute value
+		}
+		std::memcpy(reference, keys, selectioncount * sizeof(std::uint64_t));
+		bool succeededs0{rsbd8::radixsort(selectioncount, reference)};
+		assert(succeededs0);
+		std::size_t const ranks[5]{selectioncount - 1u, selectioncount >> 1, 0u, selectioncount / 100u, selectioncount >> 1};
+		std::uint64_t selected[5];
+		bool succeededs1{rsbd8::radixselect(selectioncount, keys, 5u, ranks, selected)};
+		assert(succeededs1);
+		for(std::size_t i{}; 5u > i; ++i) assert(reference[ranks[i]] == selected[i]);
+
+		// the order of keys with the same absolute value is the same as for sorting the entire array
+		std::memcpy(referencevalues, values, selectioncount * sizeof(float));
+		bool succeededs2{rsbd8::radixsort<rsbd8::sortingdirection::dscrevorder, rsbd8::sortingmode::nativeabs>(selectioncount, referencevalues)};
+		assert(succeededs2);
+		for(std::size_t rank{}; selectioncount > rank; rank += 9973u){
+			float median;
+			bool succeededs3{rsbd8::radixselect<rsbd8::sortingdirection::dscrevorder, rsbd8::sortingmode::nativeabs>(selectioncount, values, rank, median)};
+			assert(succeededs3);
+			assert(!std::memcmp(referencevalues + rank, &median, sizeof(float)));// compare the bits to include the signs
+		}
+		delete[] referencevalues;
+		delete[] values;
+		delete[] reference;
+		delete[] keys;
+	}
+
+	{// unit tests with the digit histograms and the equi-depth boundaries
+		static std::size_t constexpr distributioncount{100000u};
+		std::uint64_t seed{0x8BB84B93962EACC9u};
+		std::int32_t *keys{new std::int32_t[distributioncount]}, *reference{new std::int32_t[distributioncount]};
+		for(std::size_t i{}; distributioncount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			keys[i] = static_cast<std::int32_t>(seed >> 32) >> (seed & 31u);// include many duplicates and negative values
+		}
+		std::memcpy(reference, keys, distributioncount * sizeof(std::int32_t));
+		bool succeededh0{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder>(distributioncount, reference)};
+		assert(succeededh0);
+		std::size_t *counts{new std::size_t[rsbd8::histogramlength<std::int32_t>]};
+		rsbd8::radixhistogram<rsbd8::sortingdirection::dscfwdorder>(distributioncount, keys, counts);
+		for(unsigned digit{}; rsbd8::histogramdigits<std::int32_t> > digit; ++digit){
+			std::size_t total{};
+			for(std::size_t i{}; static_cast<std::size_t>(1u) << rsbd8::histogramradix<std::int32_t> > i; ++i) total += counts[(static_cast<std::size_t>(digit) << rsbd8::histogramradix<std::int32_t>) + i];
+			assert(distributioncount == total);
+		}
+		std::int32_t boundaries[7];
+		bool succeededh1{rsbd8::radixboundaries<rsbd8::sortingdirection::dscfwdorder>(distributioncount, keys, counts, 8u, boundaries)};
+		assert(succeededh1);
+		for(std::size_t i{}; 7u > i; ++i) assert(reference[distributioncount * (i + 1u) / 8u] == boundaries[i]);
+		delete[] counts;
+		delete[] reference;
+		delete[] keys;
+	}
+
+	{// unit tests with sorting and removing equal items
+		static std::size_t constexpr uniqueitems{100000u};
+		std::uint64_t seed{0x4F1BBCDCBFA53E0Bu};
+		std::uint64_t *keys{new std::uint64_t[uniqueitems]}, *reference{new std::uint64_t[uniqueitems]};
+		float *values{new float[uniqueitems]}, *outvalues{new float[uniqueitems]}, *referencevalues{new float[uniqueitems]};
+		for(std::size_t i{}; uniqueitems > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			keys[i] = seed >> (seed & 63u);// include many duplicates
+			values[i] = static_cast<float>(static_cast<std::int32_t>(seed >> 40) % 1000) * .5f;// include positive and negative values with the same absolute value
+		}
+		std::memcpy(reference, keys, uniqueitems * sizeof(std::uint64_t));
+		bool succeededu0{rsbd8::radixsort(uniqueitems, reference)};
+		assert(succeededu0);
+		std::size_t referencecount{1u};
+		for(std::size_t i{1u}; uniqueitems > i; ++i) if(reference[referencecount - 1u] != reference[i]) reference[referencecount++] = reference[i];
+		std::size_t uniquecount{};
+		bool succeededu1{rsbd8::radixsortunique(uniqueitems, keys, uniquecount)};
+		assert(succeededu1);
+		assert(referencecount == uniquecount);
+		assert(!std::memcmp(reference, keys, uniquecount * sizeof(std::uint64_t)));
+
+		// keep the first or the last of the items with the same absolute value in the sorting order
+		std::memcpy(referencevalues, values, uniqueitems * sizeof(float));
+		bool succeededu2{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(uniqueitems, referencevalues)};
+		assert(succeededu2);
+		bool succeededu3{rsbd8::radixsortcopyunique<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs, rsbd8::uniquekeep::first>(uniqueitems, values, outvalues, uniquecount)};
+		assert(succeededu3);
+		std::size_t position{};
+		for(std::size_t i{}; uniquecount > i; ++i){
+			assert(!std::memcmp(referencevalues + position, outvalues + i, sizeof(float)));// compare the bits to include the signs
+			float const absolute{(0.f > outvalues[i])? -outvalues[i] : outvalues[i]};
+			while(uniqueitems > position && (absolute == referencevalues[position] || absolute == -referencevalues[position])) ++position;
+		}
+		assert(uniqueitems == position);
+		bool succeededu4{rsbd8::radixsortcopyunique<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs, rsbd8::uniquekeep::last>(uniqueitems, values, outvalues, uniquecount)};
+		assert(succeededu4);
+		position = 0u;
+		for(std::size_t i{}; uniquecount > i; ++i){
+			float const absolute{(0.f > outvalues[i])? -outvalues[i] : outvalues[i]};
+			while(uniqueitems > position && (absolute == referencevalues[position] || absolute == -referencevalues[position])) ++position;
+			assert(!std::memcmp(referencevalues + position - 1u, outvalues + i, sizeof(float)));
+		}
+		assert(uniqueitems == position);
+		delete[] referencevalues;
+		delete[] outvalues;
+		delete[] values;
+		delete[] reference;
+		delete[] keys;
+	}
+
+	{// unit tests with grouping sorted items
+		static std::size_t constexpr groupitems{100000u};
+		std::uint64_t seed{0x94D049BB133111EBu};
+		std::uint32_t *keys{new std::uint32_t[groupitems]}, *reference{new std::uint32_t[groupitems]}, *outkeys{new std::uint32_t[groupitems]};
+		std::int16_t *payloads{new std::int16_t[groupitems]};
+		std::size_t *outcounts{new std::size_t[groupitems]};
+		std::int64_t *outsums{new std::int64_t[groupitems]};
+		for(std::size_t i{}; groupitems > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			keys[i] = static_cast<std::uint32_t>(seed >> 32) % 5000u;// about 20 items per key
+			payloads[i] = static_cast<std::int16_t>(static_cast<std::int32_t>(seed >> 40) % 1000);
+		}
+		std::memcpy(reference, keys, groupitems * sizeof(std::uint32_t));
+		bool succeededg0{rsbd8::radixsort(groupitems, reference)};
+		assert(succeededg0);
+		std::size_t groupcount{};
+		bool succeededg1{rsbd8::radixsortgroup(groupitems, keys, outkeys, outcounts, groupcount)};
+		assert(succeededg1);
+		std::size_t position{};
+		for(std::size_t i{}; groupcount > i; ++i){
+			assert(reference[position] == outkeys[i]);
+			assert(!i || outkeys[i - 1u] < outkeys[i]);
+			position += outcounts[i];
+			assert(reference[position - 1u] == outkeys[i]);
+		}
+		assert(groupitems == position);
+
+		// the sums and maximums of the payloads, in descending order of the keys
+		bool succeededg2{rsbd8::radixsortgroup<rsbd8::sortingdirection::dscfwdorder>(groupitems, keys, payloads, outkeys, outcounts, outsums, groupcount)};
+		assert(succeededg2);
+		for(std::size_t i{}; groupcount > i; ++i){
+			std::int64_t sum{};
+			std::size_t items{};
+			for(std::size_t j{}; groupitems > j; ++j) if(outkeys[i] == keys[j]){
+				sum += payloads[j];
+				++items;
+			}
+			assert(!i || outkeys[i - 1u] > outkeys[i]);
+			assert(items == outcounts[i]);
+			assert(sum == outsums[i]);
+			if(16u == i) break;// the check is quadratic, so only check some of the groups
+		}
+		bool succeededg3{rsbd8::radixsortgroup<rsbd8::sortingdirection::ascfwdorder, rsbd8::sortingmode::native, rsbd8::groupaggregate::maximum>(groupitems, keys, payloads, outkeys, nullptr, outsums, groupcount)};
+		assert(succeededg3);
+		for(std::size_t j{}; groupitems > j; ++j){
+			std::size_t const i{static_cast<std::size_t>(std::lower_bound(outkeys, outkeys + groupcount, keys[j]) - outkeys)};
+			assert(outkeys[i] == keys[j]);
+			assert(outsums[i] >= payloads[j]);
+		}
+		delete[] outsums;
+		delete[] outcounts;
+		delete[] payloads;
+		delete[] outkeys;
+		delete[] reference;
+		delete[] keys;
+	}
+
+	{// unit tests with sorting variable-length strings
+		static std::size_t constexpr stringcount{100000u};
+		std::uint64_t seed{0xBF58476D1CE4E5B9u};
+		char *characters{new char[stringcount * 24u]};
+		std::string_view *strings{new std::string_view[stringcount]}, *original{new std::string_view[stringcount]};
+		for(std::size_t i{}; stringcount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			std::size_t const length{static_cast<std::size_t>(seed >> 59) + 8u * !(seed & 3u)};// up to 23 characters, including long common prefixes and the empty string
+			char *pstring{characters + i * 24u};
+			for(std::size_t j{}; length > j; ++j) pstring[j] = (j < 8u)? 'a' + static_cast<char>(seed >> (j * 2u) & 1u) : static_cast<char>(seed >> (j + 8u));// include bytes above 0x7F
+			strings[i] = std::string_view{pstring, length};
+		}
+		std::memcpy(original, strings, stringcount * sizeof(std::string_view));
+		bool succeededt0{rsbd8::radixsortstrings(stringcount, strings)};
+		assert(succeededt0);
+		for(std::size_t i{1u}; stringcount > i; ++i){
+			int const comparison{strings[i - 1u].compare(strings[i])};
+			assert(0 > comparison || (!comparison && strings[i - 1u].data() < strings[i].data()));// equal strings keep their order
+		}
+		std::memcpy(strings, original, stringcount * sizeof(std::string_view));
+		bool succeededt1{rsbd8::radixsortstrings<rsbd8::sortingdirection::dscrevorder>(stringcount, strings)};
+		assert(succeededt1);
+		for(std::size_t i{1u}; stringcount > i; ++i){
+			int const comparison{strings[i - 1u].compare(strings[i])};
+			assert(0 < comparison || (!comparison && strings[i - 1u].data() > strings[i].data()));// equal strings are in the reverse order
+		}
+		delete[] original;
+		delete[] strings;
+		delete[] characters;
+	}
+
+	{// unit tests with sorting keys wider than 128 bits
+		static std::size_t constexpr wideitemcount{100000u};
+		std::uint64_t seed{0x94D049BB133111EBu};
+		using digest = std::array<unsigned char, 32>;
+		digest *digests{new digest[wideitemcount]}, *original{new digest[wideitemcount]};
+		for(std::size_t i{}; wideitemcount > i; ++i){
+			for(std::size_t j{}; 32u > j; ++j){
+				seed = seed * 6364136223846793005u + 1442695040888963407u;
+				// only the first byte and the last 3 bytes vary, and only partly, so most sorting passes are skipped and many keys are equal
+				original[i][j] = (!j)? static_cast<unsigned char>(seed >> 61) : (29u <= j)? static_cast<unsigned char>(seed >> 62) : static_cast<unsigned char>(j);
+			}
+		}
+		std::memcpy(digests, original, wideitemcount * sizeof(digest));
+		bool succeededw0{rsbd8::radixsortwide(wideitemcount, digests)};
+		assert(succeededw0);
+		for(std::size_t i{1u}; wideitemcount > i; ++i) assert(0 >= std::memcmp(digests[i - 1u].data(), digests[i].data(), sizeof(digest)));
+		std::memcpy(digests, original, wideitemcount * sizeof(digest));
+		bool succeededw1{rsbd8::radixsortwide<rsbd8::sortingdirection::dscfwdorder>(wideitemcount, digests)};
+		assert(succeededw1);
+		for(std::size_t i{1u}; wideitemcount > i; ++i) assert(0 <= std::memcmp(digests[i - 1u].data(), digests[i].data(), sizeof(digest)));
+
+		// as little-endian multi-word integers the last word is the most significant one
+		struct uint256{
+			std::uint64_t words[4];
+		};
+		uint256 *integers{reinterpret_cast<uint256 *>(digests)};
+		std::memcpy(integers, original, wideitemcount * sizeof(uint256));
+		bool succeededw2{rsbd8::radixsortwide<rsbd8::sortingdirection::ascfwdorder, rsbd8::widekeyorder::words>(wideitemcount, integers)};
+		assert(succeededw2);
+		for(std::size_t i{1u}; wideitemcount > i; ++i){
+			unsigned j{3u};
+			while(j && integers[i - 1u].words[j] == integers[i].words[j]) --j;
+			assert(integers[i - 1u].words[j] <= integers[i].words[j]);
+		}
+
+		struct keyeditem{
+			digest key;
+			std::size_t position;
+		};
+		keyeditem *items{new keyeditem[wideitemcount]};
+		keyeditem **pointers{new keyeditem *[wideitemcount]};
+		for(std::size_t i{}; wideitemcount > i; ++i){
+			items[i].key = original[i];
+			items[i].position = i;
+			pointers[i] = items + i;
+		}
+		bool succeededw3{rsbd8::radixsortwide<&keyeditem::key>(wideitemcount, pointers)};
+		assert(succeededw3);
+		for(std::size_t i{1u}; wideitemcount > i; ++i){
+			int const comparison{std::memcmp(pointers[i - 1u]->key.data(), pointers[i]->key.data(), sizeof(digest))};
+			assert(0 > comparison || (!comparison && pointers[i - 1u]->position < pointers[i]->position));// equal keys keep their order
+		}
+		for(std::size_t i{}; wideitemcount > i; ++i) pointers[i] = items + i;
+		bool succeededw4{rsbd8::radixsortwide<&keyeditem::key, rsbd8::sortingdirection::dscrevorder>(wideitemcount, pointers)};
+		assert(succeededw4);
+		for(std::size_t i{1u}; wideitemcount > i; ++i){
+			int const comparison{std::memcmp(pointers[i - 1u]->key.data(), pointers[i]->key.data(), sizeof(digest))};
+			assert(0 < comparison || (!comparison && pointers[i - 1u]->position > pointers[i]->position));// equal keys are in the reverse order
+		}
+		delete[] pointers;
+		delete[] items;
+		delete[] original;
+		delete[] digests;
+	}
+
+	{// unit tests with sorting by several keys
+		static std::size_t constexpr rowcount{100000u};
+		struct row{
+			std::int32_t a;
+			double b;
+			std::uint16_t c;
+			std::size_t position;
+			std::int32_t geta()const noexcept{return{a};}
+		};
+		std::uint64_t seed{0xD6E8FEB86659FD93u};
+		row *rows{new row[rowcount]};
+		row **pointers{new row *[rowcount]};
+		for(std::size_t i{}; rowcount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			rows[i].a = static_cast<std::int32_t>(seed >> 61) - 4;// few distinct values for each key, so many items have equal keys
+			rows[i].b = static_cast<double>(static_cast<std::int32_t>(seed >> 56 & 7u) - 3) * .5;
+			rows[i].c = static_cast<std::uint16_t>(seed >> 40 & 3u);
+			rows[i].position = i;
+			pointers[i] = rows + i;
+		}
+		bool succeededk0{rsbd8::radixsortmultikey<rsbd8::sortkey<&row::a>, rsbd8::sortkey<&row::b, rsbd8::sortingdirection::dscfwdorder>, rsbd8::sortkey<&row::c>>(rowcount, pointers)};
+		assert(succeededk0);
+		for(std::size_t i{1u}; rowcount > i; ++i){
+			row const &previous{*pointers[i - 1u]}, &current{*pointers[i]};
+			assert(previous.a < current.a || previous.a == current.a && (previous.b > current.b || previous.b == current.b && (previous.c < current.c ||
+				previous.c == current.c && previous.position < current.position)));// items with all keys equal keep their order
+		}
+		for(std::size_t i{}; rowcount > i; ++i) pointers[i] = rows + i;
+		bool succeededk1{rsbd8::radixsortmultikey<rsbd8::sortkey<&row::c, rsbd8::sortingdirection::dscfwdorder>, rsbd8::sortkey<&row::geta, rsbd8::sortingdirection::ascfwdorder, rsbd8::sortingmode::nativeabs>>(rowcount, pointers)};
+		assert(succeededk1);
+		for(std::size_t i{1u}; rowcount > i; ++i){
+			row const &previous{*pointers[i - 1u]}, &current{*pointers[i]};
+			std::int32_t const absprevious{(0 > previous.a)? -previous.a : previous.a}, abscurrent{(0 > current.a)? -current.a : current.a};
+			assert(previous.c > current.c || previous.c == current.c && (absprevious < abscurrent ||
+				absprevious == abscurrent && previous.position < current.position));// items with all keys equal keep their order
+		}
+		delete[] pointers;
+		delete[] rows;
+	}
+
+	{// unit tests with presortedness detection
+		static std::size_t constexpr presortedcount{100000u};
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		std::uint64_t *keys{new std::uint64_t[presortedcount]}, *sortedkeys{new std::uint64_t[presortedcount]}, *reference{new std::uint64_t[presortedcount]};
+		float *values{new float[presortedcount]}, *sortedvalues{new float[presortedcount]}, *referencevalues{new float[presortedcount]};
+		for(std::size_t i{}; presortedcount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			keys[i] = seed >> (seed & 63u);// include many duplicates
+			values[i] = static_cast<float>(static_cast<std::int32_t>(seed >> 40) % 1000) * .5f;// include positive and negative values with the same absolute value
+		}
+		// compare the results with the detection enabled to those of the regular sorting, for the current input
+		auto comparesorting{[&]{
+			bool waspreviouslyenabled{rsbd8::setpresortednessdetection(false)};
+			assert(!waspreviouslyenabled);
+			std::memcpy(reference, keys, presortedcount * sizeof(std::uint64_t));
+			bool succeededp0{rsbd8::radixsort(presortedcount, reference)};
+			assert(succeededp0);
+			waspreviouslyenabled = rsbd8::setpresortednessdetection(true);
+			assert(!waspreviouslyenabled);
+			assert(rsbd8::getpresortednessdetection());
+			bool succeededp1{rsbd8::radixsortcopy(presortedcount, keys, sortedkeys)};
+			assert(succeededp1);
+			assert(!std::memcmp(reference, sortedkeys, presortedcount * sizeof(std::uint64_t)));
+			std::memcpy(sortedkeys, keys, presortedcount * sizeof(std::uint64_t));
+			bool succeededp2{rsbd8::radixsort(presortedcount, sortedkeys)};
+			assert(succeededp2);
+			assert(!std::memcmp(reference, sortedkeys, presortedcount * sizeof(std::uint64_t)));
+			// stability in both directions of ordering items with the same absolute value
+			rsbd8::setpresortednessdetection(false);
+			std::memcpy(referencevalues, values, presortedcount * sizeof(float));
+			bool succeededp3{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(presortedcount, referencevalues)};
+			assert(succeededp3);
+			rsbd8::setpresortednessdetection(true);
+			std::memcpy(sortedvalues, values, presortedcount * sizeof(float));
+			bool succeededp4{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(presortedcount, sortedvalues)};
+			assert(succeededp4);
+			assert(!std::memcmp(referencevalues, sortedvalues, presortedcount * sizeof(float)));// compare the bits to include the signs
+			rsbd8::setpresortednessdetection(false);
+			std::memcpy(referencevalues, values, presortedcount * sizeof(float));
+			bool succeededp5{rsbd8::radixsort<rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>(presortedcount, referencevalues)};
+			assert(succeededp5);
+			rsbd8::setpresortednessdetection(true);
+			bool succeededp6{rsbd8::radixsortcopy<rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>(presortedcount, values, sortedvalues)};
+			assert(succeededp6);
+			assert(!std::memcmp(referencevalues, sortedvalues, presortedcount * sizeof(float)));
+			rsbd8::setpresortednessdetection(false);
+		}};
+		// random input, which has too many runs
+		comparesorting();
+		// a few sorted runs, like chunks of time-ordered items with late arrivals
+		for(std::size_t i{}; presortedcount > i; i += presortedcount / 5u){
+			bool succeededp7{rsbd8::radixsort(presortedcount / 5u, keys + i)};
+			assert(succeededp7);
+			bool succeededp8{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(presortedcount / 5u, values + i)};
+			assert(succeededp8);
+		}
+		comparesorting();
+		// sorted input
+		bool succeededp9{rsbd8::radixsort(presortedcount, keys)};
+		assert(succeededp9);
+		bool succeededp10{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(presortedcount, values)};
+		assert(succeededp10);
+		comparesorting();
+		// input in the reverse of the sorting order, with alternating signs for the absolute value modes
+		for(std::size_t i{}; presortedcount > i; ++i){
+			keys[i] = presortedcount - i;
+			values[i] = static_cast<float>(i) * ((i & 1u)? -.25f : .25f);
+		}
+		comparesorting();
+		delete[] referencevalues;
+		delete[] sortedvalues;
+		delete[] values;
+		delete[] reference;
+		delete[] sortedkeys;
+		delete[] keys;
+	}
+
+	{// unit tests with merging a sorted batch into sorted items
+		static std::size_t constexpr mergesortedcount{90000u}, mergebatchcount{10001u}, mergetotal{mergesortedcount + mergebatchcount};
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		std::uint64_t *keys{new std::uint64_t[mergetotal]}, *reference{new std::uint64_t[mergetotal]};
+		float *values{new float[mergetotal]}, *referencevalues{new float[mergetotal]};
+		class Mergeitem{
+		public:
+			std::int32_t key;
+		};
+		Mergeitem *items{new Mergeitem[mergetotal]};
+		Mergeitem const **pointers{new Mergeitem const *[mergetotal]}, **referencepointers{new Mergeitem const *[mergetotal]};
+		for(std::size_t i{}; mergetotal > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			keys[i] = seed >> (seed & 63u);// include many duplicates
+			values[i] = static_cast<float>(static_cast<std::int32_t>(seed >> 40) % 1000) * .5f;// include positive and negative values with the same absolute value
+			items[i].key = static_cast<std::int32_t>(seed >> 32) % 1000;
+			pointers[i] = items + i;
+			referencepointers[i] = items + i;
+		}
+		// the results are compared to sorting all items at once
+		std::memcpy(reference, keys, mergetotal * sizeof(std::uint64_t));
+		bool succeededm0{rsbd8::radixsort(mergetotal, reference)};
+		assert(succeededm0);
+		bool succeededm1{rsbd8::radixsort(mergesortedcount, keys)};
+		assert(succeededm1);
+		rsbd8::sortworkspace workspace;
+		auto allocated{workspace.prepare<false, false, false, std::uint64_t, false>(mergetotal, 8u)};
+		assert(allocated.pbuffer);
+		rsbd8::radixsortmergenoalloc(mergesortedcount, mergebatchcount, 8u, allocated.pfuturesplaceholder, allocated.pzeroedindices, keys, allocated.pbuffer, true);
+		assert(!std::memcmp(reference, allocated.pbuffer, mergetotal * sizeof(std::uint64_t)));
+		// a batch of a single item, and an empty batch
+		std::memcpy(keys, allocated.pbuffer, (mergetotal - 1u) * sizeof(std::uint64_t));
+		keys[mergetotal - 1u] = 0u;
+		bool succeededm2{rsbd8::radixsortmerge(mergetotal - 1u, 1u, keys)};
+		assert(succeededm2);
+		assert(!keys[0]);
+		for(std::size_t i{1u}; mergetotal > i; ++i) assert(keys[i - 1u] <= keys[i]);
+		bool succeededm3{rsbd8::radixsortmerge(mergetotal, 0u, keys)};
+		assert(succeededm3);
+
+		// stability in both directions of ordering items with the same absolute value, the sorted items go first in forward ordering
+		std::memcpy(referencevalues, values, mergetotal * sizeof(float));
+		bool succeededm4{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(mergetotal, referencevalues)};
+		assert(succeededm4);
+		float *sortedvalues{new float[mergetotal]};
+		std::memcpy(sortedvalues, values, mergetotal * sizeof(float));
+		bool succeededm5{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(mergesortedcount, sortedvalues)};
+		assert(succeededm5);
+		bool succeededm6{rsbd8::radixsortmerge<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(mergesortedcount, mergebatchcount, sortedvalues)};
+		assert(succeededm6);
+		assert(!std::memcmp(referencevalues, sortedvalues, mergetotal * sizeof(float)));// compare the bits to include the signs
+		std::memcpy(referencevalues, values, mergetotal * sizeof(float));
+		bool succeededm7{rsbd8::radixsort<rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>(mergetotal, referencevalues)};
+		assert(succeededm7);
+		std::memcpy(sortedvalues, values, mergetotal * sizeof(float));
+		bool succeededm8{rsbd8::radixsort<rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>(mergesortedcount, sortedvalues)};
+		assert(succeededm8);
+		bool succeededm9{rsbd8::radixsortmerge<rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>(mergesortedcount, mergebatchcount, sortedvalues)};
+		assert(succeededm9);
+		assert(!std::memcmp(referencevalues, sortedvalues, mergetotal * sizeof(float)));
+
+		// stability with indirection
+		bool succeededm10{rsbd8::radixsort<&Mergeitem::key>(mergetotal, referencepointers)};
+		assert(succeededm10);
+		bool succeededm11{rsbd8::radixsort<&Mergeitem::key>(mergesortedcount, pointers)};
+		assert(succeededm11);
+		bool succeededm12{rsbd8::radixsortmerge<&Mergeitem::key>(mergesortedcount, mergebatchcount, pointers)};
+		assert(succeededm12);
+		for(std::size_t i{}; mergetotal > i; ++i) assert(referencepointers[i] == pointers[i]);
+		delete[] sortedvalues;
+		delete[] referencepointers;
+		delete[] pointers;
+		delete[] items;
+		delete[] referencevalues;
+		delete[] values;
+		delete[] reference;
+		delete[] keys;
+	}
+
+	{// unit tests with the streaming sort builder
+		static std::size_t constexpr buildercount{100000u};
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		std::uint64_t *keys{new std::uint64_t[buildercount]}, *reference{new std::uint64_t[buildercount]};
+		float *values{new float[buildercount]}, *referencevalues{new float[buildercount]};
+		for(std::size_t i{}; buildercount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			keys[i] = seed >> (seed & 63u);// include many duplicates
+			values[i] = static_cast<float>(static_cast<std::int32_t>(seed >> 40) % 1000) * .5f;// include positive and negative values with the same absolute value
+		}
+		bool succeededb0{rsbd8::radixsortcopy(buildercount, keys, reference)};
+		assert(succeededb0);
+		// chunks of varying sizes, without reserving, so the memory grows several times
+		rsbd8::sortbuilder<std::uint64_t> builder;
+		for(std::size_t i{}, chunk{1u}; buildercount > i; i += chunk, chunk = chunk * 3u + 1u){
+			bool succeededb1{builder.append(keys + i, (chunk < buildercount - i)? chunk : buildercount - i)};
+			assert(succeededb1);
+		}
+		assert(buildercount == builder.size());
+		std::uint64_t const *sortedkeys{builder.finalise()};
+		for(std::size_t i{}; buildercount > i; ++i) assert(reference[i] == sortedkeys[i]);
+		// re-use after clearing
+		builder.clear();
+		bool succeededb2{builder.append(keys, buildercount)};
+		assert(succeededb2);
+		sortedkeys = builder.finalise();
+		for(std::size_t i{}; buildercount > i; ++i) assert(reference[i] == sortedkeys[i]);
+		builder.release();
+		assert(!builder.capacity());
+
+		// stability in both directions of ordering items with the same absolute value, with the memory reserved beforehand
+		for(std::size_t i{}; buildercount > i; ++i) referencevalues[i] = values[i];
+		bool succeededb3{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(buildercount, referencevalues)};
+		assert(succeededb3);
+		rsbd8::sortbuilder<float, rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs> builderdscfwd;
+		bool succeededb4{builderdscfwd.reserve(buildercount)};
+		assert(succeededb4);
+		for(std::size_t i{}; buildercount > i; i += 4096u){
+			bool succeededb5{builderdscfwd.append(values + i, (4096u < buildercount - i)? 4096u : buildercount - i)};
+			assert(succeededb5);
+		}
+		assert(buildercount == builderdscfwd.capacity());
+		assert(!std::memcmp(referencevalues, builderdscfwd.finalise(), buildercount * sizeof(float)));// compare the bits to include the signs
+		for(std::size_t i{}; buildercount > i; ++i) referencevalues[i] = values[i];
+		bool succeededb6{rsbd8::radixsort<rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>(buildercount, referencevalues)};
+		assert(succeededb6);
+		rsbd8::sortbuilder<float, rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs> builderascrev;
+		bool succeededb7{builderascrev.append(values, buildercount)};
+		assert(succeededb7);
+		assert(!std::memcmp(referencevalues, builderascrev.finalise(), buildercount * sizeof(float)));
+
+		// an empty builder and a type that is not counted while appending
+		rsbd8::sortbuilder<unsigned char> builderempty;
+		assert(!builderempty.finalise());
+		builderempty.clear();
+		unsigned char const bytes[]{3u, 1u, 2u, 1u, 0u};
+		bool succeededb8{builderempty.append(bytes, sizeof(bytes))};
+		assert(succeededb8);
+		unsigned char const *sortedbytes{builderempty.finalise()};
+		for(std::size_t i{1u}; sizeof(bytes) > i; ++i) assert(sortedbytes[i - 1u] <= sortedbytes[i]);
+		delete[] referencevalues;
+		delete[] values;
+		delete[] reference;
+		delete[] keys;
+	}
+
+	{// unit tests with external sorting of files
+		// a tiny memory budget gives chunks of 2048 items, so many runs that are merged over several levels
+		static std::size_t constexpr externalcount{100000u};
+		std::uint64_t seed{0x9E3779B97F4A7C15u};
+		std::uint64_t *keys{new std::uint64_t[externalcount]}, *reference{new std::uint64_t[externalcount]};
+		float *values{new float[externalcount]}, *referencevalues{new float[externalcount]};
+		for(std::size_t i{}; externalcount > i; ++i){
+			seed = seed * 6364136223846793005u + 1442695040888963407u;
+			keys[i] = seed >> (seed & 63u);// include many duplicates
+			values[i] = static_cast<float>(static_cast<std::int32_t>(seed >> 40) % 1000) * .5f;// include positive and negative values with the same absolute value
+		}
+		auto writefile{[](char const *filename, void const *data, std::size_t size){
+			std::FILE *file{std::fopen(filename, "wb")};
+			assert(file);
+			std::size_t written{std::fwrite(data, 1u, size, file)};
+			assert(size == written);
+			std::fclose(file);
+		}};
+		auto readfile{[](char const *filename, void *data, std::size_t size){
+			std::FILE *file{std::fopen(filename, "rb")};
+			assert(file);
+			std::size_t read{std::fread(data, 1u, size, file)};
+			assert(size == read);
+			assert(EOF == std::fgetc(file));
+			std::fclose(file);
+		}};
+		writefile("rsbd8testinput.bin", keys, externalcount * sizeof(std::uint64_t));
+		bool succeededx0{rsbd8::radixsortcopy(externalcount, keys, reference)};
+		assert(succeededx0);
+		bool succeededx1{rsbd8::radixsortfile<std::uint64_t>("rsbd8testinput.bin", "rsbd8testoutput.bin", sizeof(std::uint64_t) * 8192u)};
+		assert(succeededx1);
+		readfile("rsbd8testoutput.bin", keys, externalcount * sizeof(std::uint64_t));
+		for(std::size_t i{}; externalcount > i; ++i) assert(reference[i] == keys[i]);
+		assert(!std::fopen("rsbd8testoutput.bin.0.rsbd8run", "rb"));// the runs are removed
+
+		// stability across the runs, in both directions of ordering items with the same absolute value
+		writefile("rsbd8testinput.bin", values, externalcount * sizeof(float));
+		for(std::size_t i{}; externalcount > i; ++i) referencevalues[i] = values[i];
+		bool succeededx2{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>(externalcount, referencevalues)};
+		assert(succeededx2);
+		bool succeededx3{rsbd8::radixsortfile<float, rsbd8::sortingdirection::dscfwdorder, rsbd8::sortingmode::nativeabs>("rsbd8testinput.bin", "rsbd8testoutput.bin", sizeof(float) * 8192u, ".")};
+		assert(succeededx3);
+		readfile("rsbd8testoutput.bin", values, externalcount * sizeof(float));
+		assert(!std::memcmp(referencevalues, values, externalcount * sizeof(float)));// compare the bits to include the signs
+		writefile("rsbd8testinput.bin", values, externalcount * sizeof(float));
+		bool succeededx4{rsbd8::radixsort<rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>(externalcount, referencevalues)};
+		assert(succeededx4);
+		bool succeededx5{rsbd8::radixsortfile<float, rsbd8::sortingdirection::ascrevorder, rsbd8::sortingmode::nativeabs>("rsbd8testinput.bin", "rsbd8testoutput.bin", sizeof(float) * 8192u)};
+		assert(succeededx5);
+		readfile("rsbd8testoutput.bin", values, externalcount * sizeof(float));
+		assert(!std::memcmp(referencevalues, values, externalcount * sizeof(float)));
+
+		// in-place sorting of a file that fits in a single chunk
+		bool succeededx6{rsbd8::radixsort(externalcount, referencevalues)};
+		assert(succeededx6);
+		bool succeededx7{rsbd8::radixsortfile<float>("rsbd8testoutput.bin", "rsbd8testoutput.bin", static_cast<std::size_t>(16) << 20)};
+		assert(succeededx7);
+		readfile("rsbd8testoutput.bin", values, externalcount * sizeof(float));
+		assert(!std::memcmp(referencevalues, values, externalcount * sizeof(float)));
+
+		// sorting a memory-mapped file in place, with a mapped temporary file and with regular memory as the buffer
+		bool succeededx12{rsbd8::radixsort<rsbd8::sortingdirection::dscfwdorder>(externalcount, referencevalues)};
+		assert(succeededx12);
+		bool succeededx13{rsbd8::radixsortmappedfile<float, rsbd8::sortingdirection::dscfwdorder>("rsbd8testoutput.bin", ".")};
+		assert(succeededx13);
+		readfile("rsbd8testoutput.bin", values, externalcount * sizeof(float));
+		assert(!std::memcmp(referencevalues, values, externalcount * sizeof(float)));
+		bool succeededx14{rsbd8::radixsort(externalcount, referencevalues)};
+		assert(succeededx14);
+		bool succeededx15{rsbd8::radixsortmappedfile<float>("rsbd8testoutput.bin")};
+		assert(succeededx15);
+		readfile("rsbd8testoutput.bin", values, externalcount * sizeof(float));
+		assert(!std::memcmp(referencevalues, values, externalcount * sizeof(float)));
+
+		// an empty file, a file with a partial item, a missing file and a memory budget that is too small, with both file sorting functions
+		writefile("rsbd8testinput.bin", keys, 0u);
+		bool succeededx8{rsbd8::radixsortfile<std::uint64_t>("rsbd8testinput.bin", "rsbd8testoutput.bin", 1u << 20)};
+		assert(succeededx8);
+		readfile("rsbd8testoutput.bin", keys, 0u);
+		bool succeededx16{rsbd8::radixsortmappedfile<std::uint64_t>("rsbd8testoutput.bin")};
+		assert(succeededx16);
+		writefile("rsbd8testinput.bin", keys, 3u * sizeof(std::uint64_t) + 1u);
+		bool succeededx9{rsbd8::radixsortfile<std::uint64_t>("rsbd8testinput.bin", "rsbd8testoutput.bin", 1u << 20)};
+		assert(!succeededx9);
+		bool succeededx17{rsbd8::radixsortmappedfile<std::uint64_t>("rsbd8testinput.bin")};
+		assert(!succeededx17);
+		std::remove("rsbd8testinput.bin");
+		bool succeededx10{rsbd8::radixsortfile<std::uint64_t>("rsbd8testinput.bin", "rsbd8testoutput.bin", 1u << 20)};
+		assert(!succeededx10);
+		bool succeededx18{rsbd8::radixsortmappedfile<std::uint64_t>("rsbd8testinput.bin")};
+		assert(!succeededx18);
+		bool succeededx11{rsbd8::radixsortfile<std::uint64_t>("rsbd8testoutput.bin", "rsbd8testoutput.bin", sizeof(std::uint64_t))};
+		assert(!succeededx11);
+		std::remove("rsbd8testoutput.bin");
+		delete[] referencevalues;
+		delete[] values;
+		delete[] reference;
+		delete[] keys;
+	}
+
 	return{0};
 }
\ No newline at end of file
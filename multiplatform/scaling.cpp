@@ -0,0 +1,101 @@
+// MIT License
+// Copyright (c) 2025-2026 Jan-Willem Krans (janwillem32 <at> hotmail <dot> com)
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Portable thread scaling benchmark for sorting a single very large array.
+// It sorts the same uint64 input with 1 thread up to the given maximum number of threads, and prints the time and the speed-up relative to 1 thread for each.
+// Usage: scaling [input size in MiB, default 1024] [maximum thread count, default the number of hardware threads] [repetitions, default 3] [strategy: bidirectional, globalhistogram, msdthenlsd, samplesort or all, default bidirectional]
+// The multithreading strategy only applies to 8 threads and more, so "all" measures the four strategies side by side from 8 threads onward, for example at 8, 16 and 32 threads.
+// Use an input size of 16384 MiB to measure a 16 GiB sort, which requires about 48 GiB of memory for the input, output and buffer arrays.
+
+#include "../Radixsortbidi8.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace{
+
+// simple and fast pseudo-random generator, the quality of the bits is of no importance here
+std::uint64_t scalingseed{0x9E3779B97F4A7C15u};
+std::uint64_t nextrandom()noexcept{
+	scalingseed = scalingseed * 6364136223846793005u + 1442695040888963407u;
+	return{scalingseed ^ scalingseed >> 29};
+}
+
+}// namespace
+
+int main(int argc, char **argv){
+	std::size_t inputbytes{static_cast<std::size_t>(1024) << 20};
+	if(1 < argc){
+		long parsed{std::strtol(argv[1], nullptr, 10)};
+		if(0 < parsed) inputbytes = static_cast<std::size_t>(parsed) << 20;
+	}
+	unsigned maximumthreads{std::max(std::thread::hardware_concurrency(), 1u)};
+	if(2 < argc){
+		long parsed{std::strtol(argv[2], nullptr, 10)};
+		if(0 < parsed) maximumthreads = static_cast<unsigned>(parsed);
+	}
+	unsigned repetitions{3u};
+	if(3 < argc){
+		long parsed{std::strtol(argv[3], nullptr, 10)};
+		if(0 < parsed) repetitions = static_cast<unsigned>(parsed);
+	}
+	// the strategies in the order of rsbd8::multithreadingstrategy
+	static char const *const strategynames[]{"bidirectional", "globalhistogram", "msdthenlsd", "samplesort"};
+	bool isselected[std::size(strategynames)]{true};
+	if(4 < argc){
+		bool isany{};
+		for(std::size_t i{}; std::size(strategynames) > i; ++i){
+			isselected[i] = !std::strcmp(argv[4], strategynames[i]) || !std::strcmp(argv[4], "all");
+			isany |= isselected[i];
+		}
+		if(!isany){
+			std::fputs("unknown strategy, use bidirectional, globalhistogram, msdthenlsd, samplesort or all\n", stderr);
+			return{EXIT_FAILURE};
+		}
+	}
+	std::size_t const count{inputbytes / sizeof(std::uint64_t)};
+	std::printf("hardware threads: %u, input size: %zu MiB (%zu uint64 items), repetitions per measurement: %u\n", std::thread::hardware_concurrency(), inputbytes >> 20, count, repetitions);
+	std::vector<std::uint64_t> input(count), output(count);
+	for(std::uint64_t &elem : input) elem = nextrandom();
+	rsbd8::setthreadpool(&rsbd8::defaultthreadpool());
+	rsbd8::sortworkspace workspace;
+
+	double singlethreaded{};
+	for(unsigned threads : {1u, 2u, 4u, 6u, 8u, 12u, 16u, 18u, 24u, 32u, 48u, 64u, 96u, 128u, 192u, 256u}){
+		if(maximumthreads < threads) break;
+		auto allocated{workspace.prepare<false, false, false, std::uint64_t, false>(count, threads)};
+		if(!allocated.pbuffer){
+			std::fputs("allocation failure\n", stderr);
+			return{EXIT_FAILURE};
+		}
+		for(std::size_t strategy{}; std::size(strategynames) > strategy; ++strategy){
+			if(strategy? !isselected[strategy] || 8u > threads : !isselected[0] && 8u <= threads) continue;// below 8 threads only the default strategy exists
+			rsbd8::setmultithreadingstrategy(static_cast<rsbd8::multithreadingstrategy>(strategy));
+			// the best time of a number of repetitions, as the disturbances on a large machine are mostly one-sided
+			double best{};
+			for(unsigned i{}; repetitions > i; ++i){
+				auto start{std::chrono::steady_clock::now()};
+				rsbd8::radixsortcopynoalloc(count, threads, allocated.pfuturesplaceholder, allocated.pzeroedindices, input.data(), output.data(), allocated.pbuffer);
+				double elapsed{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+				if(!i || best > elapsed) best = elapsed;
+			}
+			if(1u == threads) singlethreaded = best;
+			std::printf("%3u threads, %-15s: %9.3f s, %8.1f MiB/s, speed-up %6.2f\n", threads, strategynames[strategy], best, static_cast<double>(inputbytes >> 20) / best, singlethreaded / best);
+			std::fflush(stdout);// this tool can run for a long time, so show the progress
+		}
+	}
+	rsbd8::setmultithreadingstrategy(rsbd8::multithreadingstrategy::bidirectional);
+	for(std::size_t i{1}; count > i; ++i) if(output[i - 1] > output[i]){
+		std::fputs("sorting failure\n", stderr);
+		return{EXIT_FAILURE};
+	}
+	rsbd8::setthreadpool(nullptr);
+	return{0};
+}